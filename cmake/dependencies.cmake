@@ -10,6 +10,12 @@ if (TESTING)
   find_package(GTest CONFIG REQUIRED)
 endif()
 
+if (TESTING AND BENCHMARKS)
+  # https://docs.hunter.sh/en/latest/packages/pkg/benchmark.html
+  hunter_add_package(benchmark)
+  find_package(benchmark CONFIG REQUIRED)
+endif()
+
 # https://docs.hunter.sh/en/latest/packages/pkg/Boost.html
 hunter_add_package(Boost COMPONENTS random filesystem program_options)
 find_package(Boost CONFIG REQUIRED random filesystem program_options)
@@ -0,0 +1,123 @@
+/**
+ * Copyright Quadrivium LLC
+ * All Rights Reserved
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <mutex>
+#include <optional>
+#include <vector>
+
+#include <libp2p/basic/scheduler.hpp>
+#include <libp2p/basic/scheduler/backend.hpp>
+
+namespace libp2p::basic {
+
+  /**
+   * Scheduler implementation on top of hierarchical timing wheel.
+   * Drop-in replacement for SchedulerImpl: schedule and cancel are O(1) and
+   * timer entries are pooled, so no allocations are made on steady state
+   * except for Handle itself.
+   *
+   * Wheel has 11 levels of 64 slots, each level covers 6 bits of millisecond
+   * timestamp, so any 64-bit time fits without overflow lists. Entry is placed
+   * on level of the highest bit in which its expiration time differs from
+   * current wheel time, and is cascaded to lower levels when wheel time
+   * reaches its slot.
+   */
+  class TimingWheelScheduler
+      : public std::enable_shared_from_this<TimingWheelScheduler>,
+        public Scheduler,
+        public SchedulerBackendFeedback {
+   public:
+    /// Ctor, backend is injected
+    TimingWheelScheduler(std::shared_ptr<SchedulerBackend> backend,
+                         Scheduler::Config config);
+
+    /// Returns current async
+    std::chrono::milliseconds now() const override;
+
+    /// Scheduler API impl
+    Handle scheduleImpl(Callback &&cb,
+                        std::chrono::milliseconds delay_from_now,
+                        bool make_handle) override;
+
+    /// Timer callback, called from SchedulerBackend
+    void pulse() override;
+
+   private:
+    static constexpr size_t kSlotBits = 6;
+    static constexpr size_t kSlots = 1 << kSlotBits;
+    static constexpr size_t kLevels = (64 + kSlotBits - 1) / kSlotBits;
+    static constexpr size_t kChunkSize = 256;
+
+    struct Entry;
+
+    /// Intrusive FIFO list of entries
+    struct List {
+      Entry *head = nullptr;
+      Entry *tail = nullptr;
+    };
+
+    /// Pooled timer entry, address is stable while scheduler lives
+    struct Entry {
+      Callback cb;
+      uint64_t expires = 0;
+      Entry *prev = nullptr;
+      Entry *next = nullptr;
+      List *list = nullptr;
+      uint8_t level = 0;
+      uint8_t slot = 0;
+      /// generation << 1 | 1 if cancelled or fired
+      std::atomic_uint64_t state = 0;
+    };
+
+    class CancelHandle;
+
+    Entry *allocate(Callback &&cb);
+    void release(Entry *entry);
+
+    /// Claims entry for firing or cancelling, only one side may win
+    static bool claim(Entry &entry, uint64_t generation);
+
+    void insert(Entry *entry, uint64_t generation, uint64_t abs);
+    void place(Entry *entry);
+    void link(List &list, Entry *entry);
+    void unlink(Entry *entry);
+    void cancel(Entry *entry, uint64_t generation);
+
+    /// Moves wheel time forward, collecting expired entries into due_
+    void advance(uint64_t to);
+    size_t callDue();
+
+    /// Time when wheel reaches given slot
+    uint64_t slotTime(size_t level, size_t slot) const;
+
+    /// Lower bound of the earliest expiration in wheel
+    std::optional<uint64_t> nextExpiry() const;
+
+    /// Backend implementation
+    std::shared_ptr<SchedulerBackend> backend_;
+
+    /// Config
+    const Scheduler::Config config_;
+
+    /// Wheel time, everything expired before or at it is in due_
+    uint64_t current_;
+    std::array<std::array<List, kSlots>, kLevels> wheel_;
+    /// Bitmap of non-empty slots per level
+    std::array<uint64_t, kLevels> occupied_{};
+    List due_;
+
+    /// Entries pool, chunks are never freed so entry pointers remain valid
+    std::mutex pool_mutex_;
+    std::vector<std::unique_ptr<Entry[]>> chunks_;
+    Entry *free_ = nullptr;
+
+    Time timer_{};
+  };
+}  // namespace libp2p::basic
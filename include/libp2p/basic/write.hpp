@@ -43,4 +43,54 @@ namespace libp2p {
           write(writer, in.subspan(n), std::move(cb));
         });
   }
+
+  namespace detail {
+    inline void writeVectored(const std::shared_ptr<basic::Writer> &writer,
+                              std::shared_ptr<std::vector<BytesIn>> in,
+                              std::function<void(outcome::result<void>)> cb) {
+      writer->writeSomeVectored(
+          *in,
+          [weak{std::weak_ptr{writer}}, in, cb{std::move(cb)}](
+              outcome::result<size_t> n_res) mutable {
+            if (n_res.has_error()) {
+              return cb(n_res.error());
+            }
+            auto n = n_res.value();
+            if (n == 0) {
+              throw std::logic_error{"libp2p::write zero bytes written"};
+            }
+            // skip buffers written completely, cut the one written partially
+            auto it = in->begin();
+            for (; it != in->end() and n >= it->size(); ++it) {
+              n -= it->size();
+            }
+            if (it == in->end()) {
+              if (n != 0) {
+                throw std::logic_error{"libp2p::write too much bytes written"};
+              }
+              // successfully wrote last bytes
+              return cb(outcome::success());
+            }
+            *it = it->subspan(n);
+            in->erase(in->begin(), it);
+            // write remaining bytes
+            auto writer = weak.lock();
+            if (not writer) {
+              return cb(make_error_code(boost::asio::error::operation_aborted));
+            }
+            writeVectored(writer, std::move(in), std::move(cb));
+          });
+    }
+  }  // namespace detail
+
+  /// Write exactly total size of `in` buffers, using vectored writes
+  inline void writeVectored(const std::shared_ptr<basic::Writer> &writer,
+                            std::vector<BytesIn> in,
+                            std::function<void(outcome::result<void>)> cb) {
+    std::erase_if(in, [](BytesIn segment) { return segment.empty(); });
+    detail::writeVectored(
+        writer,
+        std::make_shared<std::vector<BytesIn>>(std::move(in)),
+        std::move(cb));
+  }
 }  // namespace libp2p
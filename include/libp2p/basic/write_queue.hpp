@@ -28,6 +28,9 @@ namespace libp2p::basic {
     /// Returns bytes enqueued and not yet sent
     size_t unsentBytes() const;
 
+    /// Returns bytes dequeued and not yet acknowledged
+    size_t unacknowledgedBytes() const;
+
     /// Enqueues data
     void enqueue(DataRef data, basic::Writer::WriteCallbackFunc cb);
 
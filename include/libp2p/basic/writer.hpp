@@ -7,6 +7,7 @@
 #pragma once
 
 #include <functional>
+#include <memory>
 
 #include <libp2p/common/types.hpp>
 #include <libp2p/outcome/outcome.hpp>
@@ -34,6 +35,32 @@ namespace libp2p::basic {
      */
     virtual void writeSome(BytesIn in, size_t bytes, WriteCallbackFunc cb) = 0;
 
+    /**
+     * @brief Write up to total size of {@code} in {@nocode} buffers in one
+     * operation (scatter/gather write). Calls \param cb after some bytes has
+     * been successfully written, buffers are consumed in order.
+     * @param in buffers to write
+     * @param cb callback with result of operation
+     *
+     * @note Default implementation gathers buffers into a temporary one and
+     * calls writeSome(), implementations capable of vectored I/O override it
+     * to avoid copying.
+     * @note caller should maintain validity of input buffers until callback
+     * is executed
+     */
+    virtual void writeSomeVectored(std::span<const BytesIn> in,
+                                   WriteCallbackFunc cb) {
+      auto buffer = std::make_shared<Bytes>();
+      for (auto &segment : in) {
+        buffer->insert(buffer->end(), segment.begin(), segment.end());
+      }
+      writeSome(*buffer,
+                buffer->size(),
+                [buffer, cb{std::move(cb)}](outcome::result<size_t> res) {
+                  cb(res);
+                });
+    }
+
     /**
      * @brief Defers reporting error state to callback to avoid reentrancy
      * (i.e. callback will not be called before initiator function returns)
@@ -0,0 +1,154 @@
+/**
+ * Copyright Quadrivium LLC
+ * All Rights Reserved
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace libp2p::metrics {
+
+  /// Metric labels, i.e. {{"muxer", "yamux"}, {"direction", "in"}}
+  using Labels = std::vector<std::pair<std::string, std::string>>;
+
+  /// Monotonically increasing value
+  class Counter {
+   public:
+    void inc(uint64_t n = 1) {
+      value_.fetch_add(n, std::memory_order_relaxed);
+    }
+
+    uint64_t value() const {
+      return value_.load(std::memory_order_relaxed);
+    }
+
+   private:
+    std::atomic_uint64_t value_{0};
+  };
+
+  /// Value which can go up and down
+  class Gauge {
+   public:
+    void inc(int64_t n = 1) {
+      value_.fetch_add(n, std::memory_order_relaxed);
+    }
+
+    void dec(int64_t n = 1) {
+      value_.fetch_sub(n, std::memory_order_relaxed);
+    }
+
+    void set(int64_t value) {
+      value_.store(value, std::memory_order_relaxed);
+    }
+
+    int64_t value() const {
+      return value_.load(std::memory_order_relaxed);
+    }
+
+   private:
+    std::atomic_int64_t value_{0};
+  };
+
+  /// Distribution of observed values over fixed buckets
+  class Histogram {
+   public:
+    struct Snapshot {
+      /// Per-bucket counts (not cumulative), last one is +Inf bucket
+      std::vector<uint64_t> counts;
+      double sum = 0;
+      uint64_t count = 0;
+    };
+
+    /// @param bounds - ascending upper bounds of buckets, +Inf is implied
+    explicit Histogram(std::vector<double> bounds);
+
+    void observe(double value);
+
+    const std::vector<double> &bounds() const {
+      return bounds_;
+    }
+
+    Snapshot snapshot() const;
+
+   private:
+    std::vector<double> bounds_;
+    std::unique_ptr<std::atomic_uint64_t[]> counts_;
+    std::atomic<double> sum_{0};
+  };
+
+  /// Bucket bounds in seconds suitable for network latencies
+  const std::vector<double> &latencyBuckets();
+
+  /// Observes time elapsed since construction into histogram, in seconds
+  class Timer {
+   public:
+    using Clock = std::chrono::steady_clock;
+
+    explicit Timer(Histogram &histogram)
+        : histogram_{&histogram}, start_{Clock::now()} {}
+
+    void observe() const {
+      histogram_->observe(
+          std::chrono::duration<double>(Clock::now() - start_).count());
+    }
+
+   private:
+    Histogram *histogram_;
+    Clock::time_point start_;
+  };
+
+  /**
+   * Process-wide registry of metrics.
+   * Metrics are created once and never destroyed, so references returned
+   * may be cached; updating a metric is a relaxed atomic operation and does
+   * not touch the registry.
+   */
+  class Registry {
+   public:
+    static Registry &get();
+
+    Counter &counter(std::string_view name,
+                     std::string_view help,
+                     const Labels &labels = {});
+
+    Gauge &gauge(std::string_view name,
+                 std::string_view help,
+                 const Labels &labels = {});
+
+    Histogram &histogram(std::string_view name,
+                         std::string_view help,
+                         const std::vector<double> &bounds,
+                         const Labels &labels = {});
+
+    /// Snapshot of all metrics in Prometheus text exposition format
+    std::string prometheus() const;
+
+   private:
+    enum class Type { COUNTER, GAUGE, HISTOGRAM };
+
+    struct Family {
+      Type type;
+      std::string help;
+      /// formatted labels -> metric
+      std::map<std::string, std::unique_ptr<Counter>> counters;
+      std::map<std::string, std::unique_ptr<Gauge>> gauges;
+      std::map<std::string, std::unique_ptr<Histogram>> histograms;
+    };
+
+    Family &family(std::string_view name, std::string_view help, Type type);
+
+    mutable std::mutex mutex_;
+    std::map<std::string, Family, std::less<>> families_;
+  };
+
+}  // namespace libp2p::metrics
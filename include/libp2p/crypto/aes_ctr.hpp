@@ -27,6 +27,15 @@ namespace libp2p::crypto::aes {
      */
     virtual outcome::result<Bytes> crypt(BytesIn data) const = 0;
 
+    /**
+     * Encrypts or decrypts user data into caller-supplied buffer
+     * @param data to be processed, may start at out.data() (in-place)
+     * @param out - destination, at least data size
+     * @return processed bytes count or an error
+     */
+    virtual outcome::result<size_t> cryptInto(BytesIn data,
+                                              BytesOut out) const = 0;
+
     /**
      * Does stream data finalization
      * @return bytes buffer to correctly pad all the previously processed
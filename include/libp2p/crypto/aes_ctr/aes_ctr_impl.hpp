@@ -35,6 +35,9 @@ namespace libp2p::crypto::aes {
 
     outcome::result<Bytes> crypt(BytesIn data) const override;
 
+    outcome::result<size_t> cryptInto(BytesIn data,
+                                      BytesOut out) const override;
+
     outcome::result<Bytes> finalize() override;
 
    private:
@@ -43,6 +43,32 @@ namespace libp2p::crypto::chachapoly {
                                            BytesIn ciphertext,
                                            BytesIn aad) = 0;
 
+    /**
+     * Does AEAD encryption into caller-supplied buffer
+     * @param nonce - custom specified nonce bytes
+     * @param plaintext to cipher, may start at out.data() (in-place)
+     * @param aad - data for message authentication
+     * @param out - destination, at least plaintext size + 16 bytes
+     * @return ciphertext size
+     */
+    virtual outcome::result<size_t> encryptInto(const Nonce &nonce,
+                                                BytesIn plaintext,
+                                                BytesIn aad,
+                                                BytesOut out) = 0;
+
+    /**
+     * Does AEAD decryption into caller-supplied buffer
+     * @param nonce - custom specified nonce bytes
+     * @param ciphertext bytes to decrypt, may start at out.data() (in-place)
+     * @param aad - data for message authentication
+     * @param out - destination, at least ciphertext size - 16 bytes
+     * @return plaintext size
+     */
+    virtual outcome::result<size_t> decryptInto(const Nonce &nonce,
+                                                BytesIn ciphertext,
+                                                BytesIn aad,
+                                                BytesOut out) = 0;
+
     /**
      * Convert 64-bit integer to 12-bit long byte sequence with four zero bytes
      * at the beginning
@@ -50,11 +76,10 @@ namespace libp2p::crypto::chachapoly {
      * @return - bytes vector
      */
     inline Nonce uint64toNonce(uint64_t n) const {
-      Bytes result(4, 0);
-      result.reserve(12);
-      libp2p::common::putUint64LE(result, n);
-      Nonce nonce;
-      std::copy_n(result.begin(), nonce.size(), nonce.begin());
+      Nonce nonce{};
+      for (size_t i = 4; i < nonce.size(); ++i, n >>= 8) {
+        nonce[i] = static_cast<uint8_t>(n & 0xff);
+      }
       return nonce;
     }
   };
@@ -6,6 +6,7 @@
 
 #pragma once
 
+#include <openssl/aead.h>
 #include <openssl/evp.h>
 #include <libp2p/crypto/chachapoly.hpp>
 #include <libp2p/log/logger.hpp>
@@ -24,12 +25,23 @@ namespace libp2p::crypto::chachapoly {
                                    BytesIn ciphertext,
                                    BytesIn aad) override;
 
-   private:
-    outcome::result<void> init(EVP_AEAD_CTX *ctx, bool encrypt);
+    outcome::result<size_t> encryptInto(const Nonce &nonce,
+                                        BytesIn plaintext,
+                                        BytesIn aad,
+                                        BytesOut out) override;
+
+    outcome::result<size_t> decryptInto(const Nonce &nonce,
+                                        BytesIn ciphertext,
+                                        BytesIn aad,
+                                        BytesOut out) override;
 
+   private:
     const Key key_;
     const EVP_AEAD *aead_;
     const size_t overhead_;
+    /// Context is initialized once and used for both directions
+    bssl::ScopedEVP_AEAD_CTX ctx_;
+    bool initialized_ = false;
     libp2p::log::Logger log_ = libp2p::log::createLogger("ChaChaPoly");
   };
 
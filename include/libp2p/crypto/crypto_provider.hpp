@@ -6,6 +6,7 @@
 
 #pragma once
 
+#include <span>
 #include <vector>
 
 #include <boost/filesystem.hpp>
@@ -22,6 +23,13 @@ namespace libp2p::crypto {
    public:
     using Buffer = std::vector<uint8_t>;
 
+    /// Signature of message to verify
+    struct VerifyItem {
+      BytesIn message;
+      BytesIn signature;
+      const PublicKey &public_key;
+    };
+
     virtual ~CryptoProvider() = default;
 
     /**
@@ -62,6 +70,25 @@ namespace libp2p::crypto {
     virtual outcome::result<bool> verify(BytesIn message,
                                          BytesIn signature,
                                          const PublicKey &public_key) const = 0;
+
+    /**
+     * @brief verifies signatures of batch of messages, keys may be of
+     * different types, on calling thread
+     * @param items to be verified
+     * @return verdict per item, false if signature doesn't match or can't be
+     * checked
+     */
+    virtual std::vector<bool> verifyBatch(
+        std::span<const VerifyItem> items) const {
+      std::vector<bool> verdicts;
+      verdicts.reserve(items.size());
+      for (const auto &item : items) {
+        auto res = verify(item.message, item.signature, item.public_key);
+        verdicts.push_back(res.has_value() and res.value());
+      }
+      return verdicts;
+    }
+
     /**
      * Generate an ephemeral public key and return a function that will
      * compute the shared secret key
@@ -58,6 +58,10 @@ namespace libp2p::crypto {
                                  BytesIn signature,
                                  const PublicKey &public_key) const override;
 
+    /// Items are verified one after another, grouped by key type
+    std::vector<bool> verifyBatch(
+        std::span<const VerifyItem> items) const override;
+
     outcome::result<EphemeralKeyPair> generateEphemeralKeyPair(
         common::CurveType curve) const override;
 
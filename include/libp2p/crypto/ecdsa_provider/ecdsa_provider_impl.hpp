@@ -11,11 +11,17 @@
 #include <openssl/ec.h>
 
 #include <libp2p/crypto/ecdsa_provider.hpp>
+#include <libp2p/crypto/public_key_cache.hpp>
 
 namespace libp2p::crypto::ecdsa {
 
   class EcdsaProviderImpl : public EcdsaProvider {
    public:
+    EcdsaProviderImpl() = default;
+
+    /// @param key_cache - cache of decoded public keys, shared by providers
+    explicit EcdsaProviderImpl(std::shared_ptr<PublicKeyCache> key_cache);
+
     outcome::result<KeyPair> generate() const override;
 
     outcome::result<PublicKey> derive(const PrivateKey &key) const override;
@@ -58,5 +64,11 @@ namespace libp2p::crypto::ecdsa {
     outcome::result<std::shared_ptr<EC_KEY>> convertBytesToEcKey(
         const KeyType &key,
         EC_KEY *(*converter)(EC_KEY **, const uint8_t **, long)) const;
+
+    /// Decodes and checks public key, or takes decoded one from cache
+    outcome::result<std::shared_ptr<EC_KEY>> getPublicEcKey(
+        const PublicKey &key) const;
+
+    std::shared_ptr<PublicKeyCache> key_cache_;
   };
 }  // namespace libp2p::crypto::ecdsa
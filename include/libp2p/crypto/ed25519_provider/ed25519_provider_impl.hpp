@@ -8,12 +8,20 @@
 
 #include <libp2p/crypto/ed25519_provider.hpp>
 
+#include <openssl/evp.h>
+
 #include <libp2p/common/types.hpp>
+#include <libp2p/crypto/public_key_cache.hpp>
 
 namespace libp2p::crypto::ed25519 {
 
   class Ed25519ProviderImpl : public Ed25519Provider {
    public:
+    Ed25519ProviderImpl() = default;
+
+    /// @param key_cache - cache of decoded public keys, shared by providers
+    explicit Ed25519ProviderImpl(std::shared_ptr<PublicKeyCache> key_cache);
+
     outcome::result<Keypair> generate() const override;
 
     outcome::result<PublicKey> derive(
@@ -25,6 +33,13 @@ namespace libp2p::crypto::ed25519 {
     outcome::result<bool> verify(BytesIn message,
                                  const Signature &signature,
                                  const PublicKey &public_key) const override;
+
+   private:
+    /// Decodes public key, or takes decoded one from cache
+    outcome::result<std::shared_ptr<EVP_PKEY>> getPublicEvpKey(
+        const PublicKey &public_key) const;
+
+    std::shared_ptr<PublicKeyCache> key_cache_;
   };
 
 }  // namespace libp2p::crypto::ed25519
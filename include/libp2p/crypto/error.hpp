@@ -28,6 +28,7 @@ namespace libp2p::crypto {
     WRONG_KEY_SIZE,                 ///< wrong key size
     STREAM_FINALIZED,  ///< crypt update operations cannot be performed after
                        ///< stream finalization
+    WRONG_OUTPUT_SIZE,  ///< output buffer is too short
   };
 
   enum class HmacProviderError {
@@ -8,6 +8,7 @@
 
 #include <libp2p/common/types.hpp>
 #include <libp2p/crypto/common.hpp>
+#include <libp2p/crypto/error.hpp>
 #include <libp2p/crypto/hasher.hpp>
 
 namespace libp2p::crypto::hmac {
@@ -37,5 +38,25 @@ namespace libp2p::crypto::hmac {
     virtual outcome::result<Bytes> calculateDigest(HashType hash_type,
                                                    const Bytes &key,
                                                    BytesIn message) const = 0;
+
+    /**
+     * @brief calculates digest into caller-supplied buffer
+     * @param hash_type hash type
+     * @param key secret key
+     * @param message source message
+     * @param out destination of digest size
+     * @return nothing if calculation was successful, error otherwise
+     */
+    virtual outcome::result<void> calculateDigestInto(HashType hash_type,
+                                                      const Bytes &key,
+                                                      BytesIn message,
+                                                      BytesOut out) const {
+      OUTCOME_TRY(digest, calculateDigest(hash_type, key, message));
+      if (digest.size() != out.size()) {
+        return HmacProviderError::WRONG_DIGEST_SIZE;
+      }
+      std::copy(digest.begin(), digest.end(), out.begin());
+      return outcome::success();
+    }
   };
 }  // namespace libp2p::crypto::hmac
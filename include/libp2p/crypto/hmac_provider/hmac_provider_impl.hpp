@@ -16,5 +16,10 @@ namespace libp2p::crypto::hmac {
     outcome::result<Bytes> calculateDigest(HashType hash_type,
                                            const Bytes &key,
                                            BytesIn message) const override;
+
+    outcome::result<void> calculateDigestInto(HashType hash_type,
+                                              const Bytes &key,
+                                              BytesIn message,
+                                              BytesOut out) const override;
   };
 }  // namespace libp2p::crypto::hmac
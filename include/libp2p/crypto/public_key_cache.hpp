@@ -0,0 +1,82 @@
+/**
+ * Copyright Quadrivium LLC
+ * All Rights Reserved
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <list>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+
+#include <libp2p/common/byteutil.hpp>
+#include <libp2p/common/types.hpp>
+#include <libp2p/crypto/key.hpp>
+#include <libp2p/outcome/outcome.hpp>
+
+namespace libp2p::crypto {
+
+  /**
+   * Bounded LRU cache of decoded public keys, keyed by key type and bytes.
+   * Lets providers skip parsing keys of peers which are verified again and
+   * again. Thread-safe, cached keys must be safe to verify with concurrently
+   */
+  class PublicKeyCache {
+   public:
+    struct Config {
+      /// Number of cached keys, 0 disables cache
+      size_t capacity = 4096;
+    };
+
+    PublicKeyCache();
+
+    explicit PublicKeyCache(Config config);
+
+    /**
+     * Returns decoded key from cache, or decodes and caches it
+     * @tparam T - decoded key type, one per key type
+     * @param parse - returns outcome::result<std::shared_ptr<T>>
+     */
+    template <typename T, typename Parse>
+    outcome::result<std::shared_ptr<T>> get(Key::Type type,
+                                            BytesIn key,
+                                            const Parse &parse) {
+      if (config_.capacity == 0) {
+        return parse();
+      }
+      auto cache_key = cacheKey(type, key);
+      if (auto found = find(cache_key)) {
+        return std::static_pointer_cast<T>(found);
+      }
+      OUTCOME_TRY(decoded, parse());
+      insert(std::move(cache_key), decoded);
+      return decoded;
+    }
+
+    /// Number of cached keys
+    size_t size() const;
+
+   private:
+    struct Entry {
+      Bytes key;
+      std::shared_ptr<void> decoded;
+    };
+    using Lru = std::list<Entry>;
+
+    static Bytes cacheKey(Key::Type type, BytesIn key);
+
+    std::shared_ptr<void> find(const Bytes &key);
+
+    void insert(Bytes key, std::shared_ptr<void> decoded);
+
+    const Config config_;
+    mutable std::mutex mutex_;
+
+    /// Most recently used first
+    Lru lru_;
+    std::unordered_map<Bytes, Lru::iterator> index_;
+  };
+
+}  // namespace libp2p::crypto
@@ -10,6 +10,7 @@
 
 #include <openssl/rsa.h>
 #include <libp2p/crypto/error.hpp>
+#include <libp2p/crypto/public_key_cache.hpp>
 #include <libp2p/crypto/rsa_provider.hpp>
 
 namespace libp2p::crypto::rsa {
@@ -19,6 +20,11 @@ namespace libp2p::crypto::rsa {
    */
   class RsaProviderImpl : public RsaProvider {
    public:
+    RsaProviderImpl() = default;
+
+    /// @param key_cache - cache of decoded public keys, shared by providers
+    explicit RsaProviderImpl(std::shared_ptr<PublicKeyCache> key_cache);
+
     outcome::result<KeyPair> generate(RSAKeyType rsa_bitness) const override;
 
     outcome::result<PublicKey> derive(
@@ -39,5 +45,10 @@ namespace libp2p::crypto::rsa {
      */
     static outcome::result<std::shared_ptr<X509_PUBKEY>> getPublicKeyFromBytes(
         const PublicKey &input_key);
+
+    /// Decodes RSA public key, or takes decoded one from cache
+    outcome::result<std::shared_ptr<RSA>> getRsa(const PublicKey &key) const;
+
+    std::shared_ptr<PublicKeyCache> key_cache_;
   };
 };  // namespace libp2p::crypto::rsa
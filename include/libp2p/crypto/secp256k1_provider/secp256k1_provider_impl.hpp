@@ -9,6 +9,7 @@
 #include <secp256k1.h>
 #include <memory>
 
+#include <libp2p/crypto/public_key_cache.hpp>
 #include <libp2p/crypto/secp256k1_provider.hpp>
 
 namespace libp2p::crypto::random {
@@ -20,6 +21,10 @@ namespace libp2p::crypto::secp256k1 {
    public:
     Secp256k1ProviderImpl(std::shared_ptr<random::CSPRNG> random);
 
+    /// @param key_cache - cache of decoded public keys, shared by providers
+    Secp256k1ProviderImpl(std::shared_ptr<random::CSPRNG> random,
+                          std::shared_ptr<PublicKeyCache> key_cache);
+
     outcome::result<KeyPair> generate() const override;
 
     outcome::result<PublicKey> derive(const PrivateKey &key) const override;
@@ -32,7 +37,12 @@ namespace libp2p::crypto::secp256k1 {
                                  const PublicKey &key) const override;
 
    private:
+    /// Parses public key, or takes parsed one from cache
+    outcome::result<std::shared_ptr<secp256k1_pubkey>> parsePublicKey(
+        const PublicKey &key) const;
+
     std::shared_ptr<random::CSPRNG> random_;
+    std::shared_ptr<PublicKeyCache> key_cache_;
     std::unique_ptr<secp256k1_context, void (*)(secp256k1_context *)> ctx_;
   };
 }  // namespace libp2p::crypto::secp256k1
@@ -93,6 +93,9 @@ namespace libp2p::host {
     std::unique_ptr<peer::PeerRepository> repo_;
     std::shared_ptr<event::Bus> bus_;
     std::shared_ptr<network::TransportManager> transport_manager_;
+
+    /// Feeds round trips measured by protocols into latency repository
+    event::Handle round_trip_sub_;
   };
 
 }  // namespace libp2p::host
@@ -11,6 +11,7 @@
 // implementations
 #include <libp2p/basic/scheduler/asio_scheduler_backend.hpp>
 #include <libp2p/basic/scheduler/scheduler_impl.hpp>
+#include <libp2p/basic/scheduler/timing_wheel_scheduler.hpp>
 #include <libp2p/crypto/aes_ctr/aes_ctr_impl.hpp>
 #include <libp2p/crypto/crypto_provider/crypto_provider_impl.hpp>
 #include <libp2p/crypto/ecdsa_provider/ecdsa_provider_impl.hpp>
@@ -18,6 +19,7 @@
 #include <libp2p/crypto/hmac_provider/hmac_provider_impl.hpp>
 #include <libp2p/crypto/key_marshaller/key_marshaller_impl.hpp>
 #include <libp2p/crypto/key_validator/key_validator_impl.hpp>
+#include <libp2p/crypto/public_key_cache.hpp>
 #include <libp2p/crypto/random_generator/boost_generator.hpp>
 #include <libp2p/crypto/rsa_provider/rsa_provider_impl.hpp>
 #include <libp2p/crypto/secp256k1_provider/secp256k1_provider_impl.hpp>
@@ -32,6 +34,7 @@
 #include <libp2p/network/impl/router_impl.hpp>
 #include <libp2p/network/impl/transport_manager_impl.hpp>
 #include <libp2p/peer/impl/identity_manager_impl.hpp>
+#include <libp2p/peer/latency_repository.hpp>
 #include <libp2p/protocol_muxer/multiselect.hpp>
 #include <libp2p/security/noise.hpp>
 #include <libp2p/security/plaintext.hpp>
@@ -171,6 +174,15 @@ namespace libp2p::injector {
         std::move(cert))[boost::di::override];
   }
 
+  /**
+   * @brief Instruct injector to use timing wheel scheduler instead of default
+   * one, for nodes with many connections and timers. Can be used once.
+   */
+  inline auto useTimingWheelScheduler() {
+    return boost::di::bind<basic::Scheduler>()
+        .template to<basic::TimingWheelScheduler>()[boost::di::override];
+  }
+
   /**
    * @brief Instruct injector to use specific config type. Can be used many
    * times for different types.
@@ -281,12 +293,16 @@ namespace libp2p::injector {
     namespace di = boost::di;
 
     auto csprng = std::make_shared<crypto::random::BoostRandomGenerator>();
+    auto key_cache = std::make_shared<crypto::PublicKeyCache>();
     auto ed25519_provider =
-        std::make_shared<crypto::ed25519::Ed25519ProviderImpl>();
-    auto rsa_provider = std::make_shared<crypto::rsa::RsaProviderImpl>();
-    auto ecdsa_provider = std::make_shared<crypto::ecdsa::EcdsaProviderImpl>();
+        std::make_shared<crypto::ed25519::Ed25519ProviderImpl>(key_cache);
+    auto rsa_provider =
+        std::make_shared<crypto::rsa::RsaProviderImpl>(key_cache);
+    auto ecdsa_provider =
+        std::make_shared<crypto::ecdsa::EcdsaProviderImpl>(key_cache);
     auto secp256k1_provider =
-        std::make_shared<crypto::secp256k1::Secp256k1ProviderImpl>(csprng);
+        std::make_shared<crypto::secp256k1::Secp256k1ProviderImpl>(csprng,
+                                                                   key_cache);
     auto hmac_provider = std::make_shared<crypto::hmac::HmacProviderImpl>();
     std::shared_ptr<crypto::CryptoProvider> crypto_provider =
         std::make_shared<crypto::CryptoProviderImpl>(csprng,
@@ -308,6 +324,7 @@ namespace libp2p::injector {
 
         di::bind<crypto::KeyPair>().template to(std::move(keypair)),
         di::bind<crypto::random::CSPRNG>().template to(std::move(csprng)),
+        di::bind<crypto::PublicKeyCache>().template to(std::move(key_cache)),
         di::bind<crypto::ed25519::Ed25519Provider>().template to(std::move(ed25519_provider)),
         di::bind<crypto::rsa::RsaProvider>().template to(std::move(rsa_provider)),
         di::bind<crypto::ecdsa::EcdsaProvider>().template to(std::move(ecdsa_provider)),
@@ -327,6 +344,8 @@ namespace libp2p::injector {
         di::bind<basic::Scheduler::Config>.template to(basic::Scheduler::Config{}),
         di::bind<basic::SchedulerBackend>().template to<basic::AsioSchedulerBackend>(),
         di::bind<basic::Scheduler>().template to<basic::SchedulerImpl>(),
+        di::bind<network::DialerConfig>.template to(network::DialerConfig{}),
+        di::bind<peer::LatencyRepository::Config>.template to(peer::LatencyRepository::Config{}),
 
         // internal
         di::bind<network::DnsaddrResolver>().template to <network::DnsaddrResolverImpl>(),
@@ -11,8 +11,9 @@
 
 /**
  * Encode/decode to/from base58 format
- * Implementation is taken from
- * https://github.com/bitcoin/bitcoin/blob/master/src/base58.h
+ * Implementation is based on
+ * https://github.com/bitcoin/bitcoin/blob/master/src/base58.h,
+ * but converts several digits per step with 64-bit arithmetic
  */
 namespace libp2p::multi::detail {
 
@@ -8,6 +8,7 @@
 
 #include <utility>
 
+#include <boost/container/small_vector.hpp>
 #include <libp2p/common/types.hpp>
 #include <libp2p/multi/hash_type.hpp>
 #include <libp2p/outcome/outcome.hpp>
@@ -27,10 +28,12 @@ namespace libp2p::multi {
     Multihash &operator=(Multihash &&other) = default;
     ~Multihash() = default;
 
-    using Buffer = Bytes;
-
     static constexpr uint8_t kMaxHashLength = 127;
 
+    /// Multihashes up to this size (identity hash of inlined public key,
+    /// SHA-256) are stored inline, without allocations
+    static constexpr size_t kInlineCapacity = 48;
+
     enum class Error {
       ZERO_INPUT_LENGTH = 1,
       INPUT_TOO_LONG,
@@ -85,7 +88,7 @@ namespace libp2p::multi {
     /**
      * @return a buffer with the multihash, including its type, length and hash
      */
-    const Buffer &toBuffer() const;
+    BytesIn toBuffer() const;
 
     /**
      * @return Pre-calculated hash for std containers
@@ -112,24 +115,11 @@ namespace libp2p::multi {
      */
     Multihash(HashType type, BytesIn hash);
 
-    /**
-     * Contains a one byte hash type, a one byte hash length, and the stored
-     * hash itself
-     */
-    struct Data {
-      // TODO(artem): move to small_vector<const uint8_t, some_size>
-      // as soon as toBuffer() -> span<const uint8_t> is acceptable
-      std::vector<uint8_t> bytes;
-      uint8_t hash_offset{};  ///< size of non-hash data from the beginning
-      HashType type;
-      size_t std_hash;  ///< Hash for unordered containers
-
-      Data(HashType t, BytesIn h);
-    };
-
-    const Data &data() const;
-
-    std::shared_ptr<const Data> data_;
+    /// Varint hash type, one byte hash length and the hash itself
+    boost::container::small_vector<uint8_t, kInlineCapacity> bytes_;
+    HashType type_;
+    size_t std_hash_;        ///< Hash for unordered containers
+    uint8_t hash_offset_{};  ///< size of non-hash data from the beginning
   };
 
 }  // namespace libp2p::multi
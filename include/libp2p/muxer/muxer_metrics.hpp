@@ -0,0 +1,58 @@
+/**
+ * Copyright Quadrivium LLC
+ * All Rights Reserved
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <libp2p/common/metrics/registry.hpp>
+
+namespace libp2p::muxer {
+
+  /// Data plane metrics of muxed connections, labelled by muxer name
+  struct MuxerMetrics {
+    explicit MuxerMetrics(const std::string &muxer)
+        : bytes_read{counter("libp2p_muxer_bytes_total",
+                             "Bytes transferred by muxed connections",
+                             muxer,
+                             "in")},
+          bytes_written{counter("libp2p_muxer_bytes_total",
+                                "Bytes transferred by muxed connections",
+                                muxer,
+                                "out")},
+          frames_read{counter("libp2p_muxer_frames_total",
+                              "Frames transferred by muxed connections",
+                              muxer,
+                              "in")},
+          frames_written{counter("libp2p_muxer_frames_total",
+                                 "Frames transferred by muxed connections",
+                                 muxer,
+                                 "out")},
+          streams_opened{metrics::Registry::get().counter(
+              "libp2p_muxer_streams_opened_total",
+              "Streams opened by muxed connections",
+              {{"muxer", muxer}})},
+          streams_reset{metrics::Registry::get().counter(
+              "libp2p_muxer_streams_reset_total",
+              "Streams reset by either side",
+              {{"muxer", muxer}})} {}
+
+    metrics::Counter &bytes_read;
+    metrics::Counter &bytes_written;
+    metrics::Counter &frames_read;
+    metrics::Counter &frames_written;
+    metrics::Counter &streams_opened;
+    metrics::Counter &streams_reset;
+
+   private:
+    static metrics::Counter &counter(std::string_view name,
+                                     std::string_view help,
+                                     const std::string &muxer,
+                                     const std::string &direction) {
+      return metrics::Registry::get().counter(
+          name, help, {{"muxer", muxer}, {"direction", direction}});
+    }
+  };
+
+}  // namespace libp2p::muxer
@@ -10,6 +10,7 @@
 #include <libp2p/muxer/muxed_connection_config.hpp>
 #include <libp2p/muxer/muxer_adaptor.hpp>
 #include <libp2p/network/connection_manager.hpp>
+#include <libp2p/peer/latency_repository.hpp>
 
 namespace libp2p::muxer {
   class Yamux : public MuxerAdaptor {
@@ -22,10 +23,12 @@ namespace libp2p::muxer {
      * @param scheduler scheduler
      * @param cmgr connection manager. May be nullptr in tests, otherwise
      * close_cb_ is created using it
+     * @param latency repository where ping round trips are recorded, optional
      */
     Yamux(MuxedConnectionConfig config,
           std::shared_ptr<basic::Scheduler> scheduler,
-          std::shared_ptr<network::ConnectionManager> cmgr);
+          std::shared_ptr<network::ConnectionManager> cmgr,
+          std::shared_ptr<peer::LatencyRepository> latency = nullptr);
 
     peer::ProtocolName getProtocolId() const override;
 
@@ -36,5 +39,6 @@ namespace libp2p::muxer {
     MuxedConnectionConfig config_;
     std::shared_ptr<basic::Scheduler> scheduler_;
     connection::CapableConnection::ConnectionClosedCallback close_cb_;
+    std::shared_ptr<peer::LatencyRepository> latency_;
   };
 }  // namespace libp2p::muxer
@@ -63,6 +63,11 @@ namespace libp2p::connection {
 
     void writeSome(BytesIn in, size_t bytes, WriteCallbackFunc cb) override;
 
+    /// Enqueues all the buffers without copying, callback is called once
+    /// with their total size
+    void writeSomeVectored(std::span<const BytesIn> in,
+                           WriteCallbackFunc cb) override;
+
     void deferWriteCallback(std::error_code ec, WriteCallbackFunc cb) override;
 
     bool isClosed() const override;
@@ -73,6 +78,8 @@ namespace libp2p::connection {
 
     bool isClosedForWrite() const override;
 
+    /// Only write callbacks are called after reset, with error, once
+    /// connection no longer refers to their data
     void reset() override;
 
     void adjustWindowSize(uint32_t new_size, VoidResultHandlerFunc cb) override;
@@ -111,10 +118,21 @@ namespace libp2p::connection {
     /// Connection closed by network error
     void closedByConnection(std::error_code ec);
 
+    /// True if the stream was reset by this side, so its data queued in
+    /// connection is not to be written
+    bool isReset() const;
+
    private:
-    /// Performs close-related cleanup and notifications
+    /// Performs close-related cleanup and notifications. Write callbacks are
+    /// deferred until data referred by connection is released
     void doClose(std::error_code ec, bool notify_read_side);
 
+    /// Acknowledges data which was being written when the stream was closed
+    void onClosedDataWritten(size_t bytes);
+
+    /// Calls write callbacks deferred by close
+    void releaseWriteCallbacks();
+
     /// Called by read*() functions
     void doRead(BytesOut out, size_t bytes, ReadCallbackFunc cb);
 
@@ -128,6 +146,9 @@ namespace libp2p::connection {
     /// Called by write*() functions
     void doWrite(BytesIn in, size_t bytes, WriteCallbackFunc cb);
 
+    /// Returns false and defers error to callback if bytes cannot be enqueued
+    bool canWrite(size_t bytes, WriteCallbackFunc &cb);
+
     /// Clears close callback state
     [[nodiscard]] std::pair<VoidResultHandlerFunc, outcome::result<void>>
     closeCompleted();
@@ -168,6 +189,13 @@ namespace libp2p::connection {
     /// Write queue with callbacks
     basic::WriteQueue write_queue_;
 
+    /// Bytes passed to connection before close and not yet written.
+    /// Connection refers to client's data until they are written
+    size_t unacknowledged_on_close_ = 0;
+
+    /// Write callbacks deferred until unacknowledged_on_close_ becomes 0
+    std::vector<WriteCallbackFunc> deferred_write_callbacks_;
+
     /// Internal read buffer, stores bytes received between read()s
     basic::ReadBuffer internal_read_buffer_;
 
@@ -6,6 +6,7 @@
 
 #pragma once
 
+#include <chrono>
 #include <unordered_map>
 
 #include <libp2p/basic/read_buffer.hpp>
@@ -15,6 +16,7 @@
 #include <libp2p/muxer/muxed_connection_config.hpp>
 #include <libp2p/muxer/yamux/yamux_reading_state.hpp>
 #include <libp2p/muxer/yamux/yamux_stream.hpp>
+#include <libp2p/peer/latency_repository.hpp>
 
 namespace libp2p::connection {
 
@@ -41,12 +43,14 @@ namespace libp2p::connection {
      * Create a new YamuxedConnection instance
      * @param connection to be multiplexed by this instance
      * @param config to configure this instance
-     * @param logger to output messages
+     * @param latency repository where ping round trips are recorded, optional
      */
-    explicit YamuxedConnection(std::shared_ptr<SecureConnection> connection,
-                               std::shared_ptr<basic::Scheduler> scheduler,
-                               ConnectionClosedCallback closed_callback,
-                               muxer::MuxedConnectionConfig config = {});
+    explicit YamuxedConnection(
+        std::shared_ptr<SecureConnection> connection,
+        std::shared_ptr<basic::Scheduler> scheduler,
+        ConnectionClosedCallback closed_callback,
+        muxer::MuxedConnectionConfig config = {},
+        std::shared_ptr<peer::LatencyRepository> latency = nullptr);
 
     void start() override;
 
@@ -87,12 +91,19 @@ namespace libp2p::connection {
     using Buffer = Bytes;
 
     struct WriteQueueItem {
-      // TODO(artem): reform in buffers (shared + vector writes)
-
+      /// Frame header or the whole frame if it has no payload
       Buffer packet;
-      StreamId stream_id;
+
+      /// DATA frame payload, refers to data in stream's write queue
+      BytesIn payload;
+
+      /// Stream to be acknowledged about payload written
+      std::shared_ptr<YamuxStream> stream;
     };
 
+    /// Max frames gathered into one vectored write
+    static constexpr size_t kMaxFramesPerWrite = 256;
+
     // YamuxStreamFeedback interface overrides
 
     /// Stream transfers data to connection
@@ -151,15 +162,26 @@ namespace libp2p::connection {
     void close(std::error_code notify_streams_code,
                boost::optional<YamuxFrame::GoAwayError> reply_to_peer_code);
 
-    /// Writes data to underlying connection or (if is_writing_) enqueues them
-    /// If stream_id != 0, stream will be acknowledged about data written
-    void enqueue(Buffer packet, StreamId stream_id = 0);
+    /// Enqueues control frame
+    void enqueue(Buffer packet);
+
+    /// Writes frame to underlying connection or (if is_writing_) enqueues it.
+    /// If item.stream is set, it will be acknowledged about payload written
+    void enqueue(WriteQueueItem item);
 
-    /// Performs write into connection
-    void doWrite(WriteQueueItem packet);
+    /// Drains write queue into one vectored write into connection
+    void doWrite();
 
     /// Write callback
-    void onDataWritten(outcome::result<size_t> res, StreamId stream_id);
+    void onDataWritten(outcome::result<void> res,
+                       std::vector<WriteQueueItem> &frames);
+
+    /// Releases streams' data referred by frames which will not be written
+    /// anymore. Streams closed before get their write callbacks called
+    static void releaseFrames(std::vector<WriteQueueItem> &frames);
+
+    /// Number of frames which refer to stream's data
+    size_t queuedFrames(const std::shared_ptr<YamuxStream> &stream) const;
 
     /// Creates new yamux stream
     std::shared_ptr<Stream> createStream(StreamId stream_id);
@@ -201,11 +223,12 @@ namespace libp2p::connection {
     /// True if waiting for current write operation to complete
     bool is_writing_ = false;
 
-    std::shared_ptr<Bytes> writing_buf_ = std::make_shared<Bytes>();
-
     /// Write queue
     std::deque<WriteQueueItem> write_queue_;
 
+    /// Frames of current write operation
+    std::shared_ptr<std::vector<WriteQueueItem>> writing_frames_;
+
     /// Active streams
     Streams streams_;
 
@@ -239,6 +262,12 @@ namespace libp2p::connection {
 
     uint32_t ping_counter_ = 0;
 
+    /// Round trips of pings are recorded there
+    std::shared_ptr<peer::LatencyRepository> latency_;
+
+    /// When the last ping was sent
+    std::chrono::steady_clock::time_point ping_sent_{};
+
    public:
     LIBP2P_METRICS_INSTANCE_COUNT_IF_ENABLED(
         libp2p::connection::YamuxedConnection);
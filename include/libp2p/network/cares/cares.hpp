@@ -8,14 +8,16 @@
 
 #include <atomic>
 #include <functional>
-#include <list>
+#include <map>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <vector>
 
 #include <ares.h>
 #include <boost/asio.hpp>
 #include <libp2p/log/logger.hpp>
+#include <libp2p/network/cares/dns_cache.hpp>
 #include <libp2p/outcome/outcome.hpp>
 
 namespace libp2p::network::c_ares {
@@ -25,6 +27,14 @@ namespace libp2p::network::c_ares {
    * Only one instance is allowed to exist.
    * Has to be initialized prior any threads spawn.
    * Designed for use only via Boost injector passing by a reference.
+   *
+   * Queries are processed by the io_context they were requested with: sockets
+   * of c-ares channel are watched by its reactor, no threads are spawned.
+   * The channel of io_context is kept while it has queries in flight, so
+   * sockets and server state are reused by overlapping queries. io_context
+   * must outlive its queries in flight.
+   * Identical queries in flight share a single DNS request, answers are
+   * cached according to their TTL.
    */
   class Ares final {
    public:
@@ -34,7 +44,6 @@ namespace libp2p::network::c_ares {
     enum class Error {
       NOT_INITIALIZED = 1,
       CHANNEL_INIT_FAILURE,
-      THREAD_FAILED,
       // the following are the codes returned to callback by ::ares_query
       E_NO_DATA,
       E_BAD_QUERY,
@@ -82,18 +91,8 @@ namespace libp2p::network::c_ares {
         TxtCallback callback);
 
    private:
-    struct RequestContext {
-      std::weak_ptr<boost::asio::io_context> io_context;
-      std::string uri;
-      TxtCallback callback;
-
-      RequestContext(std::weak_ptr<boost::asio::io_context> io_context_,
-                     std::string uri_,
-                     TxtCallback callback_)
-          : io_context{std::move(io_context_)},
-            uri{std::move(uri_)},
-            callback{std::move(callback_)} {}
-    };
+    /// c-ares channel driven by io_context
+    class Reactor;
 
     /// schedules to user's io_context the call of callback with specified error
     static void reportError(
@@ -101,16 +100,19 @@ namespace libp2p::network::c_ares {
         TxtCallback callback,
         Error error);
 
-    static void txtCallback(
-        void *arg, int status, int timeouts, unsigned char *abuf, int alen);
+    /// Returns reactor of io_context, creates it on first query
+    static std::shared_ptr<Reactor> reactor(
+        const std::shared_ptr<boost::asio::io_context> &io_context);
 
-    /// does ares sockets processing for the channel, to be in a separate thread
-    static void waitAresChannel(::ares_channel channel);
+    /// Forgets reactor which has no queries in flight
+    static void release(const std::shared_ptr<Reactor> &reactor);
 
-    static void removeRequest(RequestContext *request_ptr);
+    static DnsCache &cache();
 
     static std::atomic_bool initialized_;
-    static std::list<std::shared_ptr<RequestContext>> requests_;
+    static std::mutex reactors_mutex_;
+    static std::map<const boost::asio::io_context *, std::shared_ptr<Reactor>>
+        reactors_;
 
     /// Returns "ares" logger
     static log::Logger log();
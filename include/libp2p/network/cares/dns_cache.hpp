@@ -0,0 +1,74 @@
+/**
+ * Copyright Quadrivium LLC
+ * All Rights Reserved
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <chrono>
+#include <list>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <libp2p/outcome/outcome.hpp>
+
+namespace libp2p::network::c_ares {
+
+  /**
+   * Bounded LRU cache of DNS TXT answers.
+   * Positive answers live for their record TTL clamped to [min_ttl, max_ttl],
+   * negative ones (no such name, no data) for negative_ttl.
+   * Time is passed by caller, so that cache does not depend on clock.
+   */
+  class DnsCache {
+   public:
+    using Clock = std::chrono::steady_clock;
+    using Result = outcome::result<std::vector<std::string>>;
+
+    struct Config {
+      size_t capacity = 1024;
+      std::chrono::seconds min_ttl{5};
+      std::chrono::seconds max_ttl{std::chrono::hours{1}};
+      std::chrono::seconds negative_ttl{60};
+    };
+
+    explicit DnsCache(Config config);
+
+    /// Returns cached answer if it has not expired yet
+    std::optional<Result> get(const std::string &name, Clock::time_point now);
+
+    /// Caches answer with given TTL
+    void put(const std::string &name,
+             std::vector<std::string> values,
+             std::chrono::seconds ttl,
+             Clock::time_point now);
+
+    /// Caches negative answer
+    void putNegative(const std::string &name,
+                     std::error_code error,
+                     Clock::time_point now);
+
+    size_t size() const;
+
+   private:
+    struct Entry {
+      std::string name;
+      Result result;
+      Clock::time_point expires;
+    };
+    using Lru = std::list<Entry>;
+
+    void insert(Entry entry);
+
+    Config config_;
+    mutable std::mutex mutex_;
+    /// Most recently used first
+    Lru lru_;
+    std::unordered_map<std::string, Lru::iterator> index_;
+  };
+
+}  // namespace libp2p::network::c_ares
@@ -0,0 +1,26 @@
+/**
+ * Copyright Quadrivium LLC
+ * All Rights Reserved
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+
+namespace libp2p::network {
+  /**
+   * Config of dialer, attempts to peer's addresses are started one after
+   * another with a stagger delay without waiting for previous ones to fail
+   * (Happy Eyeballs, RFC 8305)
+   */
+  struct DialerConfig {
+    /// Delay before the next address is tried while previous attempts are
+    /// still in progress
+    std::chrono::milliseconds stagger_delay{250};
+
+    /// Max number of concurrent attempts to one peer
+    size_t max_parallel_attempts = 4;
+  };
+}  // namespace libp2p::network
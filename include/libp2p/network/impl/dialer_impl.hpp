@@ -12,6 +12,7 @@
 #include <libp2p/basic/scheduler.hpp>
 #include <libp2p/network/connection_manager.hpp>
 #include <libp2p/network/dialer.hpp>
+#include <libp2p/network/dialer_config.hpp>
 #include <libp2p/network/listener_manager.hpp>
 #include <libp2p/network/transport_manager.hpp>
 #include <libp2p/protocol_muxer/protocol_muxer.hpp>
@@ -27,7 +28,8 @@ namespace libp2p::network {
                std::shared_ptr<TransportManager> tmgr,
                std::shared_ptr<ConnectionManager> cmgr,
                std::shared_ptr<ListenerManager> listener,
-               std::shared_ptr<basic::Scheduler> scheduler);
+               std::shared_ptr<basic::Scheduler> scheduler,
+               DialerConfig config);
 
     // Establishes a connection to a given peer
     void dial(const peer::PeerInfo &p,
@@ -69,10 +71,39 @@ namespace libp2p::network {
       // indicates that at least one attempt to dial was happened
       // (at least one supported network transport was found and used)
       bool dialled = false;
+
+      /// When dialing to the peer was requested, for latency metrics
+      std::chrono::steady_clock::time_point started =
+          std::chrono::steady_clock::now();
+
+      /// Distinguishes this dial from later dials to the same peer, results
+      /// of attempts which lost the race must not leak into them
+      uint64_t id = 0;
+
+      /// Attempts started and not finished yet
+      size_t in_flight = 0;
+
+      /// Timer to start the next attempt while others are in flight
+      basic::Scheduler::Handle stagger;
+
+      /// Address class of the last attempt, to alternate address families
+      std::string last_class;
     };
 
-    // Perform a single attempt to dial to the peer via the next known address
-    void rotate(const peer::PeerId &peer_id);
+    // Start an attempt to dial to the peer via the next best address, and arm
+    // stagger timer for the one after it
+    void rotate(const peer::PeerId &peer_id, uint64_t dial_id);
+
+    void scheduleRotate(const peer::PeerId &peer_id, uint64_t dial_id);
+
+    void armStagger(const peer::PeerId &peer_id, DialCtx &ctx);
+
+    // Pick the best address to try next, preferring address classes which
+    // succeeded before and alternating between them
+    std::set<multi::Multiaddress>::iterator nextAddress(DialCtx &ctx) const;
+
+    // Update success score of address class (like "ip6/tcp")
+    void updateScore(const std::string &address_class, bool success);
 
     // Finalize dialing to the peer and propagate a given result to all
     // connection requesters
@@ -87,10 +118,15 @@ namespace libp2p::network {
     std::shared_ptr<ConnectionManager> cmgr_;
     std::shared_ptr<ListenerManager> listener_;
     std::shared_ptr<basic::Scheduler> scheduler_;
+    DialerConfig config_;
     log::Logger log_;
 
     // peers we are currently dialing to
     std::unordered_map<peer::PeerId, DialCtx> dialing_peers_;
+    uint64_t last_dial_id_ = 0;
+
+    // address class -> score, positive if dials succeed
+    std::unordered_map<std::string, int> scores_;
   };
 
 }  // namespace libp2p::network
@@ -0,0 +1,86 @@
+/**
+ * Copyright Quadrivium LLC
+ * All Rights Reserved
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <libp2p/peer/address_repository/inmem_address_repository.hpp>
+
+#include <libp2p/storage/sqlite_write_queue.hpp>
+
+namespace libp2p::peer {
+
+  /**
+   * @brief Address repository persisted in SQLite database.
+   * Peers are loaded into memory on first access, changes are written
+   * through the write queue. Expiration time (wall clock) is kept in indexed
+   * column, so that expired addresses are deleted without scanning.
+   * Garbage collection also deletes keys and protocols stored in the same
+   * database for peers left without addresses
+   */
+  class SqliteAddressRepository : public InmemAddressRepository {
+   public:
+    SqliteAddressRepository(
+        std::shared_ptr<network::DnsaddrResolver> dnsaddr_resolver,
+        std::shared_ptr<storage::SQLiteWriteQueue> queue);
+
+    outcome::result<bool> addAddresses(const PeerId &p,
+                                       std::span<const multi::Multiaddress> ma,
+                                       Milliseconds ttl) override;
+
+    outcome::result<bool> upsertAddresses(
+        const PeerId &p,
+        std::span<const multi::Multiaddress> ma,
+        Milliseconds ttl) override;
+
+    outcome::result<void> updateAddresses(const PeerId &p,
+                                          Milliseconds ttl) override;
+
+    outcome::result<std::vector<multi::Multiaddress>> getAddresses(
+        const PeerId &p) const override;
+
+    void collectGarbage() override;
+
+    void clear(const PeerId &p) override;
+
+    std::unordered_set<PeerId> getPeers() const override;
+
+   private:
+    /// Loads stored addresses of peer, unless loaded already
+    void load(const PeerId &p) const;
+
+    /// Loads all stored peers
+    void loadAll() const;
+
+    /// Puts stored address into memory
+    void restore(const PeerId &p, const Bytes &address, int64_t expires);
+
+    void store(storage::SQLite::StatementHandle statement,
+               const PeerId &p,
+               std::span<const multi::Multiaddress> ma,
+               Milliseconds ttl);
+
+    /// Prepares deletion of peers without addresses from tables of other
+    /// repositories, once they are created
+    void preparePrune();
+
+    std::shared_ptr<storage::SQLiteWriteQueue> queue_;
+
+    storage::SQLite::StatementHandle insert_;
+    storage::SQLite::StatementHandle upsert_;
+    storage::SQLite::StatementHandle update_;
+    storage::SQLite::StatementHandle delete_;
+    storage::SQLite::StatementHandle delete_expired_;
+    storage::SQLite::StatementHandle select_;
+    storage::SQLite::StatementHandle select_all_;
+
+    /// Deletions of peers without addresses by table name
+    std::unordered_map<std::string, storage::SQLite::StatementHandle> prune_;
+
+    mutable std::unordered_set<PeerId> loaded_;
+    mutable bool all_loaded_ = false;
+  };
+
+}  // namespace libp2p::peer
@@ -14,7 +14,8 @@ namespace libp2p::peer {
    public:
     PeerRepositoryImpl(std::shared_ptr<AddressRepository> addrRepo,
                        std::shared_ptr<KeyRepository> keyRepo,
-                       std::shared_ptr<ProtocolRepository> protocolRepo);
+                       std::shared_ptr<ProtocolRepository> protocolRepo,
+                       std::shared_ptr<LatencyRepository> latencyRepo);
 
     AddressRepository &getAddressRepository() override;
 
@@ -22,6 +23,8 @@ namespace libp2p::peer {
 
     ProtocolRepository &getProtocolRepository() override;
 
+    LatencyRepository &getLatencyRepository() override;
+
     std::unordered_set<PeerId> getPeers() const override;
 
     PeerInfo getPeerInfo(const PeerId &peer_id) const override;
@@ -30,6 +33,7 @@ namespace libp2p::peer {
     std::shared_ptr<AddressRepository> addr_;
     std::shared_ptr<KeyRepository> key_;
     std::shared_ptr<ProtocolRepository> proto_;
+    std::shared_ptr<LatencyRepository> latency_;
   };
 
 }  // namespace libp2p::peer
@@ -0,0 +1,52 @@
+/**
+ * Copyright Quadrivium LLC
+ * All Rights Reserved
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <libp2p/peer/key_repository/inmem_key_repository.hpp>
+
+#include <libp2p/storage/sqlite_write_queue.hpp>
+
+namespace libp2p::peer {
+
+  /**
+   * @brief Key repository with public keys of peers persisted in SQLite
+   * database. Peers are loaded into memory on first access, changes are
+   * written through the write queue. Own key pairs are kept in memory only
+   */
+  class SqliteKeyRepository : public InmemKeyRepository {
+   public:
+    explicit SqliteKeyRepository(
+        std::shared_ptr<storage::SQLiteWriteQueue> queue);
+
+    void clear(const PeerId &p) override;
+
+    outcome::result<PubVecPtr> getPublicKeys(const PeerId &p) override;
+
+    outcome::result<void> addPublicKey(const PeerId &p,
+                                       const crypto::PublicKey &pub) override;
+
+    std::unordered_set<PeerId> getPeers() const override;
+
+   private:
+    /// Loads stored keys of peer, unless loaded already
+    void load(const PeerId &p) const;
+
+    /// Loads all stored peers
+    void loadAll() const;
+
+    std::shared_ptr<storage::SQLiteWriteQueue> queue_;
+
+    storage::SQLite::StatementHandle insert_;
+    storage::SQLite::StatementHandle delete_;
+    storage::SQLite::StatementHandle select_;
+    storage::SQLite::StatementHandle select_all_;
+
+    mutable std::unordered_set<PeerId> loaded_;
+    mutable bool all_loaded_ = false;
+  };
+
+}  // namespace libp2p::peer
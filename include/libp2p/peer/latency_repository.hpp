@@ -0,0 +1,136 @@
+/**
+ * Copyright Quadrivium LLC
+ * All Rights Reserved
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <chrono>
+#include <mutex>
+#include <optional>
+#include <random>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <libp2p/event/bus.hpp>
+#include <libp2p/peer/peer_id.hpp>
+
+namespace libp2p::event::protocol {
+
+  /// Emitted when round trip to peer is measured by a protocol
+  using RoundTripMeasuredChannel =
+      channel_decl<struct RoundTripMeasured,
+                   std::pair<libp2p::peer::PeerId, std::chrono::microseconds>>;
+
+}  // namespace libp2p::event::protocol
+
+namespace libp2p::peer {
+
+  /**
+   * Per-peer round trip estimates, fed by ping, muxer pings and
+   * request-response timings. Protocols use it to prefer responsive
+   * peers, while keeping peer selection randomized
+   */
+  class LatencyRepository {
+   public:
+    using Duration = std::chrono::microseconds;
+
+    struct Config {
+      /// Round trip assumed for peers without samples
+      Duration default_rtt = std::chrono::milliseconds(200);
+
+      /// Max number of peers tracked, least recently updated are evicted
+      size_t capacity = 4096;
+    };
+
+    struct Estimate {
+      /// Smoothed round trip time
+      Duration rtt{};
+
+      /// Round trip time variation
+      Duration rtt_var{};
+
+      /// Number of round trip samples
+      size_t samples = 0;
+    };
+
+    /// Which peers are more likely to be selected
+    enum class Prefer {
+      LOW_LATENCY,
+      HIGH_LATENCY,
+    };
+
+    LatencyRepository();
+
+    explicit LatencyRepository(Config config);
+
+    /// Adds round trip sample
+    void addRoundTrip(const PeerId &peer_id, Duration rtt);
+
+    /// Returns estimate if the peer has samples
+    std::optional<Estimate> getEstimate(const PeerId &peer_id) const;
+
+    /// Expected response time, i.e. rtt + 4 * rtt_var, or default rtt for
+    /// unknown peers
+    Duration score(const PeerId &peer_id) const;
+
+    /// Forgets the peer
+    void remove(const PeerId &peer_id);
+
+    /// Number of peers tracked
+    size_t size() const;
+
+    /**
+     * Selects up to n items at random without replacement. Chance of item
+     * is inversely (or directly for Prefer::HIGH_LATENCY) proportional to
+     * its peer's score, so slow peers are still selected sometimes
+     * @param items candidates
+     * @param n number of items to select
+     * @param get_peer_id returns peer id of item
+     * @param prefer which peers are more likely to be selected
+     */
+    template <typename T, typename GetPeerId>
+    std::vector<T> select(std::vector<T> items,
+                          size_t n,
+                          const GetPeerId &get_peer_id,
+                          Prefer prefer = Prefer::LOW_LATENCY) const {
+      if (items.size() <= n) {
+        return items;
+      }
+      std::vector<Duration> scores;
+      scores.reserve(items.size());
+      for (const auto &item : items) {
+        scores.push_back(score(get_peer_id(item)));
+      }
+      std::vector<T> selected;
+      selected.reserve(n);
+      for (auto i : sample(scores, n, prefer)) {
+        selected.push_back(std::move(items[i]));
+      }
+      return selected;
+    }
+
+   private:
+    struct Entry {
+      Estimate estimate;
+      uint64_t updated = 0;
+    };
+
+    /// Weighted random sampling of n indices without replacement
+    std::vector<size_t> sample(const std::vector<Duration> &scores,
+                               size_t n,
+                               Prefer prefer) const;
+
+    /// Returns entry of the peer, evicts old entries if needed
+    Entry &entry(const PeerId &peer_id);
+
+    const Config config_;
+    mutable std::mutex mutex_;
+    std::unordered_map<PeerId, Entry> entries_;
+    uint64_t updates_ = 0;
+    mutable std::mt19937_64 random_;
+  };
+
+}  // namespace libp2p::peer
@@ -58,10 +58,11 @@ namespace libp2p::peer {
     static FactoryResult fromHash(const multi::Multihash &hash);
 
     /**
-     * Get a base58 (not Multibase58!) representation of this PeerId
+     * Get a base58 (not Multibase58!) representation of this PeerId.
+     * It is encoded once, when PeerId is created
      * @return base58-encoded SHA256 multihash of the peer's ID
      */
-    std::string toBase58() const;
+    const std::string &toBase58() const;
 
     /**
      * @brief Get a hex representation of this PeerId.
@@ -69,9 +70,15 @@ namespace libp2p::peer {
     std::string toHex() const;
 
     /**
-     * Creates a vector representation of PeerId.
+     * Get bytes of PeerId (serialized multihash)
      */
-    const std::vector<uint8_t> &toVector() const;
+    BytesIn toVector() const;
+
+    /**
+     * Get copy of bytes of PeerId (serialized multihash), e.g. to be stored
+     * after this PeerId is gone
+     */
+    Bytes toBytes() const;
 
     /**
      * Get a SHA256 multihash of the peer's ID
@@ -95,6 +102,7 @@ namespace libp2p::peer {
     explicit PeerId(multi::Multihash hash);
 
     multi::Multihash hash_;
+    std::string base58_;
   };
 
 }  // namespace libp2p::peer
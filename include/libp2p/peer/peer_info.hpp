@@ -6,6 +6,7 @@
 
 #pragma once
 
+#include <algorithm>
 #include <vector>
 
 #include <libp2p/log/logger.hpp>
@@ -33,7 +34,8 @@ namespace libp2p::peer {
 
     struct CompareByPeerId {
       bool operator()(const PeerInfo &lhs, const PeerInfo &rhs) const {
-        return lhs.id.toVector() < rhs.id.toVector();
+        return std::ranges::lexicographical_compare(lhs.id.toVector(),
+                                                    rhs.id.toVector());
       }
     };
   };
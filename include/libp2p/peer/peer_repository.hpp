@@ -10,6 +10,7 @@
 
 #include <libp2p/peer/address_repository.hpp>
 #include <libp2p/peer/key_repository.hpp>
+#include <libp2p/peer/latency_repository.hpp>
 #include <libp2p/peer/peer_id.hpp>
 #include <libp2p/peer/peer_info.hpp>
 #include <libp2p/peer/protocol_repository.hpp>
@@ -40,6 +41,12 @@ namespace libp2p::peer {
      */
     virtual ProtocolRepository &getProtocolRepository() = 0;
 
+    /**
+     * @brief Getter for a latency repository.
+     * @return associated instance of a latency repository.
+     */
+    virtual LatencyRepository &getLatencyRepository() = 0;
+
     /**
      * @brief Returns set of peer ids known by this peer repository.
      * @return unordered set of peers
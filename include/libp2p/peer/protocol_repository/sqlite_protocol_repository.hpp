@@ -0,0 +1,67 @@
+/**
+ * Copyright Quadrivium LLC
+ * All Rights Reserved
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <libp2p/peer/protocol_repository/inmem_protocol_repository.hpp>
+
+#include <libp2p/storage/sqlite_write_queue.hpp>
+
+namespace libp2p::peer {
+
+  /**
+   * @brief Protocol repository persisted in SQLite database.
+   * Peers are loaded into memory on first access, changes are written
+   * through the write queue
+   */
+  class SqliteProtocolRepository : public InmemProtocolRepository {
+   public:
+    explicit SqliteProtocolRepository(
+        std::shared_ptr<storage::SQLiteWriteQueue> queue);
+
+    outcome::result<void> addProtocols(
+        const PeerId &p, std::span<const ProtocolName> ms) override;
+
+    outcome::result<void> removeProtocols(
+        const PeerId &p, std::span<const ProtocolName> ms) override;
+
+    outcome::result<std::vector<ProtocolName>> getProtocols(
+        const PeerId &p) const override;
+
+    outcome::result<std::vector<ProtocolName>> supportsProtocols(
+        const PeerId &p,
+        const std::set<ProtocolName> &protocols) const override;
+
+    void clear(const PeerId &p) override;
+
+    void collectGarbage() override;
+
+    std::unordered_set<PeerId> getPeers() const override;
+
+   private:
+    /// Loads stored protocols of peer, unless loaded already
+    void load(const PeerId &p) const;
+
+    /// Loads all stored peers
+    void loadAll() const;
+
+    void store(storage::SQLite::StatementHandle statement,
+               const PeerId &p,
+               std::span<const ProtocolName> ms);
+
+    std::shared_ptr<storage::SQLiteWriteQueue> queue_;
+
+    storage::SQLite::StatementHandle insert_;
+    storage::SQLite::StatementHandle remove_;
+    storage::SQLite::StatementHandle delete_;
+    storage::SQLite::StatementHandle select_;
+    storage::SQLite::StatementHandle select_all_;
+
+    mutable std::unordered_set<PeerId> loaded_;
+    mutable bool all_loaded_ = false;
+  };
+
+}  // namespace libp2p::peer
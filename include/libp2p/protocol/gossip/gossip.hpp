@@ -39,6 +39,16 @@ namespace libp2p::protocol::gossip {
 
   /// Gossip pub-sub protocol config
   struct Config {
+    /// What to do when peer's outbound queue exceeds its budget
+    enum class OverflowPolicy {
+      /// Drop the oldest queued forwarded messages, they are stale anyway
+      DROP_OLDEST,
+      /// Drop forwarded messages which don't fit
+      DROP_NEWEST,
+      /// Disconnect from the slow peer
+      DISCONNECT,
+    };
+
     /// Network density factors for gossip meshes
     size_t D_min = 5;
     size_t D_max = 10;
@@ -68,12 +78,24 @@ namespace libp2p::protocol::gossip {
     std::chrono::milliseconds seen_cache_lifetime_msec{
         message_cache_lifetime_msec * 3 / 4};
 
-    /// Topic's seen cache limit
+    /// Max number of recent messages announced to new subscribers
     unsigned seen_cache_limit = 100;
 
+    /// Number of recent heartbeat windows of message cache, whose messages
+    /// are announced to new subscribers
+    size_t history_gossip = 3;
+
+    /// Max number of message ids remembered to drop duplicates, shared by
+    /// all topics
+    size_t seen_cache_capacity = 1 << 18;
+
     /// Heartbeat interval
     std::chrono::milliseconds heartbeat_interval_msec{1000};
 
+    /// Max time spent on topic maintenance per heartbeat, the rest is done
+    /// in the following IO loop cycles. Zero means no limit
+    std::chrono::microseconds heartbeat_budget_usec{1000};
+
     /// Ban interval between dial attempts to peer
     std::chrono::milliseconds ban_interval_msec{std::chrono::minutes(1)};
 
@@ -86,11 +108,47 @@ namespace libp2p::protocol::gossip {
     /// Max RPC message size
     size_t max_message_size = 1 << 24;
 
+    /// Max bytes queued for one peer while previous write is in progress
+    size_t max_pending_bytes = 1 << 24;
+
+    /// Overflow policy of per-peer outbound queues. Control messages are
+    /// never dropped, they are sent ahead of forwarded messages and evict
+    /// them if queue is full. Peer which cannot take control messages within
+    /// max_pending_bytes is disconnected whatever the policy is
+    OverflowPolicy overflow_policy = OverflowPolicy::DROP_OLDEST;
+
     /// Protocol version
     std::string protocol_version = "/meshsub/1.0.0";
 
+    /// Protocol version supporting IDONTWANT, preferred to protocol_version.
+    /// IDONTWANT is sent only to peers which negotiated it
+    std::string idontwant_protocol_version = "/meshsub/1.2.0";
+
     /// Sign published messages
     bool sign_messages = false;
+
+    /// Received messages of at least this size are announced to mesh peers
+    /// with IDONTWANT, so that they don't send their copies. 0 disables
+    size_t idontwant_message_size = 1024;
+
+    /// Max number of message ids remembered from one peer's IDONTWANT
+    size_t idontwant_limit = 1024;
+
+    /// How long peer's IDONTWANT is honored
+    std::chrono::milliseconds idontwant_lifetime_msec{std::chrono::seconds(3)};
+
+    /// Verify signatures of received messages, unsigned and forged ones are
+    /// dropped
+    bool verify_signatures = false;
+
+    /// Worker threads verifying signatures off the IO thread
+    size_t verify_threads = 1;
+
+    /// Max messages verified by one worker task
+    size_t verify_batch_size = 64;
+
+    /// Number of signature verdicts remembered by message id
+    size_t verify_cache_size = 4096;
   };
 
   using TopicId = std::string;
@@ -74,6 +74,50 @@ namespace libp2p::protocol::kademlia {
      */
     size_t requestConcurency = 3;
 
+    /**
+     * Maximum number of concurrent requests of lookup (per path), including
+     * slow ones. Slow requests don't count towards requestConcurency, so
+     * lookup parallelism grows up to this bound while peers are unresponsive
+     * @note Default: 10
+     */
+    size_t maxRequestConcurency = 10;
+
+    /**
+     * Percentile of recent response times after which outstanding request
+     * is considered slow and another request is started instead of waiting
+     * for responseTimeout. 0 disables
+     * @note Default: 0.9
+     */
+    double slowRequestPercentile = 0.9;
+
+    /**
+     * Minimal time after which outstanding request may be considered slow
+     * @note Default: 100ms
+     */
+    std::chrono::milliseconds minSlowRequestTime = 100ms;
+
+    /**
+     * Number of disjoint paths of lookups (S/Kademlia). Each peer is queried
+     * by one path only, requestConcurency applies per path. 0 or 1 disables
+     * @note Default: 0
+     */
+    size_t disjointPaths = 0;
+
+    /**
+     * Number of disjoint paths which have to find the result before lookup
+     * returns. 0 means majority of paths
+     * @note Default: 0
+     */
+    size_t disjointPathsQuorum = 0;
+
+    /**
+     * Number of closest queued peers among which a free request slot picks
+     * one at random, lower latency peers being more likely. 1 means the
+     * closest peer is always picked
+     * @note Default: 3
+     */
+    size_t latencySelectionWindow = 3;
+
     /**
      * Target amount of closer peers.
      * @note Default: 6
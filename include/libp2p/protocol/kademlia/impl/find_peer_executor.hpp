@@ -9,8 +9,7 @@
 #include <libp2p/protocol/kademlia/impl/response_handler.hpp>
 
 #include <memory>
-#include <queue>
-#include <unordered_set>
+#include <optional>
 
 #include <libp2p/basic/scheduler.hpp>
 #include <libp2p/common/types.hpp>
@@ -18,8 +17,9 @@
 #include <libp2p/log/sublogger.hpp>
 #include <libp2p/protocol/kademlia/common.hpp>
 #include <libp2p/protocol/kademlia/config.hpp>
-#include <libp2p/protocol/kademlia/impl/peer_id_with_distance.hpp>
+#include <libp2p/protocol/kademlia/impl/lookup_paths.hpp>
 #include <libp2p/protocol/kademlia/impl/peer_routing_table.hpp>
+#include <libp2p/protocol/kademlia/impl/query_metrics.hpp>
 #include <libp2p/protocol/kademlia/impl/session.hpp>
 #include <libp2p/protocol/kademlia/impl/session_host.hpp>
 #include <libp2p/protocol/kademlia/peer_routing.hpp>
@@ -37,6 +37,7 @@ namespace libp2p::protocol::kademlia {
         std::shared_ptr<SessionHost> session_host,
         std::shared_ptr<PeerRouting> peer_routing,
         const std::shared_ptr<PeerRoutingTable> &peer_routing_table,
+        std::shared_ptr<ResponseTimes> response_times,
         PeerId peer_id,
         FoundPeerInfoHandler handler);
 
@@ -61,7 +62,11 @@ namespace libp2p::protocol::kademlia {
     void spawn();
 
     /// Handles result of connection
-    void onConnected(StreamAndProtocolOrError stream_res);
+    void onConnected(const PeerId &peer_id,
+                     StreamAndProtocolOrError stream_res);
+
+    /// Lets another request start while slow one is still in progress
+    void onSlowRequest(const PeerId &peer_id);
 
     static std::atomic_size_t instance_number;
 
@@ -75,14 +80,14 @@ namespace libp2p::protocol::kademlia {
     // Secondary
     const PeerId sought_peer_id_;
     const NodeId target_;
-    std::unordered_set<PeerId> nearest_peer_ids_;
+    LookupPaths paths_;
     FoundPeerInfoHandler handler_;
 
     // Auxiliary
     std::shared_ptr<std::vector<uint8_t>> serialized_request_;
-    std::priority_queue<PeerIdWithDistance> queue_;
-    size_t requests_in_progress_ = 0;
+    std::optional<PeerInfo> found_;
     bool started_ = false;
+    boost::optional<metrics::Timer> timer_;
     std::atomic_bool done_ = false;
 
     log::SubLogger log_;
@@ -9,7 +9,6 @@
 #include <libp2p/protocol/kademlia/impl/response_handler.hpp>
 
 #include <memory>
-#include <queue>
 #include <unordered_set>
 
 #include <libp2p/common/types.hpp>
@@ -17,8 +16,9 @@
 #include <libp2p/log/sublogger.hpp>
 #include <libp2p/protocol/kademlia/common.hpp>
 #include <libp2p/protocol/kademlia/config.hpp>
-#include <libp2p/protocol/kademlia/impl/peer_id_with_distance.hpp>
+#include <libp2p/protocol/kademlia/impl/lookup_paths.hpp>
 #include <libp2p/protocol/kademlia/impl/peer_routing_table.hpp>
+#include <libp2p/protocol/kademlia/impl/query_metrics.hpp>
 #include <libp2p/protocol/kademlia/impl/session.hpp>
 #include <libp2p/protocol/kademlia/impl/session_host.hpp>
 #include <libp2p/protocol/kademlia/peer_routing.hpp>
@@ -35,6 +35,7 @@ namespace libp2p::protocol::kademlia {
         std::shared_ptr<basic::Scheduler> scheduler,
         std::shared_ptr<SessionHost> session_host,
         const std::shared_ptr<PeerRoutingTable> &peer_routing_table,
+        std::shared_ptr<ResponseTimes> response_times,
         ContentId key,
         FoundProvidersHandler handler);
 
@@ -59,7 +60,11 @@ namespace libp2p::protocol::kademlia {
     void spawn();
 
     /// Handles result of connection
-    void onConnected(StreamAndProtocolOrError stream_res);
+    void onConnected(const PeerId &peer_id,
+                     StreamAndProtocolOrError stream_res);
+
+    /// Lets another request start while slow one is still in progress
+    void onSlowRequest(const PeerId &peer_id);
 
     static std::atomic_size_t instance_number;
 
@@ -73,13 +78,12 @@ namespace libp2p::protocol::kademlia {
 
     // Secondary
     const NodeId target_;
-    std::unordered_set<PeerId> nearest_peer_ids_;
+    LookupPaths paths_;
 
     // Auxiliary
     std::shared_ptr<std::vector<uint8_t>> serialized_request_;
-    std::priority_queue<PeerIdWithDistance> queue_;
-    size_t requests_in_progress_ = 0;
     bool started_ = false;
+    boost::optional<metrics::Timer> timer_;
     std::atomic_bool done_ = false;
 
     std::unordered_set<PeerId> providers_;
@@ -12,7 +12,6 @@
 #include <boost/multi_index/member.hpp>
 #include <boost/multi_index_container_fwd.hpp>
 #include <memory>
-#include <queue>
 #include <unordered_set>
 
 #include <libp2p/common/types.hpp>
@@ -22,8 +21,9 @@
 #include <libp2p/protocol/kademlia/config.hpp>
 #include <libp2p/protocol/kademlia/impl/content_routing_table.hpp>
 #include <libp2p/protocol/kademlia/impl/executors_factory.hpp>
-#include <libp2p/protocol/kademlia/impl/peer_id_with_distance.hpp>
+#include <libp2p/protocol/kademlia/impl/lookup_paths.hpp>
 #include <libp2p/protocol/kademlia/impl/peer_routing_table.hpp>
+#include <libp2p/protocol/kademlia/impl/query_metrics.hpp>
 #include <libp2p/protocol/kademlia/impl/session.hpp>
 #include <libp2p/protocol/kademlia/impl/session_host.hpp>
 #include <libp2p/protocol/kademlia/peer_routing.hpp>
@@ -43,6 +43,7 @@ namespace libp2p::protocol::kademlia {
         std::shared_ptr<PeerRouting> peer_routing,
         std::shared_ptr<ContentRoutingTable> content_routing_table,
         const std::shared_ptr<PeerRoutingTable> &peer_routing_table,
+        std::shared_ptr<ResponseTimes> response_times,
         std::shared_ptr<ExecutorsFactory> executor_factory,
         std::shared_ptr<Validator> validator,
         ContentId key,
@@ -67,7 +68,11 @@ namespace libp2p::protocol::kademlia {
     void spawn();
 
     /// Handles result of connection
-    void onConnected(StreamAndProtocolOrError stream_res);
+    void onConnected(const PeerId &peer_id,
+                     StreamAndProtocolOrError stream_res);
+
+    /// Lets another request start while slow one is still in progress
+    void onSlowRequest(const PeerId &peer_id);
 
     static std::atomic_size_t instance_number;
 
@@ -85,12 +90,10 @@ namespace libp2p::protocol::kademlia {
 
     // Secondary
     const NodeId target_;
-    std::unordered_set<PeerId> nearest_peer_ids_;
+    LookupPaths paths_;
 
     // Auxiliary
     std::shared_ptr<std::vector<uint8_t>> serialized_request_;
-    std::priority_queue<PeerIdWithDistance> queue_;
-    size_t requests_in_progress_ = 0;
 
     struct ByPeerId;
     struct ByValue;
@@ -114,6 +117,7 @@ namespace libp2p::protocol::kademlia {
     std::unique_ptr<Table> received_records_;
 
     bool started_ = false;
+    boost::optional<metrics::Timer> timer_;
     bool done_ = false;
 
     log::SubLogger log_;
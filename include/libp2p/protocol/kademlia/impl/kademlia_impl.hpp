@@ -19,6 +19,7 @@
 #include <libp2p/protocol/kademlia/config.hpp>
 #include <libp2p/protocol/kademlia/impl/content_routing_table.hpp>
 #include <libp2p/protocol/kademlia/impl/peer_routing_table.hpp>
+#include <libp2p/protocol/kademlia/impl/response_times.hpp>
 #include <libp2p/protocol/kademlia/impl/storage.hpp>
 #include <libp2p/protocol/kademlia/validator.hpp>
 
@@ -87,6 +88,10 @@ namespace libp2p::protocol::kademlia {
     /// @see SessionHost::closeSession
     void closeSession(std::shared_ptr<connection::Stream> stream) override;
 
+    /// @see SessionHost::onResponseTime
+    void onResponseTime(const peer::PeerId &peer_id,
+                        std::chrono::microseconds elapsed) override;
+
    private:
     void onPutValue(const std::shared_ptr<Session> &session, Message &&msg);
     void onGetValue(const std::shared_ptr<Session> &session, Message &&msg);
@@ -117,6 +122,10 @@ namespace libp2p::protocol::kademlia {
     outcome::result<void> findRandomPeer() override;
     void randomWalk();
 
+    /// Adds peers of persistent peerstore known to support kademlia into
+    /// routing table, so that restarted node doesn't wait for lookups
+    void restorePeers();
+
     // --- Primary (Injected) ---
 
     const Config &config_;
@@ -133,6 +142,9 @@ namespace libp2p::protocol::kademlia {
 
     const PeerId self_id_;
 
+    // Recent request durations, shared by lookups
+    std::shared_ptr<ResponseTimes> response_times_;
+
     // --- Auxiliary ---
 
     // Flag if started early
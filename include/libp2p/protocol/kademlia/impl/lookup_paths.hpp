@@ -0,0 +1,119 @@
+/**
+ * Copyright Quadrivium LLC
+ * All Rights Reserved
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <chrono>
+#include <memory>
+#include <optional>
+#include <queue>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+#include <libp2p/basic/scheduler.hpp>
+#include <libp2p/peer/latency_repository.hpp>
+#include <libp2p/protocol/kademlia/config.hpp>
+#include <libp2p/protocol/kademlia/impl/peer_id_with_distance.hpp>
+#include <libp2p/protocol/kademlia/impl/response_times.hpp>
+#include <libp2p/protocol/kademlia/node_id.hpp>
+
+namespace libp2p::protocol::kademlia {
+
+  /**
+   * Queues and request slots of iterative lookup.
+   * Peers are queried along one or several disjoint paths (S/Kademlia), each
+   * peer by one path only. Request which is outstanding longer than
+   * Config::slowRequestPercentile of recent responses is considered slow and
+   * releases its slot, so that lookup parallelism grows while peers are
+   * unresponsive, up to Config::maxRequestConcurency
+   */
+  class LookupPaths {
+   public:
+    LookupPaths(const Config &config,
+                const NodeId &target,
+                std::vector<PeerId> nearest_peer_ids,
+                std::shared_ptr<ResponseTimes> response_times);
+
+    /// Next peer to query and its path
+    struct Next {
+      size_t path;
+      PeerId peer_id;
+    };
+
+    /// Queues peer learned by path. Returns false if peer is already known
+    bool add(size_t path, const PeerId &peer_id);
+
+    /// Pops peer of path which has free request slot, none if no one has
+    std::optional<Next> next(const peer::LatencyRepository &latency);
+
+    /// Delay after which request started now becomes slow, none if
+    /// requests never become slow or there is too few statistics
+    std::optional<Time> slowRequestTime() const;
+
+    /// Registers request started by path, slow timer is kept while request
+    /// is in progress
+    void begin(size_t path,
+               const PeerId &peer_id,
+               basic::Scheduler::Handle slow_timer = {});
+
+    /// Marks request as slow, it releases request slot of its path.
+    /// Returns false if request is not in progress or already slow
+    bool slow(const PeerId &peer_id);
+
+    /// Finishes request, its duration is recorded if peer has responded.
+    /// Returns path of request, none if request is not in progress
+    std::optional<size_t> finish(const PeerId &peer_id, bool responded);
+
+    /// Marks path as it has found what lookup seeks. Converged disjoint
+    /// paths don't query peers anymore
+    void converge(size_t path);
+
+    /// True if lookup has more than one path
+    bool disjoint() const;
+
+    /// True if enough paths are converged: all of single path lookup, or
+    /// Config::disjointPathsQuorum of disjoint ones
+    bool quorum() const;
+
+    /// Number of requests in progress
+    size_t inProgress() const;
+
+    /// Number of queued peers
+    size_t queued() const;
+
+   private:
+    struct Path {
+      std::priority_queue<PeerIdWithDistance> queue;
+      size_t requests = 0;
+      size_t slow_requests = 0;
+      bool converged = false;
+    };
+
+    struct Request {
+      size_t path;
+      std::chrono::steady_clock::time_point started;
+      bool slow = false;
+      basic::Scheduler::Handle slow_timer;
+    };
+
+    /// True if path may start another request
+    bool hasFreeSlot(const Path &path) const;
+
+    const Config &config_;
+    const NodeId target_;
+    std::shared_ptr<ResponseTimes> response_times_;
+
+    // Keeps peer ids referenced by queues
+    std::unordered_set<PeerId> known_peer_ids_;
+    std::vector<Path> paths_;
+    std::unordered_map<PeerId, Request> requests_;
+    size_t converged_ = 0;
+    size_t next_path_ = 0;
+  };
+
+}  // namespace libp2p::protocol::kademlia
@@ -6,6 +6,10 @@
 
 #pragma once
 
+#include <numeric>
+#include <queue>
+
+#include <libp2p/peer/latency_repository.hpp>
 #include <libp2p/protocol/kademlia/common.hpp>
 #include <libp2p/protocol/kademlia/node_id.hpp>
 
@@ -36,4 +40,32 @@ namespace libp2p::protocol::kademlia {
     common::Hash256 distance_;
   };
 
+  /// Pops one of the first `window` peers of the queue at random, peers with
+  /// lower latency are more likely to be chosen. The rest stay in the queue
+  inline PeerId popPreferredPeer(std::priority_queue<PeerIdWithDistance> &queue,
+                                 size_t window,
+                                 const peer::LatencyRepository &latency) {
+    window = std::max<size_t>(window, 1);
+    std::vector<PeerIdWithDistance> candidates;
+    candidates.reserve(window);
+    while (not queue.empty() and candidates.size() < window) {
+      candidates.push_back(queue.top());
+      queue.pop();
+    }
+    size_t chosen = 0;
+    if (candidates.size() > 1) {
+      std::vector<size_t> indices(candidates.size());
+      std::iota(indices.begin(), indices.end(), 0);
+      chosen = latency.select(std::move(indices), 1, [&](size_t i) {
+        return *candidates[i];
+      })[0];
+    }
+    for (size_t i = 0; i < candidates.size(); ++i) {
+      if (i != chosen) {
+        queue.push(candidates[i]);
+      }
+    }
+    return *candidates[chosen];
+  }
+
 }  // namespace libp2p::protocol::kademlia
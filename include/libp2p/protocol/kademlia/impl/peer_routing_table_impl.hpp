@@ -10,7 +10,7 @@
 
 #include <boost/assert.hpp>
 #include <boost/optional.hpp>
-#include <list>
+#include <vector>
 
 #include <libp2p/event/bus.hpp>
 #include <libp2p/log/sublogger.hpp>
@@ -29,39 +29,29 @@ namespace libp2p::protocol::kademlia {
   };
 
   struct XorDistanceComparator {
-    explicit XorDistanceComparator(const peer::PeerId &from) {
-      hfrom = crypto::sha256(from.toVector()).value();
-    }
-
-    explicit XorDistanceComparator(const NodeId &from)
-        : hfrom(from.getData()) {}
+    explicit XorDistanceComparator(const peer::PeerId &from) : from(from) {}
 
-    explicit XorDistanceComparator(const Hash256 &hash) : hfrom(hash) {}
+    explicit XorDistanceComparator(const NodeId &from) : from(from) {}
 
-    bool operator()(const BucketPeerInfo &a, const BucketPeerInfo &b) {
-      NodeId from(hfrom);
-      auto d1 = a.node_id.distance(from);
-      auto d2 = b.node_id.distance(from);
-      constexpr auto size = Hash256().size();
+    explicit XorDistanceComparator(const Hash256 &hash) : from(hash) {}
 
-      // return true, if distance d1 is less than d2, false otherwise
-      return std::memcmp(d1.data(), d2.data(), size) < 0;
+    bool operator()(const BucketPeerInfo &a, const BucketPeerInfo &b) const {
+      // return true, if distance of a is less than distance of b
+      return a.node_id.distance(from) < b.node_id.distance(from);
     }
 
-    Hash256 hfrom{};
+    NodeId from;
   };
 
   /**
    * Single bucket which holds peers.
+   * Peers are stored contiguously, most recently seen first.
    */
   class Bucket {
    public:
     size_t size() const;
 
-    void append(const Bucket &bucket);
-
-    // sort bucket in ascending order by XOR distance from node_id
-    void sort(const NodeId &node_id);
+    const std::vector<BucketPeerInfo> &peers() const;
 
     auto find(const peer::PeerId &p) const;
 
@@ -71,8 +61,6 @@ namespace libp2p::protocol::kademlia {
 
     boost::optional<PeerId> removeReplaceableItem();
 
-    void truncate(size_t limit);
-
     std::vector<peer::PeerId> peerIds() const;
 
     bool contains(const peer::PeerId &p) const;
@@ -82,7 +70,7 @@ namespace libp2p::protocol::kademlia {
     Bucket split(size_t commonLenPrefix, const NodeId &target);
 
    private:
-    std::list<BucketPeerInfo> peers_;
+    std::vector<BucketPeerInfo> peers_;
   };
 
   class PeerRoutingTableImpl
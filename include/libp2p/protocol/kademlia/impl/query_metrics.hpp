@@ -0,0 +1,22 @@
+/**
+ * Copyright Quadrivium LLC
+ * All Rights Reserved
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <libp2p/common/metrics/registry.hpp>
+
+namespace libp2p::protocol::kademlia {
+
+  /// Starts measuring duration of kademlia query of given type
+  inline metrics::Timer queryTimer(const std::string &query) {
+    return metrics::Timer{metrics::Registry::get().histogram(
+        "libp2p_kademlia_query_seconds",
+        "Duration of kademlia queries",
+        metrics::latencyBuckets(),
+        {{"query", query}})};
+  }
+
+}  // namespace libp2p::protocol::kademlia
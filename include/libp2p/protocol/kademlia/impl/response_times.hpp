@@ -0,0 +1,38 @@
+/**
+ * Copyright Quadrivium LLC
+ * All Rights Reserved
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <optional>
+#include <vector>
+
+#include <libp2p/protocol/kademlia/common.hpp>
+
+namespace libp2p::protocol::kademlia {
+
+  /// Durations of recent lookup requests, from connecting to response.
+  /// Shared by lookups to find out when outstanding request is slow
+  class ResponseTimes {
+   public:
+    explicit ResponseTimes(size_t capacity = 256);
+
+    /// Adds duration of answered request, the oldest one is forgotten
+    void add(Time time);
+
+    /// Returns q-quantile (0 < q < 1) of recent durations, none if there are
+    /// too few samples
+    std::optional<Time> percentile(double q) const;
+
+    /// Number of samples
+    size_t size() const;
+
+   private:
+    const size_t capacity_;
+    std::vector<Time> samples_;
+    size_t next_ = 0;
+  };
+
+}  // namespace libp2p::protocol::kademlia
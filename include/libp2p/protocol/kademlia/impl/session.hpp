@@ -6,6 +6,7 @@
 
 #pragma once
 
+#include <chrono>
 #include <functional>
 
 #include <libp2p/basic/scheduler.hpp>
@@ -65,8 +66,15 @@ namespace libp2p::protocol::kademlia {
     void cancelResponseTimeout(
         const std::shared_ptr<ResponseHandler> &response_handler);
 
-    std::unordered_map<std::shared_ptr<ResponseHandler>,
-                       basic::Scheduler::Handle>
+    /// Reports time of response to request sent at given time
+    void onResponseTime(std::chrono::steady_clock::time_point sent);
+
+    struct PendingResponse {
+      basic::Scheduler::Handle timeout;
+      std::chrono::steady_clock::time_point sent;
+    };
+
+    std::unordered_map<std::shared_ptr<ResponseHandler>, PendingResponse>
         response_handlers_;
 
     std::weak_ptr<SessionHost> session_host_;
@@ -22,6 +22,10 @@ namespace libp2p::protocol::kademlia {
 
     /// Closes session by stream
     virtual void closeSession(std::shared_ptr<connection::Stream> stream) = 0;
+
+    /// Response to request has come from peer in elapsed time
+    virtual void onResponseTime(const peer::PeerId &peer_id,
+                                std::chrono::microseconds elapsed) = 0;
   };
 
 }  // namespace libp2p::protocol::kademlia
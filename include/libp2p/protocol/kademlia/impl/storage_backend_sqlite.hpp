@@ -0,0 +1,111 @@
+/**
+ * Copyright Quadrivium LLC
+ * All Rights Reserved
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <libp2p/protocol/kademlia/storage_backend.hpp>
+
+#include <list>
+#include <memory>
+#include <optional>
+#include <unordered_map>
+
+#include <libp2p/log/logger.hpp>
+#include <libp2p/storage/sqlite_write_queue.hpp>
+
+namespace libp2p::protocol::kademlia {
+
+  /**
+   * Persistent backend of key-value storage in SQLite database.
+   * Records keep expiration time (wall clock) in indexed column, so that
+   * expired ones are wiped without scanning. Writes go through the write
+   * queue, recently used records are cached
+   */
+  class StorageBackendSqlite : public StorageBackend {
+   public:
+    struct Config {
+      /// Number of cached recently used records
+      size_t cache_size = 1024;
+    };
+
+    StorageBackendSqlite(std::shared_ptr<storage::SQLiteWriteQueue> queue,
+                         Config config);
+
+    explicit StorageBackendSqlite(
+        std::shared_ptr<storage::SQLiteWriteQueue> queue);
+
+    outcome::result<void> putValue(Key key, Value value) override;
+
+    outcome::result<Value> getValue(const Key &key) const override;
+
+    outcome::result<void> erase(const Key &key) override;
+
+    bool expires() const override;
+
+    outcome::result<void> putRecord(Key key, Value value, Time ttl) override;
+
+    outcome::result<ValueAndTime> getRecord(const Key &key) const override;
+
+    outcome::result<void> wipeExpired() override;
+
+    /// Writes queued changes in one transaction
+    outcome::result<void> flush();
+
+   private:
+    /// Expiration time, ms since unix epoch
+    using Expires = int64_t;
+
+    struct Record {
+      Value value;
+      Expires expires;
+    };
+
+    /// Queued write, none record means removal
+    struct Pending {
+      std::optional<Record> record;
+
+      /// Queue commits when write was queued
+      uint64_t commits;
+    };
+
+    struct CacheEntry {
+      Key key;
+      Record record;
+    };
+    using Lru = std::list<CacheEntry>;
+
+    /// Returns record of queued write, cache or database
+    outcome::result<Record> find(const Key &key) const;
+
+    void cache(const Key &key, const Record &record) const;
+    void uncache(const Key &key) const;
+
+    /// Queues write, none record means removal
+    outcome::result<void> write(Key key, std::optional<Record> record);
+
+    /// Forgets queued writes which are committed already
+    void prunePending() const;
+
+    std::shared_ptr<storage::SQLiteWriteQueue> queue_;
+    const Config config_;
+
+    storage::SQLite::StatementHandle upsert_;
+    storage::SQLite::StatementHandle delete_;
+    storage::SQLite::StatementHandle select_;
+    storage::SQLite::StatementHandle delete_expired_;
+
+    /// Writes not committed yet
+    mutable std::unordered_map<Key, Pending> pending_;
+    mutable uint64_t pruned_commits_ = 0;
+
+    /// Most recently used first
+    mutable Lru lru_;
+    mutable std::unordered_map<Key, Lru::iterator> index_;
+
+    log::Logger log_;
+  };
+
+}  // namespace libp2p::protocol::kademlia
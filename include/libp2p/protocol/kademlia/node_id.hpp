@@ -6,6 +6,7 @@
 
 #pragma once
 
+#include <bit>
 #include <bitset>
 #include <climits>
 #include <cstring>
@@ -13,6 +14,8 @@
 #include <span>
 #include <vector>
 
+#include <boost/endian/conversion.hpp>
+
 #include <libp2p/crypto/sha/sha256.hpp>
 #include <libp2p/peer/peer_id.hpp>
 #include <libp2p/protocol/kademlia/common.hpp>
@@ -85,16 +88,19 @@ namespace libp2p::protocol::kademlia {
 
     /// number of common prefix bits between this and NodeId
     inline size_t commonPrefixLen(const NodeId &other) const {
-      constexpr int uint8_bits = CHAR_BIT;
+      // compare by 64-bit words, big-endian keeps bit order of the hash
+      constexpr size_t word_size = sizeof(uint64_t);
       constexpr auto size = Hash256().size();
-      Hash256 d = distance(other);
-      for (size_t i = 0; i < size; ++i) {
-        if (d[i] != 0) {
-          return i * uint8_bits + leadingZerosInByte(d[i]);
+      static_assert(size % word_size == 0);
+      for (size_t i = 0; i < size; i += word_size) {
+        uint64_t d = boost::endian::load_big_u64(data_.data() + i)
+                   ^ boost::endian::load_big_u64(other.data_.data() + i);
+        if (d != 0) {
+          return i * CHAR_BIT + std::countl_zero(d);
         }
       }
 
-      return size * uint8_bits;
+      return size * CHAR_BIT;
     }
 
     inline const Hash256 &getData() const {
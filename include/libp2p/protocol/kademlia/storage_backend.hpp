@@ -25,6 +25,29 @@ namespace libp2p::protocol::kademlia {
 
     /// Removes value corresponded to given @param key.
     virtual outcome::result<void> erase(const Key &key) = 0;
+
+    /// True if backend keeps lifetime of values and wipes expired ones
+    /// itself, so that storage doesn't index all the keys in memory
+    virtual bool expires() const {
+      return false;
+    }
+
+    /// Adds @param value which lives for @param ttl. Used if expires()
+    virtual outcome::result<void> putRecord(Key key, Value value, Time ttl) {
+      return putValue(std::move(key), std::move(value));
+    }
+
+    /// Searches for the @return value and its remaining lifetime.
+    /// Used if expires()
+    virtual outcome::result<ValueAndTime> getRecord(const Key &key) const {
+      OUTCOME_TRY(value, getValue(key));
+      return ValueAndTime{std::move(value), Time::max()};
+    }
+
+    /// Removes expired values. Used if expires()
+    virtual outcome::result<void> wipeExpired() {
+      return outcome::success();
+    }
   };
 
 }  // namespace libp2p::protocol::kademlia
@@ -13,6 +13,7 @@
 #include <libp2p/connection/stream.hpp>
 #include <libp2p/crypto/random_generator.hpp>
 #include <libp2p/event/bus.hpp>
+#include <libp2p/peer/latency_repository.hpp>
 #include <libp2p/protocol/ping/ping_config.hpp>
 
 namespace libp2p::peer {
@@ -57,6 +58,8 @@ namespace libp2p::protocol {
     std::shared_ptr<basic::Scheduler> scheduler_;
     libp2p::event::Bus &bus_;
     decltype(bus_.getChannel<event::protocol::PeerIsDeadChannel>()) channel_;
+    decltype(bus_.getChannel<event::protocol::RoundTripMeasuredChannel>())
+        round_trip_channel_;
 
     std::shared_ptr<connection::Stream> stream_;
     std::shared_ptr<crypto::random::RandomGenerator> rand_gen_;
@@ -64,6 +67,7 @@ namespace libp2p::protocol {
 
     std::vector<uint8_t> write_buffer_, read_buffer_;
     basic::Scheduler::Handle timer_;
+    std::chrono::steady_clock::time_point write_started_;
     bool closed_ = false;
 
     bool is_started_ = false;
@@ -87,6 +87,20 @@ namespace libp2p::security::noise {
                                            uint64_t nonce,
                                            BytesIn ciphertext,
                                            BytesIn aad) = 0;
+
+    /// Encrypts into out, plaintext may start at out.data(),
+    /// returns ciphertext size
+    virtual outcome::result<size_t> encryptInto(uint64_t nonce,
+                                                BytesIn plaintext,
+                                                BytesIn aad,
+                                                BytesOut out) = 0;
+
+    /// Decrypts into out, ciphertext may start at out.data(),
+    /// returns plaintext size
+    virtual outcome::result<size_t> decryptInto(uint64_t nonce,
+                                                BytesIn ciphertext,
+                                                BytesIn aad,
+                                                BytesOut out) = 0;
   };
 
   class NamedAEADCipher {
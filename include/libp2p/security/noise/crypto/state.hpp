@@ -43,6 +43,18 @@ namespace libp2p::security::noise {
                                    BytesIn ciphertext,
                                    BytesIn aad);
 
+    /// Encrypts into caller-supplied buffer without allocations,
+    /// plaintext may start at out.data(). Returns ciphertext size
+    outcome::result<size_t> encryptInto(BytesIn plaintext,
+                                        BytesIn aad,
+                                        BytesOut out);
+
+    /// Decrypts into caller-supplied buffer without allocations,
+    /// ciphertext may start at out.data(). Returns plaintext size
+    outcome::result<size_t> decryptInto(BytesIn ciphertext,
+                                        BytesIn aad,
+                                        BytesOut out);
+
     outcome::result<void> rekey();
 
     std::shared_ptr<CipherSuite> cipherSuite() const;
@@ -55,6 +55,9 @@ namespace libp2p::connection {
 
     void writeSome(BytesIn in, size_t bytes, WriteCallbackFunc cb) override;
 
+    void writeSomeVectored(std::span<const BytesIn> in,
+                           WriteCallbackFunc cb) override;
+
     void deferWriteCallback(std::error_code ec, WriteCallbackFunc cb) override;
 
     bool isInitiator() const override;
@@ -80,6 +83,15 @@ namespace libp2p::connection {
                OperationContext ctx,
                WriteCallbackFunc cb);
 
+    /// Encrypts plaintext into frame buffer and writes the frame,
+    /// plaintext may already reside in the frame buffer after length prefix.
+    /// Callback receives plaintext size
+    void writeFrame(BytesIn plaintext, Bytes &frame, WriteCallbackFunc cb);
+
+    /// Takes frame buffer from pool or allocates a new one
+    BufferList::iterator acquireWriteBuffer();
+
+    /// Returns frame buffer into pool
     void eraseWriteBuffer(BufferList::iterator &iterator);
 
     std::shared_ptr<LayerConnection> connection_;
@@ -88,9 +100,15 @@ namespace libp2p::connection {
     std::shared_ptr<crypto::marshaller::KeyMarshaller> key_marshaller_;
     std::shared_ptr<security::noise::CipherState> encoder_cs_;
     std::shared_ptr<security::noise::CipherState> decoder_cs_;
+    /// Received frame, decrypted in place
     std::shared_ptr<Bytes> frame_buffer_;
+    /// Position of unread plaintext in frame_buffer_
+    size_t frame_read_offset_ = 0;
     std::shared_ptr<security::noise::InsecureReadWriter> framer_;
+    /// Frame buffers used by write operations in progress
     BufferList write_buffers_;
+    /// Frame buffers ready for reuse
+    BufferList free_write_buffers_;
     log::Logger log_ = log::createLogger("NoiseConnection");
 
    public:
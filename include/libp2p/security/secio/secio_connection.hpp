@@ -9,8 +9,8 @@
 #include <atomic>
 #include <condition_variable>
 #include <mutex>
-#include <queue>
 
+#include <libp2p/basic/read_buffer.hpp>
 #include <libp2p/common/metrics/instance_count.hpp>
 #include <libp2p/connection/secure_connection.hpp>
 #include <libp2p/crypto/common.hpp>
@@ -52,6 +52,8 @@ namespace libp2p::connection {
      */
     static constexpr auto kMaxFrameSize = 8 * 1024 * 1024;
     static constexpr auto kLenMarkerSize = sizeof(uint32_t);
+    /// Digest size of the longest supported hash (SHA-512)
+    static constexpr size_t kMaxMacSize = 64;
 
     template <typename SecretType>
     struct AesSecrets {
@@ -114,30 +116,27 @@ namespace libp2p::connection {
    private:
     /**
      * Retrieves the next available SECIO message from the network.
-     */
-    void readNextMessage(ReadCallbackFunc cb);
-
-    /**
-     * Moves decrypted bytes from internal buffer to the output buffer.
-     * Does no boundary checks.
+     * Decrypted data goes directly to out, the rest of it is buffered.
      * @param out - buffer to be filled with decrypted bytes
-     * @param bytes - amount of bytes to pop from internal buffer
+     * @param cb - callback with bytes count written to out
      */
-    void popUserData(BytesOut out, size_t bytes);
+    void readNextMessage(BytesOut out, ReadCallbackFunc cb);
 
     /**
      * Computes MAC digest to sign a message using local peer key
      * @param message bytes to be signed
-     * @return signature bytes or an error if happened
+     * @param out - destination of digest
+     * @return nothing or an error if happened
      */
-    outcome::result<Bytes> macLocal(BytesIn message) const;
+    outcome::result<void> macLocal(BytesIn message, BytesOut out) const;
 
     /**
      * Computes MAC digest to sign a message using remote peer key
      * @param message bytes to be signed
-     * @return signature bytes or an error if happened
+     * @param out - destination of digest
+     * @return nothing or an error if happened
      */
-    outcome::result<Bytes> macRemote(BytesIn message) const;
+    outcome::result<void> macRemote(BytesIn message, BytesOut out) const;
 
     /// Returns MAC digest size in bytes for the chosen algorithm
     outcome::result<size_t> macSize() const;
@@ -160,10 +159,14 @@ namespace libp2p::connection {
     boost::optional<std::unique_ptr<crypto::aes::AesCtr>> local_encryptor_;
     boost::optional<std::unique_ptr<crypto::aes::AesCtr>> remote_decryptor_;
 
-    std::queue<uint8_t> user_data_buffer_;
+    /// Decrypted data which did not fit into client's buffer
+    basic::ReadBuffer user_data_buffer_;
 
     std::shared_ptr<Bytes> read_buffer_;
 
+    /// Frame buffer, reused unless it is referenced by a write in progress
+    std::shared_ptr<Bytes> write_buffer_;
+
     log::Logger log_ = log::createLogger("SecIoConnection");
 
    public:
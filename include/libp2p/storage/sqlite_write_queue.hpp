@@ -0,0 +1,110 @@
+/**
+ * Copyright Quadrivium LLC
+ * All Rights Reserved
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <chrono>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <vector>
+
+#include <libp2p/basic/scheduler.hpp>
+#include <libp2p/log/logger.hpp>
+#include <libp2p/storage/sqlite.hpp>
+
+namespace libp2p::storage {
+
+  /**
+   * Write-behind queue of SQLite database. Writes are executed in one
+   * transaction on the scheduler, so that callers don't wait for disk.
+   * Failed writes are retried by the next scheduled flush, ahead of writes
+   * queued later, and dropped after max_attempts.
+   * Queue may be shared by several stores of the same database
+   */
+  class SQLiteWriteQueue {
+   public:
+    struct Config {
+      /// Delay of queued writes
+      std::chrono::milliseconds flush_interval{100};
+
+      /// Number of queued writes which are flushed immediately, unless
+      /// the last flush failed
+      size_t max_batch_size = 1024;
+
+      /// Number of flushes a write may fail before it is dropped
+      size_t max_attempts = 5;
+
+      /// Max number of queued writes, the oldest ones are dropped over it
+      size_t max_queue_size = 16 * 1024;
+    };
+
+    /// Executes statement, returns number of changed rows or -1 on error
+    using Write = std::function<int(SQLite &)>;
+
+    SQLiteWriteQueue(std::shared_ptr<SQLite> db,
+                     std::shared_ptr<basic::Scheduler> scheduler,
+                     Config config);
+
+    SQLiteWriteQueue(std::shared_ptr<SQLite> db,
+                     std::shared_ptr<basic::Scheduler> scheduler);
+
+    ~SQLiteWriteQueue();
+
+    /// Database for reads and statement preparation
+    SQLite &db();
+
+    /// Queues write
+    void push(Write write);
+
+    /// Executes queued writes in one transaction, returns false on error.
+    /// Failed writes, or the whole batch if transaction fails, are kept for
+    /// the next scheduled flush
+    bool flush();
+
+    /// Number of queued writes
+    size_t size() const;
+
+    /// Number of committed batches. Writes queued before it changed are
+    /// written to database unless they failed
+    uint64_t commits() const;
+
+    /// Wall clock time in ms since unix epoch, for expiration columns
+    static int64_t now();
+
+   private:
+    struct Pending {
+      Write write;
+
+      /// Number of failed flushes
+      size_t attempts = 0;
+    };
+
+    /// Schedules flush, unless scheduled already
+    void armFlushTimer();
+
+    /// Queues failed writes for retry, drops ones out of attempts
+    void retry(std::vector<Pending> writes);
+
+    std::shared_ptr<SQLite> db_;
+    std::shared_ptr<basic::Scheduler> scheduler_;
+    const Config config_;
+
+    SQLite::StatementHandle begin_;
+    SQLite::StatementHandle commit_;
+    SQLite::StatementHandle rollback_;
+
+    std::deque<Pending> writes_;
+    basic::Scheduler::Handle flush_timer_;
+    uint64_t commits_ = 0;
+
+    /// Last flush failed, next one waits for the timer
+    bool failing_ = false;
+
+    log::Logger log_;
+  };
+
+}  // namespace libp2p::storage
@@ -70,6 +70,9 @@ namespace libp2p::transport {
 
     void writeSome(BytesIn in, size_t bytes, WriteCallbackFunc cb) override;
 
+    void writeSomeVectored(std::span<const BytesIn> in,
+                           WriteCallbackFunc cb) override;
+
     void deferWriteCallback(std::error_code ec, WriteCallbackFunc cb) override;
 
     outcome::result<multi::Multiaddress> remoteMultiaddr() override;
@@ -0,0 +1,265 @@
+/**
+ * Copyright Quadrivium LLC
+ * All Rights Reserved
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <libp2p/basic/scheduler/timing_wheel_scheduler.hpp>
+
+#include <bit>
+#include <stdexcept>
+
+namespace libp2p::basic {
+
+  /// Cancels entry unless it was already fired or reused
+  class TimingWheelScheduler::CancelHandle final : public CancelDtor {
+   public:
+    CancelHandle(std::weak_ptr<TimingWheelScheduler> scheduler,
+                 Entry *entry,
+                 uint64_t generation)
+        : scheduler_{std::move(scheduler)},
+          entry_{entry},
+          generation_{generation} {}
+
+    ~CancelHandle() override {
+      if (auto scheduler = scheduler_.lock()) {
+        scheduler->cancel(entry_, generation_);
+      }
+    }
+
+    CancelHandle(const CancelHandle &) = delete;
+    void operator=(const CancelHandle &) = delete;
+    CancelHandle(CancelHandle &&) = delete;
+    void operator=(CancelHandle &&) = delete;
+
+   private:
+    std::weak_ptr<TimingWheelScheduler> scheduler_;
+    Entry *entry_;
+    uint64_t generation_;
+  };
+
+  TimingWheelScheduler::TimingWheelScheduler(
+      std::shared_ptr<SchedulerBackend> backend, Scheduler::Config config)
+      : backend_{std::move(backend)},
+        config_{config},
+        current_(backend_->now().count()) {}
+
+  std::chrono::milliseconds TimingWheelScheduler::now() const {
+    return backend_->now();
+  }
+
+  Scheduler::Handle TimingWheelScheduler::scheduleImpl(
+      Callback &&cb,
+      std::chrono::milliseconds delay_from_now,
+      bool make_handle) {
+    if (not cb) {
+      throw std::logic_error{"TimingWheelScheduler::scheduleImpl empty cb arg"};
+    }
+
+    uint64_t abs = 0;
+    if (Time::zero() < delay_from_now) {
+      abs = (backend_->now() + delay_from_now).count();
+    }
+    auto entry = allocate(std::move(cb));
+    auto generation = entry->state.load(std::memory_order_relaxed) >> 1;
+    backend_->post([weak_self{weak_from_this()}, entry, generation, abs] {
+      auto self = weak_self.lock();
+      if (not self) {
+        return;
+      }
+      self->insert(entry, generation, abs);
+      self->pulse();
+    });
+    if (not make_handle) {
+      return Cancel{};
+    }
+    return std::make_unique<CancelHandle>(weak_from_this(), entry, generation);
+  }
+
+  void TimingWheelScheduler::pulse() {
+    while (true) {
+      auto now = backend_->now();
+      advance(now.count());
+      if (callDue() != 0) {
+        continue;
+      }
+      auto next = nextExpiry();
+      if (not next) {
+        return;
+      }
+      Time min{*next};
+      if (now < timer_ and timer_ <= min + config_.max_timer_threshold) {
+        return;
+      }
+      timer_ = std::max(now + config_.max_timer_threshold, min);
+      backend_->setTimer(timer_, weak_from_this());
+      return;
+    }
+  }
+
+  TimingWheelScheduler::Entry *TimingWheelScheduler::allocate(Callback &&cb) {
+    Entry *entry = nullptr;
+    {
+      std::lock_guard lock{pool_mutex_};
+      if (free_ == nullptr) {
+        auto &chunk = chunks_.emplace_back(std::make_unique<Entry[]>(kChunkSize));
+        for (size_t i = 0; i < kChunkSize; ++i) {
+          chunk[i].next = free_;
+          free_ = &chunk[i];
+        }
+      }
+      entry = free_;
+      free_ = entry->next;
+    }
+    entry->next = nullptr;
+    entry->cb = std::move(cb);
+    return entry;
+  }
+
+  void TimingWheelScheduler::release(Entry *entry) {
+    entry->cb = nullptr;
+    auto generation = entry->state.load(std::memory_order_relaxed) >> 1;
+    entry->state.store((generation + 1) << 1, std::memory_order_release);
+    std::lock_guard lock{pool_mutex_};
+    entry->next = free_;
+    free_ = entry;
+  }
+
+  bool TimingWheelScheduler::claim(Entry &entry, uint64_t generation) {
+    auto expected = generation << 1;
+    return entry.state.compare_exchange_strong(
+        expected, expected | 1, std::memory_order_acq_rel);
+  }
+
+  void TimingWheelScheduler::insert(Entry *entry,
+                                    uint64_t generation,
+                                    uint64_t abs) {
+    if (entry->state.load(std::memory_order_acquire) != generation << 1) {
+      // cancelled before it got into wheel
+      release(entry);
+      return;
+    }
+    entry->expires = abs;
+    place(entry);
+  }
+
+  void TimingWheelScheduler::place(Entry *entry) {
+    if (entry->expires <= current_) {
+      entry->level = kLevels;
+      link(due_, entry);
+      return;
+    }
+    auto level = (std::bit_width(entry->expires ^ current_) - 1) / kSlotBits;
+    auto slot = (entry->expires >> (level * kSlotBits)) & (kSlots - 1);
+    entry->level = static_cast<uint8_t>(level);
+    entry->slot = static_cast<uint8_t>(slot);
+    link(wheel_[level][slot], entry);
+    occupied_[level] |= uint64_t{1} << slot;
+  }
+
+  void TimingWheelScheduler::link(List &list, Entry *entry) {
+    entry->list = &list;
+    entry->prev = list.tail;
+    entry->next = nullptr;
+    (list.tail != nullptr ? list.tail->next : list.head) = entry;
+    list.tail = entry;
+  }
+
+  void TimingWheelScheduler::unlink(Entry *entry) {
+    auto &list = *entry->list;
+    (entry->prev != nullptr ? entry->prev->next : list.head) = entry->next;
+    (entry->next != nullptr ? entry->next->prev : list.tail) = entry->prev;
+    entry->prev = nullptr;
+    entry->next = nullptr;
+    entry->list = nullptr;
+    if (entry->level < kLevels and list.head == nullptr) {
+      occupied_[entry->level] &= ~(uint64_t{1} << entry->slot);
+    }
+  }
+
+  void TimingWheelScheduler::cancel(Entry *entry, uint64_t generation) {
+    if (not claim(*entry, generation)) {
+      return;
+    }
+    // release wheel slot now rather than when it expires, timeouts are
+    // usually cancelled long before that
+    backend_->post([weak_self{weak_from_this()}, entry, generation] {
+      auto self = weak_self.lock();
+      if (not self) {
+        return;
+      }
+      if (entry->state.load(std::memory_order_acquire) >> 1 != generation) {
+        return;
+      }
+      if (entry->list == nullptr) {
+        // not inserted yet, insert() will release it
+        return;
+      }
+      self->unlink(entry);
+      self->release(entry);
+    });
+  }
+
+  uint64_t TimingWheelScheduler::slotTime(size_t level, size_t slot) const {
+    auto shift = level * kSlotBits;
+    auto high_shift = shift + kSlotBits;
+    uint64_t high = high_shift < 64 ? current_ >> high_shift << high_shift : 0;
+    return high | (uint64_t{slot} << shift);
+  }
+
+  void TimingWheelScheduler::advance(uint64_t to) {
+    while (current_ < to) {
+      size_t level = 0;
+      while (level < kLevels and occupied_[level] == 0) {
+        ++level;
+      }
+      if (level == kLevels) {
+        current_ = to;
+        return;
+      }
+      // occupied slots are always ahead of wheel time on their level
+      size_t slot = std::countr_zero(occupied_[level]);
+      auto time = slotTime(level, slot);
+      if (time > to) {
+        current_ = to;
+        return;
+      }
+      current_ = time;
+      auto list = wheel_[level][slot];
+      wheel_[level][slot] = {};
+      occupied_[level] &= ~(uint64_t{1} << slot);
+      for (auto entry = list.head; entry != nullptr;) {
+        auto next = entry->next;
+        place(entry);
+        entry = next;
+      }
+    }
+  }
+
+  size_t TimingWheelScheduler::callDue() {
+    size_t called = 0;
+    while (due_.head != nullptr) {
+      auto entry = due_.head;
+      unlink(entry);
+      auto generation = entry->state.load(std::memory_order_relaxed) >> 1;
+      if (not claim(*entry, generation)) {
+        release(entry);
+        continue;
+      }
+      auto cb = std::move(entry->cb);
+      release(entry);
+      ++called;
+      cb();
+    }
+    return called;
+  }
+
+  std::optional<uint64_t> TimingWheelScheduler::nextExpiry() const {
+    for (size_t level = 0; level < kLevels; ++level) {
+      if (occupied_[level] != 0) {
+        return slotTime(level, std::countr_zero(occupied_[level]));
+      }
+    }
+    return std::nullopt;
+  }
+}  // namespace libp2p::basic
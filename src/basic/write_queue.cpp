@@ -18,6 +18,14 @@ namespace libp2p::basic {
     return total_unsent_size_;
   }
 
+  size_t WriteQueue::unacknowledgedBytes() const {
+    size_t bytes = 0;
+    for (const auto &item : queue_) {
+      bytes += item.unacknowledged;
+    }
+    return bytes;
+  }
+
   void WriteQueue::enqueue(DataRef data, Writer::WriteCallbackFunc cb) {
     auto data_sz = static_cast<size_t>(data.size());
 
@@ -0,0 +1,209 @@
+/**
+ * Copyright Quadrivium LLC
+ * All Rights Reserved
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <libp2p/common/metrics/registry.hpp>
+
+#include <algorithm>
+#include <stdexcept>
+
+#include <fmt/format.h>
+
+namespace libp2p::metrics {
+
+  namespace {
+    void escape(std::string &out, std::string_view value) {
+      for (auto c : value) {
+        switch (c) {
+          case '\\':
+            out += "\\\\";
+            break;
+          case '"':
+            out += "\\\"";
+            break;
+          case '\n':
+            out += "\\n";
+            break;
+          default:
+            out += c;
+        }
+      }
+    }
+
+    /// Formats labels as `a="1",b="2"`, without braces
+    std::string formatLabels(const Labels &labels) {
+      std::string out;
+      for (auto &[key, value] : labels) {
+        if (not out.empty()) {
+          out += ',';
+        }
+        out += key;
+        out += "=\"";
+        escape(out, value);
+        out += '"';
+      }
+      return out;
+    }
+
+    void writeSample(std::string &out,
+                     std::string_view name,
+                     std::string_view labels,
+                     std::string_view value) {
+      out += name;
+      if (not labels.empty()) {
+        out += '{';
+        out += labels;
+        out += '}';
+      }
+      out += ' ';
+      out += value;
+      out += '\n';
+    }
+
+    std::string joinLabels(std::string_view labels, std::string_view extra) {
+      if (labels.empty()) {
+        return std::string{extra};
+      }
+      return fmt::format("{},{}", labels, extra);
+    }
+  }  // namespace
+
+  Histogram::Histogram(std::vector<double> bounds)
+      : bounds_{std::move(bounds)},
+        counts_{std::make_unique<std::atomic_uint64_t[]>(bounds_.size() + 1)} {
+    if (not std::is_sorted(bounds_.begin(), bounds_.end())) {
+      throw std::logic_error{"libp2p::metrics::Histogram unsorted bounds"};
+    }
+  }
+
+  void Histogram::observe(double value) {
+    auto it = std::lower_bound(bounds_.begin(), bounds_.end(), value);
+    counts_[it - bounds_.begin()].fetch_add(1, std::memory_order_relaxed);
+    sum_.fetch_add(value, std::memory_order_relaxed);
+  }
+
+  Histogram::Snapshot Histogram::snapshot() const {
+    Snapshot snapshot;
+    snapshot.counts.reserve(bounds_.size() + 1);
+    for (size_t i = 0; i <= bounds_.size(); ++i) {
+      auto count = counts_[i].load(std::memory_order_relaxed);
+      snapshot.counts.push_back(count);
+      snapshot.count += count;
+    }
+    snapshot.sum = sum_.load(std::memory_order_relaxed);
+    return snapshot;
+  }
+
+  const std::vector<double> &latencyBuckets() {
+    static const std::vector<double> buckets{
+        0.0005, 0.001, 0.0025, 0.005, 0.01, 0.025, 0.05,
+        0.1,    0.25,  0.5,    1,     2.5,  5,     10,
+    };
+    return buckets;
+  }
+
+  Registry &Registry::get() {
+    static Registry registry;
+    return registry;
+  }
+
+  Registry::Family &Registry::family(std::string_view name,
+                                     std::string_view help,
+                                     Type type) {
+    auto it = families_.find(name);
+    if (it == families_.end()) {
+      it = families_.emplace(std::string{name}, Family{type, std::string{help}})
+               .first;
+    }
+    if (it->second.type != type) {
+      throw std::logic_error{
+          fmt::format("libp2p::metrics {} registered with other type", name)};
+    }
+    return it->second;
+  }
+
+  Counter &Registry::counter(std::string_view name,
+                             std::string_view help,
+                             const Labels &labels) {
+    std::lock_guard lock{mutex_};
+    auto &metric =
+        family(name, help, Type::COUNTER).counters[formatLabels(labels)];
+    if (not metric) {
+      metric = std::make_unique<Counter>();
+    }
+    return *metric;
+  }
+
+  Gauge &Registry::gauge(std::string_view name,
+                         std::string_view help,
+                         const Labels &labels) {
+    std::lock_guard lock{mutex_};
+    auto &metric = family(name, help, Type::GAUGE).gauges[formatLabels(labels)];
+    if (not metric) {
+      metric = std::make_unique<Gauge>();
+    }
+    return *metric;
+  }
+
+  Histogram &Registry::histogram(std::string_view name,
+                                 std::string_view help,
+                                 const std::vector<double> &bounds,
+                                 const Labels &labels) {
+    std::lock_guard lock{mutex_};
+    auto &metric =
+        family(name, help, Type::HISTOGRAM).histograms[formatLabels(labels)];
+    if (not metric) {
+      metric = std::make_unique<Histogram>(bounds);
+    }
+    return *metric;
+  }
+
+  std::string Registry::prometheus() const {
+    std::lock_guard lock{mutex_};
+    std::string out;
+    for (auto &[name, family] : families_) {
+      out += fmt::format("# HELP {} {}\n", name, family.help);
+      switch (family.type) {
+        case Type::COUNTER:
+          out += fmt::format("# TYPE {} counter\n", name);
+          for (auto &[labels, counter] : family.counters) {
+            writeSample(out, name, labels, std::to_string(counter->value()));
+          }
+          break;
+        case Type::GAUGE:
+          out += fmt::format("# TYPE {} gauge\n", name);
+          for (auto &[labels, gauge] : family.gauges) {
+            writeSample(out, name, labels, std::to_string(gauge->value()));
+          }
+          break;
+        case Type::HISTOGRAM: {
+          out += fmt::format("# TYPE {} histogram\n", name);
+          auto bucket_name = name + "_bucket";
+          for (auto &[labels, histogram] : family.histograms) {
+            auto snapshot = histogram->snapshot();
+            auto &bounds = histogram->bounds();
+            uint64_t cumulative = 0;
+            for (size_t i = 0; i < snapshot.counts.size(); ++i) {
+              cumulative += snapshot.counts[i];
+              auto le = i < bounds.size() ? fmt::format("{}", bounds[i])
+                                          : std::string{"+Inf"};
+              writeSample(out,
+                          bucket_name,
+                          joinLabels(labels, fmt::format("le=\"{}\"", le)),
+                          std::to_string(cumulative));
+            }
+            writeSample(
+                out, name + "_sum", labels, fmt::format("{}", snapshot.sum));
+            writeSample(
+                out, name + "_count", labels, std::to_string(snapshot.count));
+          }
+          break;
+        }
+      }
+    }
+    return out;
+  }
+
+}  // namespace libp2p::metrics
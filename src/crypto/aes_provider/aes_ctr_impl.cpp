@@ -75,6 +75,30 @@ namespace libp2p::crypto::aes {
     return out_buffer;
   }
 
+  outcome::result<size_t> AesCtrImpl::cryptInto(BytesIn data,
+                                                BytesOut out) const {
+    if (initialization_error_.has_error()) {
+      return initialization_error_.error();
+    }
+    if (out.size() < data.size()) {
+      return OpenSslError::WRONG_OUTPUT_SIZE;
+    }
+
+    // CTR mode is a stream cipher, output size equals to input size
+    int out_len{0};
+    if (1
+        != EVP_CipherUpdate(
+            ctx_, out.data(), &out_len, data.data(), data.size())) {
+      switch (mode_) {
+        case Mode::ENCRYPT:
+          return OpenSslError::FAILED_ENCRYPT_UPDATE;
+        case Mode::DECRYPT:
+          return OpenSslError::FAILED_DECRYPT_UPDATE;
+      }
+    }
+    return static_cast<size_t>(out_len);
+  }
+
   outcome::result<Bytes> AesCtrImpl::finalize() {
     if (initialization_error_.has_error()) {
       return initialization_error_.error();
@@ -20,38 +20,52 @@ namespace libp2p::crypto::chachapoly {
   ChaCha20Poly1305Impl::ChaCha20Poly1305Impl(Key key)
       : key_{key},
         aead_{EVP_aead_chacha20_poly1305()},
-        overhead_{EVP_AEAD_max_overhead(aead_)} {}
-
-  outcome::result<void> ChaCha20Poly1305Impl::init(EVP_AEAD_CTX *ctx,
-                                                   bool encrypt) {
-    IF1(EVP_AEAD_CTX_init_with_direction(
-            ctx,
-            aead_,
-            key_.data(),
-            key_.size(),
-            kTagSize,
-            encrypt ? evp_aead_seal : evp_aead_open),
-        "EVP_AEAD_CTX_init",
-        OpenSslError::FAILED_INITIALIZE_CONTEXT);
-    return outcome::success();
+        overhead_{EVP_AEAD_max_overhead(aead_)} {
+    initialized_ = 1
+                == EVP_AEAD_CTX_init(ctx_.get(),
+                                     aead_,
+                                     key_.data(),
+                                     key_.size(),
+                                     kTagSize,
+                                     nullptr);
+    if (not initialized_) {
+      log_->error("EVP_AEAD_CTX_init");
+    }
   }
 
   outcome::result<Bytes> ChaCha20Poly1305Impl::encrypt(const Nonce &nonce,
                                                        BytesIn plaintext,
                                                        BytesIn aad) {
-    bssl::ScopedEVP_AEAD_CTX ctx;
-    OUTCOME_TRY(init(ctx.get(), true));
     Bytes result;
-    // just reserving the space, possibly without actual memory allocation:
-    // ciphertext length equals to plaintext length
-    // one block size for EncryptFinal_ex (usually not required)
-    // 16 bytes for the tag
+    // ciphertext length equals to plaintext length plus 16 bytes for the tag
     result.resize(plaintext.size() + overhead_);
+    OUTCOME_TRY(out_size, encryptInto(nonce, plaintext, aad, result));
+    result.resize(out_size);
+    return result;
+  }
+
+  outcome::result<Bytes> ChaCha20Poly1305Impl::decrypt(const Nonce &nonce,
+                                                       BytesIn ciphertext,
+                                                       BytesIn aad) {
+    Bytes result;
+    // plain text should take less bytes than cipher text,
+    // at least it would not contain tag-length bytes (16).
+    result.resize(ciphertext.size());
+    OUTCOME_TRY(out_size, decryptInto(nonce, ciphertext, aad, result));
+    result.resize(out_size);
+    return result;
+  }
+
+  outcome::result<size_t> ChaCha20Poly1305Impl::encryptInto(
+      const Nonce &nonce, BytesIn plaintext, BytesIn aad, BytesOut out) {
+    if (not initialized_) {
+      return OpenSslError::FAILED_INITIALIZE_CONTEXT;
+    }
     size_t out_size = 0;
-    IF1(EVP_AEAD_CTX_seal(ctx.get(),
-                          result.data(),
+    IF1(EVP_AEAD_CTX_seal(ctx_.get(),
+                          out.data(),
                           &out_size,
-                          result.size(),
+                          out.size(),
                           nonce.data(),
                           nonce.size(),
                           plaintext.data(),
@@ -60,25 +74,19 @@ namespace libp2p::crypto::chachapoly {
                           aad.size()),
         "EVP_AEAD_CTX_seal",
         OpenSslError::FAILED_ENCRYPT_UPDATE);
-    result.resize(out_size);
-    return result;
+    return out_size;
   }
 
-  outcome::result<Bytes> ChaCha20Poly1305Impl::decrypt(const Nonce &nonce,
-                                                       BytesIn ciphertext,
-                                                       BytesIn aad) {
-    bssl::ScopedEVP_AEAD_CTX ctx;
-    OUTCOME_TRY(init(ctx.get(), false));
-    Bytes result;
-    // plain text should take less bytes than cipher text,
-    // at least it would not contain tag-length bytes (16).
-    // single block size for the case when len(in) == len(out)
-    result.resize(ciphertext.size());
+  outcome::result<size_t> ChaCha20Poly1305Impl::decryptInto(
+      const Nonce &nonce, BytesIn ciphertext, BytesIn aad, BytesOut out) {
+    if (not initialized_) {
+      return OpenSslError::FAILED_INITIALIZE_CONTEXT;
+    }
     size_t out_size = 0;
-    IF1(EVP_AEAD_CTX_open(ctx.get(),
-                          result.data(),
+    IF1(EVP_AEAD_CTX_open(ctx_.get(),
+                          out.data(),
                           &out_size,
-                          result.size(),
+                          out.size(),
                           nonce.data(),
                           nonce.size(),
                           ciphertext.data(),
@@ -87,8 +95,7 @@ namespace libp2p::crypto::chachapoly {
                           aad.size()),
         "EVP_AEAD_CTX_open",
         OpenSslError::FAILED_DECRYPT_UPDATE);
-    result.resize(out_size);
-    return result;
+    return out_size;
   }
 
 }  // namespace libp2p::crypto::chachapoly
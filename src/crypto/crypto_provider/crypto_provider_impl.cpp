@@ -7,6 +7,7 @@
 #include <libp2p/crypto/crypto_provider/crypto_provider_impl.hpp>
 
 #include <exception>
+#include <numeric>
 
 #include <openssl/ecdsa.h>
 #include <openssl/err.h>
@@ -270,6 +271,24 @@ namespace libp2p::crypto {
     }
   }
 
+  std::vector<bool> CryptoProviderImpl::verifyBatch(
+      std::span<const VerifyItem> items) const {
+    // keys of the same type go through the same provider one after another
+    std::vector<size_t> order(items.size());
+    std::iota(order.begin(), order.end(), 0);
+    std::stable_sort(order.begin(), order.end(), [&](size_t l, size_t r) {
+      return items[l].public_key.type < items[r].public_key.type;
+    });
+
+    std::vector<bool> verdicts(items.size(), false);
+    for (auto i : order) {
+      const auto &item = items[i];
+      auto res = verify(item.message, item.signature, item.public_key);
+      verdicts[i] = res.has_value() and res.value();
+    }
+    return verdicts;
+  }
+
   outcome::result<bool> CryptoProviderImpl::verifyRsa(
       BytesIn message, BytesIn signature, const PublicKey &public_key) const {
     rsa::PublicKey rsa_pub;
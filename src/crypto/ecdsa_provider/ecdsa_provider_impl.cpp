@@ -18,6 +18,10 @@
 using libp2p::common::FinalAction;
 
 namespace libp2p::crypto::ecdsa {
+  EcdsaProviderImpl::EcdsaProviderImpl(
+      std::shared_ptr<PublicKeyCache> key_cache)
+      : key_cache_(std::move(key_cache)) {}
+
   outcome::result<KeyPair> EcdsaProviderImpl::generate() const {
     std::shared_ptr<EC_KEY> ec_key{
         EC_KEY_new_by_curve_name(NID_X9_62_prime256v1), EC_KEY_free};
@@ -79,12 +83,21 @@ namespace libp2p::crypto::ecdsa {
       const PrehashedMessage &message,
       const Signature &signature,
       const PublicKey &public_key) const {
-    OUTCOME_TRY(ec_key, convertBytesToEcKey(public_key, d2i_EC_PUBKEY));
+    OUTCOME_TRY(ec_key, getPublicEcKey(public_key));
     OUTCOME_TRY(signature_status,
                 VerifyEcSignature(message, signature, ec_key));
     return signature_status;
   }
 
+  outcome::result<std::shared_ptr<EC_KEY>> EcdsaProviderImpl::getPublicEcKey(
+      const PublicKey &key) const {
+    auto parse = [&] { return convertBytesToEcKey(key, d2i_EC_PUBKEY); };
+    if (key_cache_ == nullptr) {
+      return parse();
+    }
+    return key_cache_->get<EC_KEY>(Key::Type::ECDSA, key, parse);
+  }
+
   template <typename KeyType>
   outcome::result<KeyType> EcdsaProviderImpl::convertEcKeyToBytes(
       const std::shared_ptr<EC_KEY> &ec_key, auto converter) const {
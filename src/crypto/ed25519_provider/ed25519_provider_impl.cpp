@@ -16,6 +16,10 @@ namespace libp2p::crypto::ed25519 {
 
   using libp2p::common::FinalAction;
 
+  Ed25519ProviderImpl::Ed25519ProviderImpl(
+      std::shared_ptr<PublicKeyCache> key_cache)
+      : key_cache_(std::move(key_cache)) {}
+
   outcome::result<Keypair> Ed25519ProviderImpl::generate() const {
     constexpr auto FAILED{KeyGeneratorError::KEY_GENERATION_FAILED};
 
@@ -105,9 +109,7 @@ namespace libp2p::crypto::ed25519 {
       BytesIn message,
       const Signature &signature,
       const PublicKey &public_key) const {
-    OUTCOME_TRY(evp_pkey,
-                NewEvpPkeyFromBytes(
-                    EVP_PKEY_ED25519, public_key, EVP_PKEY_new_raw_public_key));
+    OUTCOME_TRY(evp_pkey, getPublicEvpKey(public_key));
     constexpr auto FAILED{CryptoProviderError::SIGNATURE_VERIFICATION_FAILED};
 
     std::shared_ptr<EVP_MD_CTX> mctx{EVP_MD_CTX_new(), EVP_MD_CTX_free};
@@ -131,4 +133,16 @@ namespace libp2p::crypto::ed25519 {
 
     return FAILED;
   }
+
+  outcome::result<std::shared_ptr<EVP_PKEY>>
+  Ed25519ProviderImpl::getPublicEvpKey(const PublicKey &public_key) const {
+    auto parse = [&] {
+      return NewEvpPkeyFromBytes(
+          EVP_PKEY_ED25519, public_key, EVP_PKEY_new_raw_public_key);
+    };
+    if (key_cache_ == nullptr) {
+      return parse();
+    }
+    return key_cache_->get<EVP_PKEY>(Key::Type::Ed25519, public_key, parse);
+  }
 }  // namespace libp2p::crypto::ed25519
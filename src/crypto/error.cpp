@@ -44,6 +44,8 @@ OUTCOME_CPP_DEFINE_CATEGORY(libp2p::crypto, OpenSslError, e) {
       return "wrong key size";
     case OpenSslError::STREAM_FINALIZED:
       return "stream encryption(decryption) has been already finalized";
+    case OpenSslError::WRONG_OUTPUT_SIZE:
+      return "output buffer is too short";
   }
   return "unknown CryptoProviderError code";
 }
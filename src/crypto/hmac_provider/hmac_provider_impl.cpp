@@ -9,6 +9,8 @@
 
 #include <span>
 
+#include <openssl/hmac.h>
+
 namespace libp2p::crypto::hmac {
 
   outcome::result<Bytes> HmacProviderImpl::calculateDigest(
@@ -18,4 +20,41 @@ namespace libp2p::crypto::hmac {
     return hmac.digest();
   }
 
+  outcome::result<void> HmacProviderImpl::calculateDigestInto(
+      HashType hash_type,
+      const Bytes &key,
+      BytesIn message,
+      BytesOut out) const {
+    const EVP_MD *md = nullptr;
+    switch (hash_type) {
+      case HashType::SHA1:
+        md = EVP_sha1();
+        break;
+      case HashType::SHA256:
+        md = EVP_sha256();
+        break;
+      case HashType::SHA512:
+        md = EVP_sha512();
+        break;
+      default:
+        return HmacProviderError::UNSUPPORTED_HASH_METHOD;
+    }
+    if (out.size() != EVP_MD_size(md)) {
+      return HmacProviderError::WRONG_DIGEST_SIZE;
+    }
+    // one-shot HMAC keeps its context on stack
+    unsigned len{0};
+    if (nullptr
+        == HMAC(md,
+                key.data(),
+                key.size(),
+                message.data(),
+                message.size(),
+                out.data(),
+                &len)) {
+      return HmacProviderError::FAILED_FINALIZE_DIGEST;
+    }
+    return outcome::success();
+  }
+
 }  // namespace libp2p::crypto::hmac
@@ -0,0 +1,52 @@
+/**
+ * Copyright Quadrivium LLC
+ * All Rights Reserved
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <libp2p/crypto/public_key_cache.hpp>
+
+namespace libp2p::crypto {
+
+  PublicKeyCache::PublicKeyCache() : PublicKeyCache(Config{}) {}
+
+  PublicKeyCache::PublicKeyCache(Config config) : config_(config) {}
+
+  size_t PublicKeyCache::size() const {
+    std::lock_guard lock{mutex_};
+    return lru_.size();
+  }
+
+  Bytes PublicKeyCache::cacheKey(Key::Type type, BytesIn key) {
+    Bytes cache_key;
+    cache_key.reserve(1 + key.size());
+    cache_key.push_back(static_cast<uint8_t>(type));
+    cache_key.insert(cache_key.end(), key.begin(), key.end());
+    return cache_key;
+  }
+
+  std::shared_ptr<void> PublicKeyCache::find(const Bytes &key) {
+    std::lock_guard lock{mutex_};
+    auto it = index_.find(key);
+    if (it == index_.end()) {
+      return nullptr;
+    }
+    lru_.splice(lru_.begin(), lru_, it->second);
+    return it->second->decoded;
+  }
+
+  void PublicKeyCache::insert(Bytes key, std::shared_ptr<void> decoded) {
+    std::lock_guard lock{mutex_};
+    // concurrent miss may have decoded the same key
+    if (index_.contains(key)) {
+      return;
+    }
+    lru_.push_front({key, std::move(decoded)});
+    index_.emplace(std::move(key), lru_.begin());
+    if (lru_.size() > config_.capacity) {
+      index_.erase(lru_.back().key);
+      lru_.pop_back();
+    }
+  }
+
+}  // namespace libp2p::crypto
@@ -42,6 +42,9 @@ namespace {
 
 namespace libp2p::crypto::rsa {
 
+  RsaProviderImpl::RsaProviderImpl(std::shared_ptr<PublicKeyCache> key_cache)
+      : key_cache_(std::move(key_cache)) {}
+
   /**
    * according to libp2p specification:
    *  https://github.com/libp2p/specs/blob/master/peer-ids/peer-ids.md#how-keys-are-encoded-and-messages-signed
@@ -156,9 +159,7 @@ namespace libp2p::crypto::rsa {
       BytesIn message,
       const Signature &signature,
       const PublicKey &public_key) const {
-    OUTCOME_TRY(x509_key, RsaProviderImpl::getPublicKeyFromBytes(public_key));
-    EVP_PKEY *key = X509_PUBKEY_get0(x509_key.get());
-    std::unique_ptr<RSA, void (*)(RSA *)> rsa{EVP_PKEY_get1_RSA(key), RSA_free};
+    OUTCOME_TRY(rsa, getRsa(public_key));
     OUTCOME_TRY(digest, sha256(message));
     int result = RSA_verify(NID_sha256,
                             digest.data(),
@@ -169,6 +170,23 @@ namespace libp2p::crypto::rsa {
     return 1 == result;
   }
 
+  outcome::result<std::shared_ptr<RSA>> RsaProviderImpl::getRsa(
+      const PublicKey &key) const {
+    auto parse = [&]() -> outcome::result<std::shared_ptr<RSA>> {
+      OUTCOME_TRY(x509_key, RsaProviderImpl::getPublicKeyFromBytes(key));
+      EVP_PKEY *evp_key = X509_PUBKEY_get0(x509_key.get());
+      std::shared_ptr<RSA> rsa{EVP_PKEY_get1_RSA(evp_key), RSA_free};
+      if (rsa == nullptr) {
+        return KeyValidatorError::INVALID_PUBLIC_KEY;
+      }
+      return rsa;
+    };
+    if (key_cache_ == nullptr) {
+      return parse();
+    }
+    return key_cache_->get<RSA>(Key::Type::RSA, key, parse);
+  }
+
   outcome::result<std::shared_ptr<X509_PUBKEY>>
   RsaProviderImpl::getPublicKeyFromBytes(const PublicKey &input_key) {
     const uint8_t *bytes = input_key.data();
@@ -12,7 +12,13 @@
 namespace libp2p::crypto::secp256k1 {
   Secp256k1ProviderImpl::Secp256k1ProviderImpl(
       std::shared_ptr<random::CSPRNG> random)
+      : Secp256k1ProviderImpl(std::move(random), nullptr) {}
+
+  Secp256k1ProviderImpl::Secp256k1ProviderImpl(
+      std::shared_ptr<random::CSPRNG> random,
+      std::shared_ptr<PublicKeyCache> key_cache)
       : random_{std::move(random)},
+        key_cache_{std::move(key_cache)},
         ctx_{
             secp256k1_context_create(SECP256K1_CONTEXT_SIGN
                                      | SECP256K1_CONTEXT_VERIFY),
@@ -77,18 +83,32 @@ namespace libp2p::crypto::secp256k1 {
   outcome::result<bool> Secp256k1ProviderImpl::verify(
       BytesIn message, const Signature &signature, const PublicKey &key) const {
     OUTCOME_TRY(digest, sha256(message));
-    secp256k1_pubkey ffi_pub;
-    if (secp256k1_ec_pubkey_parse(ctx_.get(), &ffi_pub, key.data(), key.size())
-        == 0) {
-      return CryptoProviderError::SIGNATURE_VERIFICATION_FAILED;
-    }
+    OUTCOME_TRY(ffi_pub, parsePublicKey(key));
     secp256k1_ecdsa_signature ffi_sig;
     if (secp256k1_ecdsa_signature_parse_der(
             ctx_.get(), &ffi_sig, signature.data(), signature.size())
         == 0) {
       return CryptoProviderError::SIGNATURE_VERIFICATION_FAILED;
     }
-    return secp256k1_ecdsa_verify(ctx_.get(), &ffi_sig, digest.data(), &ffi_pub)
+    return secp256k1_ecdsa_verify(
+               ctx_.get(), &ffi_sig, digest.data(), ffi_pub.get())
         == 1;
   }
+
+  outcome::result<std::shared_ptr<secp256k1_pubkey>>
+  Secp256k1ProviderImpl::parsePublicKey(const PublicKey &key) const {
+    auto parse = [&]() -> outcome::result<std::shared_ptr<secp256k1_pubkey>> {
+      auto ffi_pub = std::make_shared<secp256k1_pubkey>();
+      if (secp256k1_ec_pubkey_parse(
+              ctx_.get(), ffi_pub.get(), key.data(), key.size())
+          == 0) {
+        return CryptoProviderError::SIGNATURE_VERIFICATION_FAILED;
+      }
+      return ffi_pub;
+    };
+    if (key_cache_ == nullptr) {
+      return parse();
+    }
+    return key_cache_->get<secp256k1_pubkey>(Key::Type::Secp256k1, key, parse);
+  }
 }  // namespace libp2p::crypto::secp256k1
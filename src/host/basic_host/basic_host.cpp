@@ -27,6 +27,13 @@ namespace libp2p::host {
     BOOST_ASSERT(repo_ != nullptr);
     BOOST_ASSERT(bus_ != nullptr);
     BOOST_ASSERT(transport_manager_ != nullptr);
+
+    round_trip_sub_ =
+        bus_->getChannel<event::protocol::RoundTripMeasuredChannel>().subscribe(
+            [repo{repo_.get()}](const auto &sample) {
+              repo->getLatencyRepository().addRoundTrip(sample.first,
+                                                        sample.second);
+            });
   }
 
   std::string_view BasicHost::getLibp2pVersion() const {
@@ -72,7 +72,7 @@ namespace libp2p::multi {
       if (cid.content_address.getHash().size() != 32) {
         return EncodeError::INVALID_HASH_LENGTH;
       }
-      bytes = cid.content_address.toBuffer();
+      qtils::append(bytes, cid.content_address.toBuffer());
     }
     return bytes;
   }
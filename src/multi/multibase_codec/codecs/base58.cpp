@@ -7,7 +7,6 @@
 #include <libp2p/multi/multibase_codec/codecs/base58.hpp>
 
 #include <array>
-#include <cstring>
 
 #include <boost/optional.hpp>
 #include <libp2p/multi/multibase_codec/codecs/base_error.hpp>
@@ -49,134 +48,173 @@ namespace {
     return c == ' ' || c == '\f' || c == '\n' || c == '\r' || c == '\t'
         || c == '\v';
   }
-}  // namespace
 
-namespace libp2p::multi::detail {
+  /// Number of base58 digits in one limb of encoder
+  constexpr size_t kDigitsPerLimb = 5;
+
+  /// 58^n for n up to kDigitsPerLimb
+  constexpr std::array<uint64_t, kDigitsPerLimb + 1> kPow58{
+      1, 58, 58 * 58, 58 * 58 * 58, 58 * 58 * 58 * 58, 58 * 58 * 58 * 58 * 58};
+
+  /// Limb of encoder, holds kDigitsPerLimb base58 digits
+  constexpr uint64_t kLimb58 = kPow58[kDigitsPerLimb];
+
+  /// Number of bytes in one limb of decoder
+  constexpr size_t kBytesPerLimb = 4;
+
+  // Limbs are kept below 2^32 and multiplied by at most 2^32, so that products
+  // with carry fit into 64-bit word
+  static_assert(kLimb58 < (uint64_t{1} << 32));
 
   /**
-   * Actual implementation of the encoding
-   * @param pbegin - pointer to the beginning of bytes collection
-   * @param pend - pointer to the end of bytes collection
+   * Actual implementation of the encoding. Big number is kept in base 58^5
+   * limbs, and input is consumed by 32-bit words, so that each step does 64-bit
+   * arithmetic instead of one byte per digit
+   * @param bytes - big-endian number to be encoded
    * @return encoded string
    */
-  std::string encodeImpl(const unsigned char *pbegin,
-                         const unsigned char *pend) {
+  std::string encodeImpl(libp2p::BytesIn bytes) {
     // Skip & count leading zeroes.
-    int zeroes = 0;
-    int length = 0;
-    while (pbegin != pend && *pbegin == 0) {
-      std::advance(pbegin, 1);
-      zeroes++;
+    size_t zeroes = 0;
+    while (zeroes < bytes.size() && bytes[zeroes] == 0) {
+      ++zeroes;
     }
-    // Allocate enough space in big-endian base58 representation.
-    // log(256) / log(58), rounded up.
-    // NOLINTNEXTLINE(cppcoreguidelines-narrowing-conversions)
-    int size = (pend - pbegin) * 138 / 100 + 1;
-    std::vector<unsigned char> b58(size);
-    // Process the bytes.
-    while (pbegin != pend) {
-      int carry = *pbegin;
-      int i = 0;
-      // Apply "b58 = b58 * 256 + ch".
-      for (auto it = b58.rbegin();
-           (carry != 0 || i < length) && (it != b58.rend());
-           it++, i++) {
-        carry += 256 * (*it);
-        *it = carry % 58;
-        carry /= 58;
-      }
+    bytes = bytes.subspan(zeroes);
 
-      length = i;
-      std::advance(pbegin, 1);
+    // Little-endian limbs, log(256) / log(58), rounded up.
+    std::vector<uint64_t> limbs;
+    limbs.reserve(bytes.size() * 138 / 100 / kDigitsPerLimb + 1);
+    // The first word is shorter, if bytes are not aligned to words.
+    auto word_size = bytes.size() % kBytesPerLimb;
+    if (word_size == 0) {
+      word_size = kBytesPerLimb;
     }
-    // Skip leading zeroes in base58 result.
-    auto it = b58.begin() + (size - length);
-    while (it != b58.end() && *it == 0) {
-      it++;
+    while (not bytes.empty()) {
+      uint64_t carry = 0;
+      for (size_t i = 0; i < word_size; ++i) {
+        carry = (carry << 8) | bytes[i];
+      }
+      auto shift = 8 * word_size;
+      bytes = bytes.subspan(word_size);
+      word_size = kBytesPerLimb;
+
+      // Apply "limbs = limbs * 2^shift + word".
+      for (auto &limb : limbs) {
+        carry += limb << shift;
+        limb = carry % kLimb58;
+        carry /= kLimb58;
+      }
+      while (carry != 0) {
+        limbs.push_back(carry % kLimb58);
+        carry /= kLimb58;
+      }
     }
-    // Translate the result into a string.
+
+    // Translate the result into a string, most significant limb goes without
+    // leading zeroes.
     std::string str;
-    str.reserve(zeroes + (b58.end() - it));
+    str.reserve(zeroes + limbs.size() * kDigitsPerLimb);
     str.assign(zeroes, '1');
-    while (it != b58.end()) {
-      str += pszBase58[*it];
-      std::advance(it, 1);
+    std::array<char, kDigitsPerLimb> digits{};
+    for (auto it = limbs.rbegin(); it != limbs.rend(); ++it) {
+      auto limb = *it;
+      for (auto d = digits.rbegin(); d != digits.rend(); ++d) {
+        *d = pszBase58[limb % 58];
+        limb /= 58;
+      }
+      auto begin = digits.begin();
+      if (it == limbs.rbegin()) {
+        while (*begin == pszBase58[0]) {
+          ++begin;
+        }
+      }
+      str.append(begin, digits.end());
     }
     return str;
   }
 
   /**
-   * Actual implementation of the decoding
-   * @param psz - pointer to the string to be decoded
+   * Actual implementation of the decoding. Big number is kept in 32-bit
+   * limbs, and input is consumed by 5 characters, so that each step does
+   * 64-bit arithmetic instead of one character per byte
+   * @param str - string to be decoded
    * @return decoded bytes, if the process went successfully, none otherwise
    */
-  boost::optional<std::vector<unsigned char>> decodeImpl(const char *psz) {
-    // Skip leading spaces.
-    while ((*psz != '0') && isSpace(*psz)) {
-      std::advance(psz, 1);
+  boost::optional<libp2p::Bytes> decodeImpl(std::string_view str) {
+    // Skip leading and trailing spaces.
+    while (not str.empty() && isSpace(str.front())) {
+      str.remove_prefix(1);
+    }
+    while (not str.empty() && isSpace(str.back())) {
+      str.remove_suffix(1);
     }
     // Skip and count leading '1's.
-    int zeroes = 0;
-    int length = 0;
-    while (*psz == '1') {
-      zeroes++;
-      std::advance(psz, 1);
+    size_t zeroes = 0;
+    while (zeroes < str.size() && str[zeroes] == pszBase58[0]) {
+      ++zeroes;
+    }
+    str.remove_prefix(zeroes);
+
+    // Little-endian limbs, log(58) / log(256), rounded up.
+    std::vector<uint64_t> limbs;
+    limbs.reserve(str.size() * 733 / 1000 / kBytesPerLimb + 1);
+    // The first chunk is shorter, if characters are not aligned to limbs.
+    auto chunk_size = str.size() % kDigitsPerLimb;
+    if (chunk_size == 0) {
+      chunk_size = kDigitsPerLimb;
     }
-    // Allocate enough space in big-endian base256 representation.
-    // log(58) / log(256), rounded up.
-    // NOLINTNEXTLINE(cppcoreguidelines-narrowing-conversions)
-    int size = strlen(psz) * 733 / 1000 + 1;
-    std::vector<unsigned char> b256(size);
-    // Process the characters.
-    while (*psz && !isSpace(*psz)) {  // NOLINT
-      // Decode base58 character
-      int carry = mapBase58.at(static_cast<uint8_t>(*psz));
-      if (carry == -1) {  // Invalid b58 character
-        return {};
+    while (not str.empty()) {
+      uint64_t carry = 0;
+      for (size_t i = 0; i < chunk_size; ++i) {
+        // Decode base58 character
+        auto digit = mapBase58.at(static_cast<uint8_t>(str[i]));
+        if (digit == -1) {  // Invalid b58 character
+          return boost::none;
+        }
+        carry = carry * 58 + digit;
       }
-      int i = 0;
-      for (auto it = b256.rbegin();
-           (carry != 0 || i < length) && (it != b256.rend());
-           ++it, ++i) {
-        carry += 58 * (*it);
-        *it = carry % 256;
-        carry /= 256;
+      auto multiplier = kPow58[chunk_size];
+      str.remove_prefix(chunk_size);
+      chunk_size = kDigitsPerLimb;
+
+      // Apply "limbs = limbs * 58^chunk + chunk".
+      for (auto &limb : limbs) {
+        carry += limb * multiplier;
+        limb = carry & 0xFFFFFFFF;
+        carry >>= 32;
       }
       if (carry != 0) {
-        return {};
+        limbs.push_back(carry);
       }
-      length = i;
-      std::advance(psz, 1);
-    }
-    // Skip trailing spaces.
-    while (isSpace(*psz)) {
-      std::advance(psz, 1);
-    }
-    if (*psz != 0) {
-      return {};
     }
-    // Skip leading zeroes in b256.
-    auto it = b256.begin() + (size - length);
-    while (it != b256.end() && *it == 0) {
-      it++;
-    }
-    // Copy result into output vector.
-    std::vector<unsigned char> vch(zeroes + (b256.end() - it));
+
+    // Copy result into output vector, skipping leading zeroes of the most
+    // significant limb.
+    libp2p::Bytes vch;
+    vch.reserve(zeroes + limbs.size() * kBytesPerLimb);
     vch.assign(zeroes, 0x00);
-    while (it != b256.end()) {
-      vch.push_back(*(it++));
+    for (auto it = limbs.rbegin(); it != limbs.rend(); ++it) {
+      for (int shift = 24; shift >= 0; shift -= 8) {
+        auto byte = static_cast<uint8_t>(*it >> shift);
+        if (byte != 0 || it != limbs.rbegin() || vch.size() > zeroes) {
+          vch.push_back(byte);
+        }
+      }
     }
     return vch;
   }
+}  // namespace
+
+namespace libp2p::multi::detail {
 
   std::string encodeBase58(BytesIn bytes) {
-    return encodeImpl(bytes.begin().base(), bytes.end().base());
+    return encodeImpl(bytes);
   }
 
   outcome::result<Bytes> decodeBase58(std::string_view string) {
-    auto decoded_bytes = decodeImpl(string.data());
+    auto decoded_bytes = decodeImpl(string);
     if (decoded_bytes) {
-      return Bytes{*decoded_bytes};
+      return std::move(*decoded_bytes);
     }
     return BaseError::INVALID_BASE58_INPUT;
   }
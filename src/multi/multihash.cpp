@@ -6,10 +6,11 @@
 
 #include <libp2p/multi/multihash.hpp>
 
+#include <algorithm>
+
 #include <boost/container_hash/hash.hpp>
 #include <libp2p/basic/varint_prefix_reader.hpp>
 #include <libp2p/common/types.hpp>
-#include <libp2p/log/logger.hpp>
 #include <qtils/hex.hpp>
 #include <qtils/unhex.hpp>
 
@@ -34,9 +35,6 @@ OUTCOME_CPP_DEFINE_CATEGORY(libp2p::multi, Multihash::Error, e) {
 
 namespace libp2p::multi {
 
-  Multihash::Multihash(HashType type, BytesIn hash)
-      : data_(std::make_shared<const Data>(type, hash)) {}
-
   namespace {
     template <typename Buffer>
     inline void appendVarint(Buffer &buffer, uint64_t t) {
@@ -51,30 +49,18 @@ namespace libp2p::multi {
     }
   }  // namespace
 
-  Multihash::Data::Data(HashType t, BytesIn h) : type(t) {
-    bytes.reserve(h.size() + 4);
-    appendVarint(bytes, type);
-    BOOST_ASSERT(h.size() <= std::numeric_limits<uint8_t>::max());
-    bytes.push_back(static_cast<uint8_t>(h.size()));
-    hash_offset = bytes.size();
-    bytes.insert(bytes.end(), h.begin(), h.end());
-    std_hash = boost::hash_range(bytes.begin(), bytes.end());
-  }
-
-  const Multihash::Data &Multihash::data() const {
-#if NDEBUG
-    if (data_ == nullptr) {
-      log::createLogger("Multihash")->critical("attempt to use moved object");
-      throw std::runtime_error("attempt to use moved multihash");
-    }
-#else
-    BOOST_ASSERT(data_);
-#endif
-    return *data_;
+  Multihash::Multihash(HashType type, BytesIn hash) : type_(type) {
+    bytes_.reserve(hash.size() + 4);
+    appendVarint(bytes_, type);
+    BOOST_ASSERT(hash.size() <= std::numeric_limits<uint8_t>::max());
+    bytes_.push_back(static_cast<uint8_t>(hash.size()));
+    hash_offset_ = bytes_.size();
+    bytes_.insert(bytes_.end(), hash.begin(), hash.end());
+    std_hash_ = boost::hash_range(bytes_.begin(), bytes_.end());
   }
 
   size_t Multihash::stdHash() const {
-    return data().std_hash;
+    return std_hash_;
   }
 
   outcome::result<Multihash> Multihash::create(HashType type, BytesIn hash) {
@@ -120,29 +106,25 @@ namespace libp2p::multi {
   }
 
   const HashType &Multihash::getType() const {
-    return data().type;
+    return type_;
   }
 
   BytesIn Multihash::getHash() const {
-    const auto &d = data();
-    return BytesIn(d.bytes).subspan(d.hash_offset);
+    return toBuffer().subspan(hash_offset_);
   }
 
   std::string Multihash::toHex() const {
-    return fmt::format("{:X}", data().bytes);
+    return fmt::format("{:X}", toBuffer());
   }
 
-  const Bytes &Multihash::toBuffer() const {
-    return data().bytes;
+  BytesIn Multihash::toBuffer() const {
+    return {bytes_.data(), bytes_.size()};
   }
 
   bool Multihash::operator==(const Multihash &other) const {
-    const auto &a = data();
-    const auto &b = other.data();
-    if (data_ == other.data_) {
-      return true;
-    }
-    return a.bytes == b.bytes && a.type == b.type;
+    // type is encoded in bytes
+    return std_hash_ == other.std_hash_
+       and std::ranges::equal(bytes_, other.bytes_);
   }
 
   bool Multihash::operator!=(const Multihash &other) const {
@@ -150,12 +132,10 @@ namespace libp2p::multi {
   }
 
   bool Multihash::operator<(const class libp2p::multi::Multihash &other) const {
-    const auto &a = data();
-    const auto &b = other.data();
-    if (a.type == b.type) {
-      return a.bytes < b.bytes;
+    if (type_ == other.type_) {
+      return std::ranges::lexicographical_compare(bytes_, other.bytes_);
     }
-    return a.type < b.type;
+    return type_ < other.type_;
   }
 
 }  // namespace libp2p::multi
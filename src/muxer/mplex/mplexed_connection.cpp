@@ -9,10 +9,27 @@
 #include <boost/assert.hpp>
 #include <libp2p/basic/write_return_size.hpp>
 #include <libp2p/muxer/mplex/mplex_frame.hpp>
+#include <libp2p/muxer/muxer_metrics.hpp>
 
 namespace libp2p::connection {
   using StreamId = MplexStream::StreamId;
 
+  namespace {
+    const muxer::MuxerMetrics &metrics() {
+      static const muxer::MuxerMetrics metrics{"mplex"};
+      return metrics;
+    }
+
+    size_t varintSize(uint64_t value) {
+      size_t size = 1;
+      while (value >= 0x80) {
+        value >>= 7;
+        ++size;
+      }
+      return size;
+    }
+  }  // namespace
+
   MplexedConnection::MplexedConnection(
       std::shared_ptr<SecureConnection> connection,
       muxer::MuxedConnectionConfig config)
@@ -52,6 +69,7 @@ namespace libp2p::connection {
     auto new_stream =
         std::make_shared<MplexStream>(shared_from_this(), new_stream_id);
     streams_[new_stream_id] = new_stream;
+    metrics().streams_opened.inc();
     return new_stream;
   }
 
@@ -80,6 +98,7 @@ namespace libp2p::connection {
              auto new_stream =
                  std::make_shared<MplexStream>(self, new_stream_id);
              self->streams_[new_stream_id] = new_stream;
+             metrics().streams_opened.inc();
              cb(std::move(new_stream));
            }});
   }
@@ -172,6 +191,8 @@ namespace libp2p::connection {
 
     is_writing_ = true;
     const auto &write_data = write_queue_.front();
+    metrics().frames_written.inc();
+    metrics().bytes_written.inc(write_data.data.size());
     return writeReturnSize(
         connection_, write_data.data, [self{shared_from_this()}](auto &&res) {
           self->onWriteCompleted(std::forward<decltype(res)>(res));
@@ -208,6 +229,12 @@ namespace libp2p::connection {
   void MplexedConnection::processFrame(const MplexFrame &frame) {
     using Flag = MplexFrame::Flag;
 
+    metrics().frames_read.inc();
+    metrics().bytes_read.inc(
+        varintSize((frame.stream_number << 3)
+                   | static_cast<uint8_t>(frame.flag))
+        + varintSize(frame.data.size()) + frame.data.size());
+
     // we are initiators of this connection, if the other side is a receiver of
     // this connection (o rly?)
     auto this_side_is_initiator = (frame.flag != Flag::NEW_STREAM)
@@ -250,6 +277,7 @@ namespace libp2p::connection {
     auto new_stream =
         std::make_shared<MplexStream>(weak_from_this(), stream_id);
     streams_[stream_id] = new_stream;
+    metrics().streams_opened.inc();
     new_stream_handler_(std::move(new_stream));
   }
 
@@ -291,6 +319,7 @@ namespace libp2p::connection {
 
   void MplexedConnection::processResetFrame(const MplexFrame &frame,
                                             StreamId stream_id) {
+    metrics().streams_reset.inc();
     if (auto stream_opt = findStream(stream_id); stream_opt) {
       (*stream_opt)->is_reset_ = true;
     }
@@ -314,6 +343,7 @@ namespace libp2p::connection {
   }
 
   void MplexedConnection::resetStream(StreamId stream_id) {
+    metrics().streams_reset.inc();
     write({createFrameBytes(stream_id.initiator
                                 ? MplexFrame::Flag::RESET_INITIATOR
                                 : MplexFrame::Flag::RESET_RECEIVER,
@@ -12,8 +12,11 @@
 namespace libp2p::muxer {
   Yamux::Yamux(MuxedConnectionConfig config,
                std::shared_ptr<basic::Scheduler> scheduler,
-               std::shared_ptr<network::ConnectionManager> cmgr)
-      : config_{config}, scheduler_{std::move(scheduler)} {
+               std::shared_ptr<network::ConnectionManager> cmgr,
+               std::shared_ptr<peer::LatencyRepository> latency)
+      : config_{config},
+        scheduler_{std::move(scheduler)},
+        latency_{std::move(latency)} {
     assert(scheduler_);
     if (cmgr) {
       std::weak_ptr<network::ConnectionManager> w(cmgr);
@@ -44,6 +47,6 @@ namespace libp2p::muxer {
       return cb(res.error());
     }
     cb(std::make_shared<connection::YamuxedConnection>(
-        std::move(conn), scheduler_, close_cb_, config_));
+        std::move(conn), scheduler_, close_cb_, config_, latency_));
   }
 }  // namespace libp2p::muxer
@@ -71,6 +71,40 @@ namespace libp2p::connection {
     doWrite(in, bytes, std::move(cb));
   }
 
+  void YamuxStream::writeSomeVectored(std::span<const BytesIn> in,
+                                      WriteCallbackFunc cb) {
+    size_t bytes = 0;
+    size_t last = 0;
+    for (size_t i = 0; i < in.size(); ++i) {
+      if (!in[i].empty()) {
+        bytes += in[i].size();
+        last = i;
+      }
+    }
+    if (bytes == 0) {
+      return deferWriteCallback(Error::STREAM_INVALID_ARGUMENT, std::move(cb));
+    }
+    if (!canWrite(bytes, cb)) {
+      return;
+    }
+
+    // only the last segment completes the write
+    for (size_t i = 0; i < last; ++i) {
+      if (!in[i].empty()) {
+        write_queue_.enqueue(in[i], {});
+      }
+    }
+    write_queue_.enqueue(
+        in[last],
+        [cb{std::move(cb)}, bytes](outcome::result<size_t> res) {
+          if (!res) {
+            return cb(res);
+          }
+          cb(bytes);
+        });
+    doWrite();
+  }
+
   void YamuxStream::deferWriteCallback(std::error_code ec,
                                        WriteCallbackFunc cb) {
     if (no_more_callbacks_) {
@@ -137,9 +171,13 @@ namespace libp2p::connection {
   }
 
   void YamuxStream::reset() {
+    if (no_more_callbacks_) {
+      return;
+    }
     no_more_callbacks_ = true;
-    feedback_.resetStream(stream_id_);
+    // closed first, so that connection drops queued data of the stream
     doClose(Error::STREAM_RESET_BY_HOST, true);
+    feedback_.resetStream(stream_id_);
   }
 
   void YamuxStream::adjustWindowSize(uint32_t new_size,
@@ -328,6 +366,10 @@ namespace libp2p::connection {
   }
 
   void YamuxStream::onDataWritten(size_t bytes) {
+    if (close_reason_) {
+      return onClosedDataWritten(bytes);
+    }
+
     auto result = write_queue_.ackDataSent(bytes);
     if (!result.data_consistent) {
       log()->error("write queue ack failed, stream {}", stream_id_);
@@ -341,7 +383,52 @@ namespace libp2p::connection {
     }
   }
 
+  void YamuxStream::onClosedDataWritten(size_t bytes) {
+    if (unacknowledged_on_close_ == 0) {
+      return;
+    }
+    unacknowledged_on_close_ -= std::min(bytes, unacknowledged_on_close_);
+    if (unacknowledged_on_close_ > 0) {
+      return;
+    }
+    releaseWriteCallbacks();
+  }
+
+  void YamuxStream::releaseWriteCallbacks() {
+    auto write_callbacks = std::move(deferred_write_callbacks_);
+    deferred_write_callbacks_.clear();
+    if (write_callbacks.empty()) {
+      return;
+    }
+
+    if (no_more_callbacks_) {
+      // writers of reset stream still learn that their data is released,
+      // the stream itself may be gone by then
+      feedback_.deferCall(
+          [write_callbacks{std::move(write_callbacks)}, ec{*close_reason_}] {
+            for (const auto &cb : write_callbacks) {
+              cb(ec);
+            }
+          });
+      return;
+    }
+
+    auto wptr = weak_from_this();
+    for (const auto &cb : write_callbacks) {
+      cb(*close_reason_);
+      if (wptr.expired() || no_more_callbacks_) {
+        return;
+      }
+    }
+  }
+
+  bool YamuxStream::isReset() const {
+    return no_more_callbacks_;
+  }
+
   void YamuxStream::closedByConnection(std::error_code ec) {
+    // connection releases data being written after close, so write callbacks
+    // are deferred until then
     doClose(std::move(ec), true);
   }
 
@@ -366,6 +453,14 @@ namespace libp2p::connection {
 
     auto write_callbacks = write_queue_.getAllCallbacks();
 
+    unacknowledged_on_close_ = write_queue_.unacknowledgedBytes();
+    if (unacknowledged_on_close_ > 0 || no_more_callbacks_) {
+      // connection still refers to client's data, or the stream is reset and
+      // only write callbacks are called
+      deferred_write_callbacks_ = std::move(write_callbacks);
+      write_callbacks.clear();
+    }
+
     write_queue_.clear();
 
     auto close_cb_and_res = closeCompleted();
@@ -374,6 +469,9 @@ namespace libp2p::connection {
     window_size_cb.swap(window_size_cb_);
 
     if (no_more_callbacks_) {
+      if (unacknowledged_on_close_ == 0) {
+        releaseWriteCallbacks();
+      }
       return;
     }
 
@@ -524,23 +622,33 @@ namespace libp2p::connection {
       return deferWriteCallback(Error::STREAM_INVALID_ARGUMENT, std::move(cb));
     }
 
+    if (!canWrite(bytes, cb)) {
+      return;
+    }
+
+    write_queue_.enqueue(in.first(bytes), std::move(cb));
+    doWrite();
+  }
+
+  bool YamuxStream::canWrite(size_t bytes, WriteCallbackFunc &cb) {
     if (!is_writable_) {
-      return deferWriteCallback(Error::STREAM_NOT_WRITABLE, std::move(cb));
+      deferWriteCallback(Error::STREAM_NOT_WRITABLE, std::move(cb));
+      return false;
     }
 
     if (close_reason_) {
-      return deferWriteCallback(
+      deferWriteCallback(
           std::error_code{},
           [cb{std::move(cb)}, res{*close_reason_}](
               outcome::result<size_t>) mutable { cb(std::move(res)); });
+      return false;
     }
 
     if (!write_queue_.canEnqueue(bytes)) {
-      return deferWriteCallback(Error::STREAM_WRITE_OVERFLOW, std::move(cb));
+      deferWriteCallback(Error::STREAM_WRITE_OVERFLOW, std::move(cb));
+      return false;
     }
-
-    write_queue_.enqueue(in.first(bytes), std::move(cb));
-    doWrite();
+    return true;
   }
 
 }  // namespace libp2p::connection
@@ -6,12 +6,15 @@
 
 #include <libp2p/muxer/yamux/yamuxed_connection.hpp>
 
+#include <algorithm>
+
 #include <boost/asio/error.hpp>
 
 #include <libp2p/basic/read_return_size.hpp>
-#include <libp2p/basic/write_return_size.hpp>
+#include <libp2p/basic/write.hpp>
 #include <libp2p/common/ambigous_size.hpp>
 #include <libp2p/log/logger.hpp>
+#include <libp2p/muxer/muxer_metrics.hpp>
 
 namespace libp2p::connection {
 
@@ -21,6 +24,11 @@ namespace libp2p::connection {
       return logger;
     }
 
+    const muxer::MuxerMetrics &metrics() {
+      static const muxer::MuxerMetrics metrics{"yamux"};
+      return metrics;
+    }
+
     inline bool isOutbound(uint32_t our_stream_id, uint32_t their_stream_id) {
       // streams id oddness and evenness, depends on connection direction,
       // outbound or inbound, resp.
@@ -33,7 +41,8 @@ namespace libp2p::connection {
       std::shared_ptr<SecureConnection> connection,
       std::shared_ptr<basic::Scheduler> scheduler,
       ConnectionClosedCallback closed_callback,
-      muxer::MuxedConnectionConfig config)
+      muxer::MuxedConnectionConfig config,
+      std::shared_ptr<peer::LatencyRepository> latency)
       : config_(config),
         connection_(std::move(connection)),
         scheduler_(std::move(scheduler)),
@@ -56,7 +65,8 @@ namespace libp2p::connection {
         closed_callback_(std::move(closed_callback)),
 
         // yes, sort of assert
-        remote_peer_(std::move(connection_->remotePeer().value())) {
+        remote_peer_(std::move(connection_->remotePeer().value())),
+        latency_(std::move(latency)) {
     assert(scheduler_);
     assert(config_.maximum_streams > 0);
     assert(config_.maximum_window_size >= YamuxFrame::kInitialWindowSize);
@@ -226,6 +236,7 @@ namespace libp2p::connection {
     BytesOut bytes_read(*raw_read_buffer_);
 
     SL_TRACE(log(), "read {} bytes", n);
+    metrics().bytes_read.inc(n);
 
     assert(n <= raw_read_buffer_->size());
 
@@ -280,6 +291,7 @@ namespace libp2p::connection {
     }
 
     SL_TRACE(log(), "YamuxedConnection::processHeader");
+    metrics().frames_read.inc();
 
     auto &frame = header.value();
 
@@ -419,7 +431,15 @@ namespace libp2p::connection {
         SL_DEBUG(log(), "received ACK on zero stream id");
         ok = false;
       } else {
-        // pong has come. TODO(artem): measure latency
+        // pong has come
+        if (latency_ and frame.length == ping_counter_
+            and ping_sent_ != std::chrono::steady_clock::time_point{}) {
+          latency_->addRoundTrip(
+              remote_peer_,
+              std::chrono::duration_cast<std::chrono::microseconds>(
+                  std::chrono::steady_clock::now() - ping_sent_));
+          ping_sent_ = {};
+        }
         return true;
       }
 
@@ -509,6 +529,7 @@ namespace libp2p::connection {
       return;
     }
 
+    metrics().streams_reset.inc();
     auto stream = std::move(it->second);
     eraseStream(stream_id);
     stream->onRSTReceived();
@@ -537,6 +558,7 @@ namespace libp2p::connection {
 
     SL_DEBUG(log(), "closing connection, reason: {}", notify_streams_code);
 
+    auto dropped_frames = std::move(write_queue_);
     write_queue_.clear();
 
     if (reply_to_peer_code.has_value() && !connection_->isClosed()) {
@@ -553,6 +575,14 @@ namespace libp2p::connection {
       stream->closedByConnection(notify_streams_code);
     }
 
+    // closed streams defer write callbacks until connection releases their
+    // data, frames being written now are released on write completion
+    for (auto &frame : dropped_frames) {
+      if (frame.stream) {
+        frame.stream->onDataWritten(frame.payload.size());
+      }
+    }
+
     for (auto [_, cb] : pending_streams) {
       cb(notify_streams_code);
     }
@@ -563,11 +593,16 @@ namespace libp2p::connection {
   }
 
   void YamuxedConnection::writeStreamData(uint32_t stream_id, BytesIn data) {
-    auto packet = dataMsg(stream_id, data.size(), true);
+    auto it = streams_.find(stream_id);
+    if (it == streams_.end()) {
+      log()->error("YamuxedConnection::writeStreamData: stream {} not found",
+                   stream_id);
+      return;
+    }
 
-    // will add support for vector writes some time
-    packet.insert(packet.end(), data.begin(), data.end());
-    enqueue(std::move(packet), stream_id);
+    // payload is not copied, it goes to the wire with vectored write
+    enqueue(WriteQueueItem{
+        dataMsg(stream_id, data.size(), false), data, it->second});
   }
 
   void YamuxedConnection::ackReceivedBytes(uint32_t stream_id, uint32_t bytes) {
@@ -581,6 +616,7 @@ namespace libp2p::connection {
 
   void YamuxedConnection::resetStream(StreamId stream_id) {
     SL_DEBUG(log(), "RST from stream {}", stream_id);
+    metrics().streams_reset.inc();
     enqueue(resetStreamMsg(stream_id));
     eraseStream(stream_id);
   }
@@ -607,76 +643,124 @@ namespace libp2p::connection {
     }
   }
 
-  void YamuxedConnection::enqueue(Buffer packet, StreamId stream_id) {
-    if (is_writing_) {
-      write_queue_.push_back(WriteQueueItem{std::move(packet), stream_id});
-    } else {
-      doWrite(WriteQueueItem{std::move(packet), stream_id});
+  void YamuxedConnection::enqueue(Buffer packet) {
+    enqueue(WriteQueueItem{std::move(packet), {}, nullptr});
+  }
+
+  void YamuxedConnection::enqueue(WriteQueueItem item) {
+    write_queue_.push_back(std::move(item));
+    if (!is_writing_) {
+      doWrite();
     }
   }
 
-  void YamuxedConnection::doWrite(WriteQueueItem packet) {
+  void YamuxedConnection::doWrite() {
     assert(!is_writing_);
+    assert(!write_queue_.empty());
+
+    // frames are moved into the callback, so the buffers stay valid until
+    // write completes
+    auto frames = std::make_shared<std::vector<WriteQueueItem>>();
+    std::vector<WriteQueueItem> dropped;
+    while (frames->size() < kMaxFramesPerWrite && !write_queue_.empty()) {
+      auto &frame = write_queue_.front();
+      // owner of reset stream may free the data
+      if (frame.stream && frame.stream->isReset()) {
+        dropped.push_back(std::move(frame));
+      } else {
+        frames->push_back(std::move(frame));
+      }
+      write_queue_.pop_front();
+    }
+    releaseFrames(dropped);
+    if (frames->empty()) {
+      return;
+    }
+    auto n = frames->size();
+
+    std::vector<BytesIn> buffers;
+    buffers.reserve(n * 2);
+    size_t bytes = 0;
+    for (const auto &frame : *frames) {
+      buffers.emplace_back(frame.packet);
+      bytes += frame.packet.size();
+      if (!frame.payload.empty()) {
+        buffers.emplace_back(frame.payload);
+        bytes += frame.payload.size();
+      }
+    }
+    metrics().frames_written.inc(n);
+    metrics().bytes_written.inc(bytes);
 
-    writing_buf_->assign(packet.packet.begin(), packet.packet.end());
-    auto cb = [wptr{weak_from_this()},
-               buf{writing_buf_},
-               packet = std::move(packet)](outcome::result<size_t> res) {
+    auto cb = [wptr{weak_from_this()}, frames](outcome::result<void> res) {
       if (auto self = wptr.lock()) {
-        self->onDataWritten(res, packet.stream_id);
+        self->onDataWritten(res, *frames);
+      } else {
+        releaseFrames(*frames);
       }
     };
 
     is_writing_ = true;
-    writeReturnSize(connection_, *writing_buf_, cb);
+    writing_frames_ = frames;
+    writeVectored(connection_, std::move(buffers), std::move(cb));
   }
 
-  void YamuxedConnection::onDataWritten(outcome::result<size_t> res,
-                                        StreamId stream_id) {
+  void YamuxedConnection::onDataWritten(outcome::result<void> res,
+                                        std::vector<WriteQueueItem> &frames) {
+    writing_frames_.reset();
+
     if (!res) {
-      // write error
+      // write error, streams are closed before their data is released
       close(res.error(), boost::none);
+      releaseFrames(frames);
       return;
     }
 
     // this instance may be killed inside further callback
     auto wptr = weak_from_this();
 
-    if (stream_id != 0) {
-      // pass write ack to stream about data size written except header size
-
-      auto sz = res.value();
-      if (sz < YamuxFrame::kHeaderLength) {
-        log()->error("onDataWritten : too small size arrived: {}", sz);
-        sz = 0;
-      } else {
-        sz -= YamuxFrame::kHeaderLength;
+    for (auto &frame : frames) {
+      if (!frame.stream) {
+        continue;
       }
 
-      if (sz > 0) {
-        auto it = streams_.find(stream_id);
-        if (it == streams_.end()) {
-          SL_DEBUG(
-              log(), "onDataWritten : stream {} no longer exists", stream_id);
-        } else {
-          // stream can now call write callbacks
-          it->second->onDataWritten(sz);
-        }
-      }
-    }
+      // pass write ack to stream about payload size written, stream can now
+      // call write callbacks
+      frame.stream->onDataWritten(frame.payload.size());
 
-    if (wptr.expired()) {
-      // *this* no longer exists
-      return;
+      if (wptr.expired()) {
+        // *this* no longer exists
+        return;
+      }
     }
 
     is_writing_ = false;
 
     if (started_ && !write_queue_.empty()) {
-      auto next_packet = std::move(write_queue_.front());
-      write_queue_.pop_front();
-      doWrite(std::move(next_packet));
+      doWrite();
+    }
+  }
+
+  void YamuxedConnection::releaseFrames(std::vector<WriteQueueItem> &frames) {
+    for (auto &frame : frames) {
+      if (frame.stream) {
+        frame.stream->onDataWritten(frame.payload.size());
+      }
+    }
+  }
+
+  size_t YamuxedConnection::queuedFrames(
+      const std::shared_ptr<YamuxStream> &stream) const {
+    auto of_stream = [&](const WriteQueueItem &frame) {
+      return frame.stream == stream;
+    };
+    size_t n =
+        std::count_if(write_queue_.begin(), write_queue_.end(), of_stream);
+    if (writing_frames_) {
+      n += std::count_if(
+          writing_frames_->begin(), writing_frames_->end(), of_stream);
     }
+    return n;
   }
 
   std::shared_ptr<Stream> YamuxedConnection::createStream(StreamId stream_id) {
@@ -687,6 +771,7 @@ namespace libp2p::connection {
                                       config_.maximum_window_size,
                                       basic::WriteQueue::kDefaultSizeLimit);
     streams_[stream_id] = stream;
+    metrics().streams_opened.inc();
     inactivity_handle_.reset();
     return stream;
   }
@@ -737,7 +822,8 @@ namespace libp2p::connection {
           }
           std::vector<StreamId> abandoned;
           for (auto &[id, stream] : self->streams_) {
-            if (stream.use_count() == 1) {
+            // queued frames keep stream alive until their data is written
+            if (stream.use_count() == 1 + self->queuedFrames(stream)) {
               abandoned.push_back(id);
               self->enqueue(resetStreamMsg(id));
             }
@@ -766,6 +852,7 @@ namespace libp2p::connection {
           // dont send pings if something is being written
           if (not self->is_writing_) {
             self->enqueue(pingOutMsg(++self->ping_counter_));
+            self->ping_sent_ = std::chrono::steady_clock::now();
             SL_TRACE(log(), "written ping message #{}", self->ping_counter_);
           }
           self->setTimerPing();
@@ -6,10 +6,12 @@
 
 #include <libp2p/network/cares/cares.hpp>
 
+#include <algorithm>
 #include <arpa/nameser.h>
+#include <ares_dns.h>
 #include <cstring>
-#include <stdexcept>
-#include <thread>
+#include <optional>
+#include <unordered_map>
 
 OUTCOME_CPP_DEFINE_CATEGORY(libp2p::network::c_ares, Ares::Error, e) {
   using E = libp2p::network::c_ares::Ares::Error;
@@ -18,8 +20,6 @@ OUTCOME_CPP_DEFINE_CATEGORY(libp2p::network::c_ares, Ares::Error, e) {
       return "C-ares library is not initialized";
     case E::CHANNEL_INIT_FAILURE:
       return "C-ares channel initialization failed";
-    case E::THREAD_FAILED:
-      return "Ares unable to start worker thread";
     case E::E_NO_DATA:
       return "The query completed but contains no answers";
     case E::E_BAD_QUERY:
@@ -60,16 +60,307 @@ OUTCOME_CPP_DEFINE_CATEGORY(libp2p::network::c_ares, Ares::Error, e) {
 
 namespace libp2p::network::c_ares {
 
-  // linting of the three lines is disabled due to clang-tidy bug
+  namespace {
+    /// Min TTL of TXT records in answer section of DNS response
+    std::optional<std::chrono::seconds> answerTtl(const unsigned char *abuf,
+                                                  int alen) {
+      if (alen < NS_HFIXEDSZ) {
+        return std::nullopt;
+      }
+      const auto *end = abuf + alen;
+      const auto *ptr = abuf + NS_HFIXEDSZ;
+      auto skip_name = [&] {
+        char *name{nullptr};
+        long length{0};  // NOLINT
+        if (ARES_SUCCESS
+            != ::ares_expand_name(ptr, abuf, alen, &name, &length)) {
+          return false;
+        }
+        ::ares_free_string(name);
+        ptr += length;
+        return true;
+      };
+      for (auto i = DNS_HEADER_QDCOUNT(abuf); i != 0; --i) {
+        if (not skip_name() or end - ptr < NS_QFIXEDSZ) {
+          return std::nullopt;
+        }
+        ptr += NS_QFIXEDSZ;
+      }
+      std::optional<std::chrono::seconds> ttl;
+      for (auto i = DNS_HEADER_ANCOUNT(abuf); i != 0; --i) {
+        if (not skip_name() or end - ptr < NS_RRFIXEDSZ) {
+          return std::nullopt;
+        }
+        if (DNS_RR_TYPE(ptr) == ns_t_txt) {
+          std::chrono::seconds record_ttl{DNS_RR_TTL(ptr)};
+          ttl = ttl ? std::min(*ttl, record_ttl) : record_ttl;
+        }
+        ptr += NS_RRFIXEDSZ + DNS_RR_LEN(ptr);
+      }
+      return ttl;
+    }
+  }  // namespace
+
+  class Ares::Reactor : public std::enable_shared_from_this<Reactor> {
+   public:
+    explicit Reactor(const std::shared_ptr<boost::asio::io_context> &io_context)
+        : io_context_{io_context}, timer_{*io_context} {}
+
+    ~Reactor() {
+      if (channel_ != nullptr) {
+        // fails queries in flight and closes sockets via sockStateCb
+        ::ares_destroy(channel_);
+      }
+    }
+
+    Reactor(const Reactor &) = delete;
+    Reactor(Reactor &&) = delete;
+    void operator=(const Reactor &) = delete;
+    void operator=(Reactor &&) = delete;
+
+    outcome::result<void> init() {
+      ::ares_options options{};
+      options.timeout = 30'000;
+      options.sock_state_cb = &Reactor::sockStateCb;
+      options.sock_state_cb_data = this;
+      auto status = ::ares_init_options(
+          &channel_, &options, ARES_OPT_TIMEOUTMS | ARES_OPT_SOCK_STATE_CB);
+      if (ARES_SUCCESS != status) {
+        SL_DEBUG(log(),
+                 "Unable to initialize c-ares channel - {}",
+                 ::ares_strerror(status));
+        channel_ = nullptr;
+        return Error::CHANNEL_INIT_FAILURE;
+      }
+      return outcome::success();
+    }
+
+    /// Starts query unless the same one is in flight, called on io_context
+    void query(const std::string &uri, TxtCallback callback) {
+      auto &callbacks = pending_[uri];
+      callbacks.emplace_back(std::move(callback));
+      if (callbacks.size() != 1) {
+        SL_TRACE(log(), "DNS TXT request to {} is already in flight", uri);
+        return;
+      }
+      // owned by c-ares until txtCallback, which is always called
+      auto query = std::make_unique<Query>(Query{this, uri});
+      ::ares_query(channel_,
+                   uri.c_str(),
+                   ns_c_in,
+                   ns_t_txt,
+                   &Reactor::txtCallback,
+                   query.release());
+      armTimer();
+    }
+
+   private:
+    struct Query {
+      Reactor *reactor;
+      std::string uri;
+    };
+
+    /// Socket of c-ares channel watched by io_context
+    struct Watch {
+      boost::asio::posix::stream_descriptor descriptor;
+      /// Distinguishes watches of reused fd numbers
+      uint64_t generation;
+      bool read = false;
+      bool write = false;
+      bool reading = false;
+      bool writing = false;
+    };
+
+    static void sockStateCb(void *data,
+                            ares_socket_t fd,
+                            int readable,
+                            int writable) {
+      static_cast<Reactor *>(data)->watch(fd, readable != 0, writable != 0);
+    }
+
+    void watch(ares_socket_t fd, bool read, bool write) {
+      auto it = watches_.find(fd);
+      if (not read and not write) {
+        if (it != watches_.end()) {
+          // socket is owned and closed by c-ares
+          it->second->descriptor.release();
+          watches_.erase(it);
+        }
+        return;
+      }
+      if (it == watches_.end()) {
+        it = watches_
+                 .emplace(fd,
+                          std::make_unique<Watch>(Watch{
+                              .descriptor = {timer_.get_executor(), fd},
+                              .generation = ++last_generation_,
+                          }))
+                 .first;
+      }
+      it->second->read = read;
+      it->second->write = write;
+      wait(fd, *it->second);
+    }
+
+    void wait(ares_socket_t fd, Watch &watch) {
+      auto handler = [weak_self{weak_from_this()},
+                      fd,
+                      generation{watch.generation}](bool read) {
+        return [weak_self, fd, generation, read](
+                   const boost::system::error_code &ec) {
+          if (auto self = weak_self.lock()) {
+            self->onReady(fd, generation, read, ec);
+          }
+        };
+      };
+      if (watch.read and not watch.reading) {
+        watch.reading = true;
+        watch.descriptor.async_wait(
+            boost::asio::posix::descriptor_base::wait_read, handler(true));
+      }
+      if (watch.write and not watch.writing) {
+        watch.writing = true;
+        watch.descriptor.async_wait(
+            boost::asio::posix::descriptor_base::wait_write, handler(false));
+      }
+    }
+
+    void onReady(ares_socket_t fd,
+                 uint64_t generation,
+                 bool read,
+                 const boost::system::error_code &ec) {
+      auto it = watches_.find(fd);
+      if (it == watches_.end() or it->second->generation != generation) {
+        return;
+      }
+      (read ? it->second->reading : it->second->writing) = false;
+      if (ec) {
+        return;
+      }
+      ::ares_process_fd(channel_,
+                        read ? fd : ARES_SOCKET_BAD,
+                        read ? ARES_SOCKET_BAD : fd);
+      // socket may be closed while processing
+      it = watches_.find(fd);
+      if (it != watches_.end() and it->second->generation == generation) {
+        wait(fd, *it->second);
+      }
+      armTimer();
+    }
+
+    /// Wakes c-ares up to handle timeouts and retries
+    void armTimer() {
+      ::timeval tv{};
+      if (nullptr == ::ares_timeout(channel_, nullptr, &tv)) {
+        timer_.cancel();
+        return;
+      }
+      timer_.expires_after(std::chrono::seconds{tv.tv_sec}
+                           + std::chrono::microseconds{tv.tv_usec});
+      timer_.async_wait(
+          [weak_self{weak_from_this()}](const boost::system::error_code &ec) {
+            if (ec) {
+              return;
+            }
+            if (auto self = weak_self.lock()) {
+              ::ares_process_fd(
+                  self->channel_, ARES_SOCKET_BAD, ARES_SOCKET_BAD);
+              self->armTimer();
+            }
+          });
+    }
+
+    static void txtCallback(
+        void *arg, int status, int, unsigned char *abuf, int alen) {
+      std::unique_ptr<Query> query{static_cast<Query *>(arg)};
+      auto now = DnsCache::Clock::now();
+      if (ARES_SUCCESS != status) {
+        auto error = kQueryErrors.at(status);
+        if (ARES_ENOTFOUND == status or ARES_ENODATA == status) {
+          cache().putNegative(query->uri, make_error_code(error), now);
+        }
+        query->reactor->complete(query->uri, error);
+        return;
+      }
+      ::ares_txt_reply *reply{nullptr};
+      auto parse_status = ::ares_parse_txt_reply(abuf, alen, &reply);
+      if (ARES_SUCCESS != parse_status) {
+        if (nullptr != reply) {
+          ::ares_free_data(reply);
+        }
+        query->reactor->complete(query->uri, kQueryErrors.at(parse_status));
+        return;
+      }
+      std::vector<std::string> result;
+      for (::ares_txt_reply *current = reply; current != nullptr;
+           current = current->next) {
+        std::string txt;
+        txt.resize(current->length);
+        std::memcpy(txt.data(), current->txt, current->length);
+        result.emplace_back(std::move(txt));
+      }
+      ::ares_free_data(reply);
+      cache().put(query->uri,
+                  result,
+                  answerTtl(abuf, alen).value_or(std::chrono::seconds{0}),
+                  now);
+      query->reactor->complete(query->uri, std::move(result));
+    }
+
+    void complete(const std::string &uri, const DnsCache::Result &result) {
+      auto node = pending_.extract(uri);
+      if (node.empty()) {
+        return;
+      }
+      auto io_context = io_context_.lock();
+      if (not io_context) {
+        return;
+      }
+      for (auto &callback : node.mapped()) {
+        boost::asio::post(*io_context,
+                          [callback{std::move(callback)}, result] {
+                            callback(result);
+                          });
+      }
+      if (pending_.empty()) {
+        // channel must not be destroyed from its own callback
+        boost::asio::post(*io_context, [weak_self{weak_from_this()}] {
+          auto self = weak_self.lock();
+          if (self and self->pending_.empty()) {
+            Ares::release(self);
+          }
+        });
+      }
+    }
+
+    /// Not owned, reactor is released once no queries are in flight
+    std::weak_ptr<boost::asio::io_context> io_context_;
+    ::ares_channel channel_{nullptr};
+    boost::asio::steady_timer timer_;
+    std::unordered_map<ares_socket_t, std::unique_ptr<Watch>> watches_;
+    uint64_t last_generation_ = 0;
+    /// uri -> callbacks of queries waiting for it
+    std::unordered_map<std::string, std::vector<TxtCallback>> pending_;
+  };
+
+  // linting of the lines is disabled due to clang-tidy bug
   // https://bugs.llvm.org/show_bug.cgi?id=48040
-  std::atomic_bool Ares::initialized_{false};                          // NOLINT
-  std::list<std::shared_ptr<Ares::RequestContext>> Ares::requests_{};  // NOLINT
+  std::atomic_bool Ares::initialized_{false};  // NOLINT
+  std::mutex Ares::reactors_mutex_;            // NOLINT
+  std::map<const boost::asio::io_context *,
+           std::shared_ptr<Ares::Reactor>>
+      Ares::reactors_{};  // NOLINT
 
   log::Logger Ares::log() {
     static log::Logger logger = log::createLogger("Ares");
     return logger;
   }
 
+  DnsCache &Ares::cache() {
+    static DnsCache cache{DnsCache::Config{}};
+    return cache;
+  }
+
   Ares::Ares() {
     bool expected{false};
     bool first_init = initialized_.compare_exchange_strong(expected, true);
@@ -90,6 +381,13 @@ namespace libp2p::network::c_ares {
   Ares::~Ares() {
     bool expected{true};
     if (initialized_.compare_exchange_strong(expected, false)) {
+      decltype(reactors_) reactors;
+      {
+        std::lock_guard lock{reactors_mutex_};
+        reactors.swap(reactors_);
+      }
+      // channels must be destroyed before library cleanup
+      reactors.clear();
       ares_library_cleanup();
     }
   }
@@ -107,39 +405,58 @@ namespace libp2p::network::c_ares {
       reportError(io_context, std::move(callback), Error::NOT_INITIALIZED);
       return;
     }
-    int status{ARES_SUCCESS};
-    ::ares_options options{};
-    ::ares_channel channel{nullptr};
-    options.timeout = 30'000;
-    status = ares_init_options(&channel, &options, ARES_OPT_TIMEOUTMS);
-    if (ARES_SUCCESS != status) {
-      SL_DEBUG(log(),
-               "Unable to initialize c-ares channel for request to {} - {}",
-               uri,
-               ::ares_strerror(status));
-      reportError(io_context, std::move(callback), Error::CHANNEL_INIT_FAILURE);
+    auto ctx = io_context.lock();
+    if (not ctx) {
+      SL_DEBUG(log(), "IO context has expired");
+      return;
+    }
+    if (auto cached = cache().get(uri, DnsCache::Clock::now())) {
+      SL_TRACE(log(), "DNS TXT request to {} is answered from cache", uri);
+      boost::asio::post(*ctx,
+                        [callback{std::move(callback)},
+                         result{std::move(*cached)}] { callback(result); });
       return;
     }
+    // channel is only touched from io_context thread
+    boost::asio::post(
+        *ctx, [io_context, uri, callback{std::move(callback)}]() mutable {
+          auto ctx = io_context.lock();
+          if (not ctx) {
+            return;
+          }
+          auto reactor = Ares::reactor(ctx);
+          if (not reactor) {
+            reportError(
+                io_context, std::move(callback), Error::CHANNEL_INIT_FAILURE);
+            return;
+          }
+          reactor->query(uri, std::move(callback));
+        });
+  }
 
-    auto request =
-        std::make_shared<RequestContext>(io_context, uri, std::move(callback));
-    requests_.push_back(request);
-
-    try {
-      std::thread worker([channel, request] {
-        ::ares_query(channel,
-                     request->uri.c_str(),
-                     ns_c_in,
-                     ns_t_txt,
-                     Ares::txtCallback,
-                     request.get());
-        Ares::waitAresChannel(channel);
-        ::ares_destroy(channel);
-      });
-      worker.detach();
-    } catch (const std::runtime_error &e) {
-      log()->error("Ares unable to start worker thread - {}", e.what());
-      request->callback(Error::THREAD_FAILED);
+  std::shared_ptr<Ares::Reactor> Ares::reactor(
+      const std::shared_ptr<boost::asio::io_context> &io_context) {
+    std::lock_guard lock{reactors_mutex_};
+    auto &reactor = reactors_[io_context.get()];
+    if (reactor == nullptr) {
+      auto new_reactor = std::make_shared<Reactor>(io_context);
+      if (new_reactor->init().has_error()) {
+        reactors_.erase(io_context.get());
+        return nullptr;
+      }
+      reactor = std::move(new_reactor);
+    }
+    return reactor;
+  }
+
+  void Ares::release(const std::shared_ptr<Reactor> &reactor) {
+    std::lock_guard lock{reactors_mutex_};
+    auto it = std::find_if(
+        reactors_.begin(), reactors_.end(), [&](const auto &entry) {
+          return entry.second == reactor;
+        });
+    if (it != reactors_.end()) {
+      reactors_.erase(it);
     }
   }
 
@@ -154,71 +471,4 @@ namespace libp2p::network::c_ares {
     SL_DEBUG(log(), "IO context has expired");
   }
 
-  void Ares::txtCallback(
-      void *arg, int status, int, unsigned char *abuf, int alen) {
-    auto *request_ptr{static_cast<RequestContext *>(arg)};
-    if (ARES_SUCCESS != status) {
-      reportError(request_ptr->io_context,
-                  request_ptr->callback,
-                  kQueryErrors.at(status));
-      removeRequest(request_ptr);
-      return;
-    }
-    ::ares_txt_reply *reply{nullptr};
-    auto parse_status = ::ares_parse_txt_reply(abuf, alen, &reply);
-    if (ARES_SUCCESS != parse_status) {
-      reportError(request_ptr->io_context,
-                  request_ptr->callback,
-                  kQueryErrors.at(parse_status));
-      removeRequest(request_ptr);
-      if (nullptr != reply) {
-        ::ares_free_data(reply);
-      }
-      return;
-    }
-    std::vector<std::string> result;
-    for (::ares_txt_reply *current = reply; current != nullptr;
-         current = current->next) {
-      std::string txt;
-      txt.resize(current->length);
-      std::memcpy(txt.data(), current->txt, current->length);
-      result.emplace_back(std::move(txt));
-    }
-    ::ares_free_data(reply);
-    if (auto ctx = request_ptr->io_context.lock()) {
-      ctx->post([callback{std::move(request_ptr->callback)},
-                 reply{std::move(result)}] { callback(reply); });
-    } else {
-      SL_DEBUG(log(), "IO context has expired");
-    }
-    removeRequest(request_ptr);
-  }
-
-  void Ares::waitAresChannel(::ares_channel channel) {
-    while (true) {
-      struct timeval *tvp{nullptr};  // NOLINT
-      struct timeval tv {};
-      fd_set read_fds;
-      fd_set write_fds;
-      int nfds{0};  // NOLINT
-
-      FD_ZERO(&read_fds);   // NOLINT
-      FD_ZERO(&write_fds);  // NOLINT
-      nfds = ::ares_fds(channel, &read_fds, &write_fds);
-      if (0 == nfds) {
-        break;
-      }
-      tvp = ::ares_timeout(channel, nullptr, &tv);
-      select(nfds, &read_fds, &write_fds, nullptr, tvp);
-      ::ares_process(channel, &read_fds, &write_fds);
-    }
-  }
-
-  void Ares::removeRequest(Ares::RequestContext *request_ptr) {
-    requests_.remove_if(
-        [&](const std::shared_ptr<Ares::RequestContext> &request_sptr) {
-          return request_ptr == request_sptr.get();
-        });
-  }
-
 }  // namespace libp2p::network::c_ares
@@ -0,0 +1,68 @@
+/**
+ * Copyright Quadrivium LLC
+ * All Rights Reserved
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <libp2p/network/cares/dns_cache.hpp>
+
+#include <algorithm>
+
+namespace libp2p::network::c_ares {
+
+  DnsCache::DnsCache(Config config) : config_{config} {}
+
+  std::optional<DnsCache::Result> DnsCache::get(const std::string &name,
+                                                Clock::time_point now) {
+    std::lock_guard lock{mutex_};
+    auto it = index_.find(name);
+    if (it == index_.end()) {
+      return std::nullopt;
+    }
+    auto entry = it->second;
+    if (entry->expires <= now) {
+      lru_.erase(entry);
+      index_.erase(it);
+      return std::nullopt;
+    }
+    lru_.splice(lru_.begin(), lru_, entry);
+    return entry->result;
+  }
+
+  void DnsCache::put(const std::string &name,
+                     std::vector<std::string> values,
+                     std::chrono::seconds ttl,
+                     Clock::time_point now) {
+    ttl = std::clamp(ttl, config_.min_ttl, config_.max_ttl);
+    insert({name, std::move(values), now + ttl});
+  }
+
+  void DnsCache::putNegative(const std::string &name,
+                             std::error_code error,
+                             Clock::time_point now) {
+    insert({name, error, now + config_.negative_ttl});
+  }
+
+  size_t DnsCache::size() const {
+    std::lock_guard lock{mutex_};
+    return lru_.size();
+  }
+
+  void DnsCache::insert(Entry entry) {
+    if (config_.capacity == 0) {
+      return;
+    }
+    std::lock_guard lock{mutex_};
+    if (auto it = index_.find(entry.name); it != index_.end()) {
+      lru_.erase(it->second);
+      index_.erase(it);
+    }
+    if (lru_.size() >= config_.capacity) {
+      index_.erase(lru_.back().name);
+      lru_.pop_back();
+    }
+    lru_.push_front(std::move(entry));
+    index_.emplace(lru_.front().name, lru_.begin());
+  }
+
+}  // namespace libp2p::network::c_ares
@@ -4,15 +4,52 @@
  * SPDX-License-Identifier: Apache-2.0
  */
 
+#include <algorithm>
 #include <functional>
 #include <iostream>
 
+#include <libp2p/common/metrics/registry.hpp>
 #include <libp2p/connection/stream.hpp>
 #include <libp2p/log/logger.hpp>
 #include <libp2p/network/impl/dialer_impl.hpp>
 
 namespace libp2p::network {
 
+  namespace {
+    struct DialMetrics {
+      metrics::Histogram &latency;
+      metrics::Counter &failures;
+    };
+
+    const DialMetrics &dialMetrics() {
+      static const DialMetrics metrics{
+          metrics::Registry::get().histogram(
+              "libp2p_dial_seconds",
+              "Duration of successful dials, including upgrade",
+              metrics::latencyBuckets()),
+          metrics::Registry::get().counter("libp2p_dial_failures_total",
+                                           "Dials failed on all addresses"),
+      };
+      return metrics;
+    }
+
+    /// Address class is its protocol stack without values, i.e. "ip6/tcp"
+    std::string addressClass(const multi::Multiaddress &addr) {
+      std::string address_class;
+      for (auto &protocol : addr.getProtocols()) {
+        if (not address_class.empty()) {
+          address_class += '/';
+        }
+        address_class += protocol.name;
+      }
+      return address_class;
+    }
+
+    /// Scores are clamped so that one class is not stuck forever after a
+    /// network change
+    constexpr int kMaxScore = 3;
+  }  // namespace
+
   void DialerImpl::dial(const peer::PeerInfo &p,
                         DialResultFunc cb,
                         std::chrono::milliseconds timeout) {
@@ -38,6 +75,9 @@ namespace libp2p::network {
         }
       }
       ctx->second.callbacks.emplace_back(std::move(cb));
+      if (ctx->second.in_flight != 0 and not ctx->second.stagger) {
+        armStagger(p.id, ctx->second);
+      }
       return;
     }
 
@@ -51,22 +91,77 @@ namespace libp2p::network {
     }
 
     DialCtx new_ctx{.addresses = {p.addresses.begin(), p.addresses.end()},
-                    .timeout = timeout};
+                    .timeout = timeout,
+                    .id = ++last_dial_id_};
     new_ctx.callbacks.emplace_back(std::move(cb));
+    auto dial_id = new_ctx.id;
     bool scheduled = dialing_peers_.emplace(p.id, std::move(new_ctx)).second;
     BOOST_ASSERT(scheduled);
-    rotate(p.id);
+    rotate(p.id, dial_id);
+  }
+
+  void DialerImpl::scheduleRotate(const peer::PeerId &peer_id,
+                                  uint64_t dial_id) {
+    scheduler_->schedule([wp{weak_from_this()}, peer_id, dial_id] {
+      if (auto self = wp.lock()) {
+        self->rotate(peer_id, dial_id);
+      }
+    });
+  }
+
+  void DialerImpl::armStagger(const peer::PeerId &peer_id, DialCtx &ctx) {
+    ctx.stagger = scheduler_->scheduleWithHandle(
+        [wp{weak_from_this()}, peer_id, dial_id{ctx.id}] {
+          if (auto self = wp.lock()) {
+            self->rotate(peer_id, dial_id);
+          }
+        },
+        config_.stagger_delay);
+  }
+
+  std::set<multi::Multiaddress>::iterator DialerImpl::nextAddress(
+      DialCtx &ctx) const {
+    auto best = ctx.addresses.end();
+    int best_score = 0;
+    bool best_alternates = false;
+    for (auto it = ctx.addresses.begin(); it != ctx.addresses.end(); ++it) {
+      auto address_class = addressClass(*it);
+      auto score_it = scores_.find(address_class);
+      auto score = score_it == scores_.end() ? 0 : score_it->second;
+      auto alternates = address_class != ctx.last_class;
+      if (best == ctx.addresses.end() or score > best_score
+          or (score == best_score and alternates and not best_alternates)) {
+        best = it;
+        best_score = score;
+        best_alternates = alternates;
+      }
+    }
+    return best;
   }
 
-  void DialerImpl::rotate(const peer::PeerId &peer_id) {
+  void DialerImpl::updateScore(const std::string &address_class,
+                               bool success) {
+    auto &score = scores_[address_class];
+    score = std::clamp(score + (success ? 1 : -1), -kMaxScore, kMaxScore);
+  }
+
+  void DialerImpl::rotate(const peer::PeerId &peer_id, uint64_t dial_id) {
     auto ctx_found = dialing_peers_.find(peer_id);
-    if (dialing_peers_.end() == ctx_found) {
-      SL_ERROR(
-          log_, "State inconsistency - cannot dial {}", peer_id.toBase58());
+    if (dialing_peers_.end() == ctx_found or ctx_found->second.id != dial_id) {
+      // dial was completed by another attempt
       return;
     }
     auto &&ctx = ctx_found->second;
+    ctx.stagger.reset();
 
+    if (ctx.addresses.empty() and ctx.in_flight != 0) {
+      // wait for attempts in flight
+      return;
+    }
+    if (ctx.in_flight >= config_.max_parallel_attempts) {
+      // next attempt is started when one of these finishes
+      return;
+    }
     if (ctx.addresses.empty() and not ctx.dialled) {
       completeDial(peer_id, std::errc::address_family_not_supported);
       return;
@@ -81,23 +176,37 @@ namespace libp2p::network {
       return;
     }
 
+    auto it = nextAddress(ctx);
+    const auto addr = *it;
+    ctx.tried_addresses.insert(addr);
+    ctx.addresses.erase(it);
+    auto tr = tmgr_->findBest(addr);
+    if (nullptr == tr) {
+      scheduleRotate(peer_id, dial_id);
+      return;
+    }
+
+    auto address_class = addressClass(addr);
     auto dial_handler =
-        [wp{weak_from_this()}, peer_id](
+        [wp{weak_from_this()}, peer_id, dial_id, address_class](
             outcome::result<std::shared_ptr<connection::CapableConnection>>
                 result) {
           if (auto self = wp.lock()) {
+            self->updateScore(address_class, result.has_value());
             auto ctx_found = self->dialing_peers_.find(peer_id);
-            if (self->dialing_peers_.end() == ctx_found) {
-              SL_ERROR(
-                  self->log_,
-                  "State inconsistency - uninteresting dial result for peer {}",
-                  peer_id.toBase58());
+            if (self->dialing_peers_.end() == ctx_found
+                or ctx_found->second.id != dial_id) {
+              // another attempt won the race
+              SL_DEBUG(self->log_,
+                       "Uninteresting dial result for peer {}",
+                       peer_id.toBase58());
               if (result.has_value() and not result.value()->isClosed()) {
                 auto close_res = result.value()->close();
                 BOOST_ASSERT(close_res);
               }
               return;
             }
+            --ctx_found->second.in_flight;
 
             if (result.has_value()) {
               self->listener_->onConnection(result);
@@ -107,11 +216,7 @@ namespace libp2p::network {
 
             // store an error otherwise and reschedule one more rotate
             ctx_found->second.result = std::move(result);
-            self->scheduler_->schedule([wp, peer_id] {
-              if (auto self = wp.lock()) {
-                self->rotate(peer_id);
-              }
-            });
+            self->scheduleRotate(peer_id, dial_id);
             return;
           }
           // closing the connection when dialer and connection requester
@@ -122,24 +227,19 @@ namespace libp2p::network {
           }
         };
 
-    auto first_addr = ctx.addresses.begin();
-    const auto addr = *first_addr;
-    ctx.tried_addresses.insert(addr);
-    ctx.addresses.erase(first_addr);
-    if (auto tr = tmgr_->findBest(addr); nullptr != tr) {
-      ctx.dialled = true;
-      SL_TRACE(log_,
-               "Dial to {} via {}",
-               peer_id.toBase58().substr(46),
-               addr.getStringAddress());
-      tr->dial(peer_id, addr, dial_handler, ctx.timeout);
-    } else {
-      scheduler_->schedule([wp{weak_from_this()}, peer_id] {
-        if (auto self = wp.lock()) {
-          self->rotate(peer_id);
-        }
-      });
+    ctx.dialled = true;
+    ++ctx.in_flight;
+    ctx.last_class = std::move(address_class);
+    if (not ctx.addresses.empty()) {
+      armStagger(peer_id, ctx);
     }
+    SL_TRACE(log_,
+             "Dial to {} via {}",
+             peer_id.toBase58().substr(46),
+             addr.getStringAddress());
+    // transport may call back synchronously and complete the dial, so ctx
+    // must not be touched after this
+    tr->dial(peer_id, addr, dial_handler, ctx.timeout);
   }
 
   void DialerImpl::completeDial(const peer::PeerId &peer_id,
@@ -147,6 +247,14 @@ namespace libp2p::network {
     if (auto ctx_found = dialing_peers_.find(peer_id);
         dialing_peers_.end() != ctx_found) {
       auto &&ctx = ctx_found->second;
+      if (result.has_value()) {
+        dialMetrics().latency.observe(std::chrono::duration<double>(
+                                          std::chrono::steady_clock::now()
+                                          - ctx.started)
+                                          .count());
+      } else {
+        dialMetrics().failures.inc();
+      }
       for (auto i = 0u; i < ctx.callbacks.size(); ++i) {
         scheduler_->schedule(
             [result, cb{std::move(ctx.callbacks[i])}] { cb(result); });
@@ -227,12 +335,14 @@ namespace libp2p::network {
       std::shared_ptr<TransportManager> tmgr,
       std::shared_ptr<ConnectionManager> cmgr,
       std::shared_ptr<ListenerManager> listener,
-      std::shared_ptr<basic::Scheduler> scheduler)
+      std::shared_ptr<basic::Scheduler> scheduler,
+      DialerConfig config)
       : multiselect_(std::move(multiselect)),
         tmgr_(std::move(tmgr)),
         cmgr_(std::move(cmgr)),
         listener_(std::move(listener)),
         scheduler_(std::move(scheduler)),
+        config_(config),
         log_(log::createLogger("DialerImpl")) {
     BOOST_ASSERT(multiselect_ != nullptr);
     BOOST_ASSERT(tmgr_ != nullptr);
@@ -10,6 +10,18 @@
 
 namespace libp2p::peer {
 
+  namespace {
+    /// Saturates, so that ttl::kPermanent doesn't overflow
+    Clock::time_point expiresAt(std::chrono::milliseconds ttl) {
+      auto now = Clock::now();
+      if (ttl >= std::chrono::duration_cast<std::chrono::milliseconds>(
+              Clock::time_point::max() - now)) {
+        return Clock::time_point::max();
+      }
+      return now + ttl;
+    }
+  }  // namespace
+
   InmemAddressRepository::InmemAddressRepository(
       std::shared_ptr<network::DnsaddrResolver> dnsaddr_resolver)
       : dnsaddr_resolver_{std::move(dnsaddr_resolver)} {
@@ -76,12 +88,12 @@ namespace libp2p::peer {
   outcome::result<bool> InmemAddressRepository::addAddresses(
       const PeerId &p,
       std::span<const multi::Multiaddress> ma,
-      AddressRepository::Milliseconds ttl) {
+      std::chrono::milliseconds ttl) {
     bool added = false;
     auto peer_it = findOrInsert(p);
     auto &addresses = *peer_it->second;
 
-    auto expires_at = Clock::now() + ttl;
+    auto expires_at = expiresAt(ttl);
     for (const auto &m : ma) {
       if (addresses.emplace(m, expires_at).second) {
         signal_added_(p, m);
@@ -95,12 +107,12 @@ namespace libp2p::peer {
   outcome::result<bool> InmemAddressRepository::upsertAddresses(
       const PeerId &p,
       std::span<const multi::Multiaddress> ma,
-      AddressRepository::Milliseconds ttl) {
+      std::chrono::milliseconds ttl) {
     bool added = false;
     auto peer_it = findOrInsert(p);
     auto &addresses = *peer_it->second;
 
-    auto expires_at = Clock::now() + ttl;
+    auto expires_at = expiresAt(ttl);
     for (const auto &m : ma) {
       auto [addr_it, emplaced] = addresses.emplace(m, expires_at);
       if (emplaced) {
@@ -122,7 +134,7 @@ namespace libp2p::peer {
     }
     auto &addresses = *peer_it->second;
 
-    auto expires_at = Clock::now() + ttl;
+    auto expires_at = expiresAt(ttl);
     std::for_each(addresses.begin(), addresses.end(), [expires_at](auto &item) {
       item.second = expires_at;
     });
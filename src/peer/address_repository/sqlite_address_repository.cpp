@@ -0,0 +1,218 @@
+/**
+ * Copyright Quadrivium LLC
+ * All Rights Reserved
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <libp2p/peer/address_repository/sqlite_address_repository.hpp>
+
+#include <limits>
+
+namespace libp2p::peer {
+
+  namespace {
+    constexpr auto kNeverExpires = std::numeric_limits<int64_t>::max();
+
+    int64_t expiresAt(std::chrono::milliseconds ttl) {
+      auto now = storage::SQLiteWriteQueue::now();
+      return ttl.count() >= kNeverExpires - now ? kNeverExpires
+                                                : now + ttl.count();
+    }
+  }  // namespace
+
+  SqliteAddressRepository::SqliteAddressRepository(
+      std::shared_ptr<network::DnsaddrResolver> dnsaddr_resolver,
+      std::shared_ptr<storage::SQLiteWriteQueue> queue)
+      : InmemAddressRepository(std::move(dnsaddr_resolver)),
+        queue_(std::move(queue)) {
+    BOOST_ASSERT(queue_ != nullptr);
+    auto &db = queue_->db();
+
+    db << "CREATE TABLE IF NOT EXISTS peer_addresses ("
+          "peer BLOB NOT NULL, "
+          "address BLOB NOT NULL, "
+          "expires INTEGER NOT NULL, "
+          "PRIMARY KEY (peer, address)) WITHOUT ROWID;";
+    db << "CREATE INDEX IF NOT EXISTS peer_addresses_expires "
+          "ON peer_addresses (expires);";
+
+    // adding known address only extends its lifetime
+    insert_ = db.createStatement(
+        "INSERT INTO peer_addresses (peer, address, expires) "
+        "VALUES (?, ?, ?) ON CONFLICT (peer, address) "
+        "DO UPDATE SET expires = max(expires, excluded.expires);");
+    upsert_ = db.createStatement(
+        "INSERT OR REPLACE INTO peer_addresses (peer, address, expires) "
+        "VALUES (?, ?, ?);");
+    update_ = db.createStatement(
+        "UPDATE peer_addresses SET expires = ? WHERE peer = ?;");
+    delete_ = db.createStatement("DELETE FROM peer_addresses WHERE peer = ?;");
+    delete_expired_ =
+        db.createStatement("DELETE FROM peer_addresses WHERE expires <= ?;");
+    select_ = db.createStatement(
+        "SELECT address, expires FROM peer_addresses "
+        "WHERE peer = ? AND expires > ?;");
+    select_all_ = db.createStatement(
+        "SELECT peer, address, expires FROM peer_addresses "
+        "WHERE expires > ?;");
+  }
+
+  void SqliteAddressRepository::load(const PeerId &p) const {
+    if (all_loaded_ or not loaded_.emplace(p).second) {
+      return;
+    }
+    // loading doesn't change observable content of repository
+    auto &self = const_cast<SqliteAddressRepository &>(*this);
+    queue_->db().execQuery(
+        select_,
+        [&](const Bytes &address, int64_t expires) {
+          self.restore(p, address, expires);
+        },
+        p.toBytes(),
+        storage::SQLiteWriteQueue::now());
+  }
+
+  void SqliteAddressRepository::loadAll() const {
+    if (all_loaded_) {
+      return;
+    }
+    auto &self = const_cast<SqliteAddressRepository &>(*this);
+    auto loaded = loaded_;
+    queue_->db().execQuery(
+        select_all_,
+        [&](const Bytes &peer, const Bytes &address, int64_t expires) {
+          auto p = PeerId::fromBytes(peer);
+          if (p and not loaded.contains(p.value())) {
+            self.restore(p.value(), address, expires);
+          }
+        },
+        storage::SQLiteWriteQueue::now());
+    all_loaded_ = true;
+    loaded_.clear();
+  }
+
+  void SqliteAddressRepository::restore(const PeerId &p,
+                                        const Bytes &address,
+                                        int64_t expires) {
+    auto ma = multi::Multiaddress::create(address);
+    if (not ma) {
+      return;
+    }
+    auto ttl = expires == kNeverExpires
+                 ? ttl::kPermanent
+                 : Milliseconds(expires - storage::SQLiteWriteQueue::now());
+    std::ignore = InmemAddressRepository::upsertAddresses(
+        p, std::span(&ma.value(), 1), ttl);
+  }
+
+  void SqliteAddressRepository::store(
+      storage::SQLite::StatementHandle statement,
+      const PeerId &p,
+      std::span<const multi::Multiaddress> ma,
+      Milliseconds ttl) {
+    auto expires = expiresAt(ttl);
+    for (const auto &m : ma) {
+      queue_->push([statement,
+                    peer = p.toBytes(),
+                    address = m.getBytesAddress(),
+                    expires](storage::SQLite &db) {
+        return db.execCommand(statement, peer, address, expires);
+      });
+    }
+  }
+
+  outcome::result<bool> SqliteAddressRepository::addAddresses(
+      const PeerId &p,
+      std::span<const multi::Multiaddress> ma,
+      Milliseconds ttl) {
+    load(p);
+    OUTCOME_TRY(added, InmemAddressRepository::addAddresses(p, ma, ttl));
+    store(insert_, p, ma, ttl);
+    return added;
+  }
+
+  outcome::result<bool> SqliteAddressRepository::upsertAddresses(
+      const PeerId &p,
+      std::span<const multi::Multiaddress> ma,
+      Milliseconds ttl) {
+    load(p);
+    OUTCOME_TRY(added, InmemAddressRepository::upsertAddresses(p, ma, ttl));
+    store(upsert_, p, ma, ttl);
+    return added;
+  }
+
+  outcome::result<void> SqliteAddressRepository::updateAddresses(
+      const PeerId &p, Milliseconds ttl) {
+    load(p);
+    OUTCOME_TRY(InmemAddressRepository::updateAddresses(p, ttl));
+    queue_->push([statement = update_,
+                  peer = p.toBytes(),
+                  expires = expiresAt(ttl)](storage::SQLite &db) {
+      return db.execCommand(statement, expires, peer);
+    });
+    return outcome::success();
+  }
+
+  outcome::result<std::vector<multi::Multiaddress>>
+  SqliteAddressRepository::getAddresses(const PeerId &p) const {
+    load(p);
+    return InmemAddressRepository::getAddresses(p);
+  }
+
+  void SqliteAddressRepository::collectGarbage() {
+    InmemAddressRepository::collectGarbage();
+
+    // forgotten peers have no live addresses stored either
+    auto peers = InmemAddressRepository::getPeers();
+    std::erase_if(loaded_,
+                  [&](const PeerId &p) { return not peers.contains(p); });
+
+    queue_->push([statement = delete_expired_,
+                  now = storage::SQLiteWriteQueue::now()](storage::SQLite &db) {
+      return db.execCommand(statement, now);
+    });
+
+    // keys and protocols of peers without live addresses are not kept
+    preparePrune();
+    for (const auto &[_, statement] : prune_) {
+      queue_->push([statement](storage::SQLite &db) {
+        return db.execCommand(statement);
+      });
+    }
+  }
+
+  void SqliteAddressRepository::preparePrune() {
+    auto &db = queue_->db();
+    for (std::string table : {"peer_keys", "peer_protocols"}) {
+      if (prune_.contains(table)) {
+        continue;
+      }
+      int created = 0;
+      db << "SELECT count(*) FROM sqlite_master "
+            "WHERE type = 'table' AND name = ?;"
+         << table >> created;
+      if (created != 0) {
+        prune_.emplace(table,
+                       db.createStatement(
+                           "DELETE FROM " + table
+                           + " WHERE peer NOT IN "
+                             "(SELECT peer FROM peer_addresses);"));
+      }
+    }
+  }
+
+  void SqliteAddressRepository::clear(const PeerId &p) {
+    load(p);
+    InmemAddressRepository::clear(p);
+    queue_->push(
+        [statement = delete_, peer = p.toBytes()](storage::SQLite &db) {
+          return db.execCommand(statement, peer);
+        });
+  }
+
+  std::unordered_set<PeerId> SqliteAddressRepository::getPeers() const {
+    loadAll();
+    return InmemAddressRepository::getPeers();
+  }
+
+}  // namespace libp2p::peer
@@ -23,13 +23,16 @@ namespace libp2p::peer {
   PeerRepositoryImpl::PeerRepositoryImpl(
       std::shared_ptr<AddressRepository> addr_repo,
       std::shared_ptr<KeyRepository> key_repo,
-      std::shared_ptr<ProtocolRepository> protocol_repo)
+      std::shared_ptr<ProtocolRepository> protocol_repo,
+      std::shared_ptr<LatencyRepository> latency_repo)
       : addr_(std::move(addr_repo)),
         key_(std::move(key_repo)),
-        proto_(std::move(protocol_repo)) {
+        proto_(std::move(protocol_repo)),
+        latency_(std::move(latency_repo)) {
     BOOST_ASSERT(addr_ != nullptr);
     BOOST_ASSERT(key_ != nullptr);
     BOOST_ASSERT(proto_ != nullptr);
+    BOOST_ASSERT(latency_ != nullptr);
   }
 
   AddressRepository &PeerRepositoryImpl::getAddressRepository() {
@@ -44,6 +47,10 @@ namespace libp2p::peer {
     return *proto_;
   }
 
+  LatencyRepository &PeerRepositoryImpl::getLatencyRepository() {
+    return *latency_;
+  }
+
   std::unordered_set<PeerId> PeerRepositoryImpl::getPeers() const {
     std::unordered_set<PeerId> peers;
     merge_sets<PeerId>(peers, addr_->getPeers());
@@ -0,0 +1,108 @@
+/**
+ * Copyright Quadrivium LLC
+ * All Rights Reserved
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <libp2p/peer/key_repository/sqlite_key_repository.hpp>
+
+namespace libp2p::peer {
+
+  namespace {
+    crypto::PublicKey publicKey(int type, Bytes data) {
+      crypto::PublicKey key;
+      key.type = static_cast<crypto::Key::Type>(type);
+      key.data = std::move(data);
+      return key;
+    }
+  }  // namespace
+
+  SqliteKeyRepository::SqliteKeyRepository(
+      std::shared_ptr<storage::SQLiteWriteQueue> queue)
+      : queue_(std::move(queue)) {
+    BOOST_ASSERT(queue_ != nullptr);
+    auto &db = queue_->db();
+
+    db << "CREATE TABLE IF NOT EXISTS peer_keys ("
+          "peer BLOB NOT NULL, "
+          "type INTEGER NOT NULL, "
+          "key BLOB NOT NULL, "
+          "PRIMARY KEY (peer, type, key)) WITHOUT ROWID;";
+
+    insert_ = db.createStatement(
+        "INSERT OR IGNORE INTO peer_keys (peer, type, key) VALUES (?, ?, ?);");
+    delete_ = db.createStatement("DELETE FROM peer_keys WHERE peer = ?;");
+    select_ =
+        db.createStatement("SELECT type, key FROM peer_keys WHERE peer = ?;");
+    select_all_ = db.createStatement("SELECT peer, type, key FROM peer_keys;");
+  }
+
+  void SqliteKeyRepository::load(const PeerId &p) const {
+    if (all_loaded_ or not loaded_.emplace(p).second) {
+      return;
+    }
+    // loading doesn't change observable content of repository
+    auto &self = const_cast<SqliteKeyRepository &>(*this);
+    queue_->db().execQuery(
+        select_,
+        [&](int type, Bytes key) {
+          std::ignore = self.InmemKeyRepository::addPublicKey(
+              p, publicKey(type, std::move(key)));
+        },
+        p.toBytes());
+  }
+
+  void SqliteKeyRepository::loadAll() const {
+    if (all_loaded_) {
+      return;
+    }
+    auto &self = const_cast<SqliteKeyRepository &>(*this);
+    auto loaded = loaded_;
+    queue_->db().execQuery(select_all_,
+                           [&](const Bytes &peer, int type, Bytes key) {
+                             auto p = PeerId::fromBytes(peer);
+                             if (p and not loaded.contains(p.value())) {
+                               std::ignore =
+                                   self.InmemKeyRepository::addPublicKey(
+                                       p.value(),
+                                       publicKey(type, std::move(key)));
+                             }
+                           });
+    all_loaded_ = true;
+    loaded_.clear();
+  }
+
+  void SqliteKeyRepository::clear(const PeerId &p) {
+    load(p);
+    InmemKeyRepository::clear(p);
+    queue_->push(
+        [statement = delete_, peer = p.toBytes()](storage::SQLite &db) {
+          return db.execCommand(statement, peer);
+        });
+  }
+
+  outcome::result<SqliteKeyRepository::PubVecPtr>
+  SqliteKeyRepository::getPublicKeys(const PeerId &p) {
+    load(p);
+    return InmemKeyRepository::getPublicKeys(p);
+  }
+
+  outcome::result<void> SqliteKeyRepository::addPublicKey(
+      const PeerId &p, const crypto::PublicKey &pub) {
+    load(p);
+    OUTCOME_TRY(InmemKeyRepository::addPublicKey(p, pub));
+    queue_->push([statement = insert_,
+                  peer = p.toBytes(),
+                  type = static_cast<int>(pub.type),
+                  key = pub.data](storage::SQLite &db) {
+      return db.execCommand(statement, peer, type, key);
+    });
+    return outcome::success();
+  }
+
+  std::unordered_set<PeerId> SqliteKeyRepository::getPeers() const {
+    loadAll();
+    return InmemKeyRepository::getPeers();
+  }
+
+}  // namespace libp2p::peer
@@ -0,0 +1,134 @@
+/**
+ * Copyright Quadrivium LLC
+ * All Rights Reserved
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <libp2p/peer/latency_repository.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+
+namespace libp2p::peer {
+
+  namespace {
+    // smoothing factors of RFC 6298
+    constexpr double kRttGain = 1.0 / 8;
+    constexpr double kRttVarGain = 1.0 / 4;
+
+    // 1/8 of least recently updated entries are evicted at once
+    constexpr size_t kEvictionShare = 8;
+
+    template <typename D>
+    D mix(D average, D sample, double gain) {
+      return std::chrono::duration_cast<D>(
+          std::chrono::duration<double, typename D::period>(
+              average.count() + (sample.count() - average.count()) * gain));
+    }
+  }  // namespace
+
+  LatencyRepository::LatencyRepository() : LatencyRepository(Config{}) {}
+
+  LatencyRepository::LatencyRepository(Config config)
+      : config_(config), random_(std::random_device{}()) {}
+
+  void LatencyRepository::addRoundTrip(const PeerId &peer_id, Duration rtt) {
+    std::lock_guard lock(mutex_);
+    auto &estimate = entry(peer_id).estimate;
+    if (estimate.samples == 0) {
+      estimate.rtt = rtt;
+      estimate.rtt_var = rtt / 2;
+    } else {
+      auto deviation = estimate.rtt > rtt ? estimate.rtt - rtt
+                                          : rtt - estimate.rtt;
+      estimate.rtt_var = mix(estimate.rtt_var, deviation, kRttVarGain);
+      estimate.rtt = mix(estimate.rtt, rtt, kRttGain);
+    }
+    ++estimate.samples;
+  }
+
+  std::optional<LatencyRepository::Estimate> LatencyRepository::getEstimate(
+      const PeerId &peer_id) const {
+    std::lock_guard lock(mutex_);
+    auto it = entries_.find(peer_id);
+    if (it == entries_.end()) {
+      return std::nullopt;
+    }
+    return it->second.estimate;
+  }
+
+  LatencyRepository::Duration LatencyRepository::score(
+      const PeerId &peer_id) const {
+    std::lock_guard lock(mutex_);
+    auto it = entries_.find(peer_id);
+    if (it == entries_.end() or it->second.estimate.samples == 0) {
+      return config_.default_rtt;
+    }
+    const auto &estimate = it->second.estimate;
+    return estimate.rtt + estimate.rtt_var * 4;
+  }
+
+  void LatencyRepository::remove(const PeerId &peer_id) {
+    std::lock_guard lock(mutex_);
+    entries_.erase(peer_id);
+  }
+
+  size_t LatencyRepository::size() const {
+    std::lock_guard lock(mutex_);
+    return entries_.size();
+  }
+
+  std::vector<size_t> LatencyRepository::sample(
+      const std::vector<Duration> &scores, size_t n, Prefer prefer) const {
+    // Efraimidis-Spirakis: key = u^(1/w), n largest keys are selected,
+    // log(key) = log(u) / w is compared instead
+    std::vector<double> keys(scores.size());
+    {
+      std::lock_guard lock(mutex_);
+      std::uniform_real_distribution<double> uniform(0.0, 1.0);
+      for (size_t i = 0; i < scores.size(); ++i) {
+        // 1us floor keeps weights finite
+        auto score = static_cast<double>(std::max<Duration::rep>(
+            scores[i].count(), 1));
+        auto log_u = std::log(1.0 - uniform(random_));
+        keys[i] = prefer == Prefer::LOW_LATENCY ? log_u * score
+                                                : log_u / score;
+      }
+    }
+    std::vector<size_t> indices(scores.size());
+    std::iota(indices.begin(), indices.end(), 0);
+    n = std::min(n, indices.size());
+    std::partial_sort(indices.begin(),
+                      indices.begin() + n,
+                      indices.end(),
+                      [&](size_t a, size_t b) { return keys[a] > keys[b]; });
+    indices.resize(n);
+    return indices;
+  }
+
+  LatencyRepository::Entry &LatencyRepository::entry(const PeerId &peer_id) {
+    auto it = entries_.find(peer_id);
+    if (it == entries_.end()) {
+      if (not entries_.empty() and entries_.size() >= config_.capacity) {
+        std::vector<uint64_t> stamps;
+        stamps.reserve(entries_.size());
+        for (const auto &[_, e] : entries_) {
+          stamps.push_back(e.updated);
+        }
+        auto nth = stamps.begin()
+                 + std::min(stamps.size() - 1,
+                            stamps.size() / kEvictionShare);
+        std::nth_element(stamps.begin(), nth, stamps.end());
+        auto threshold = *nth;
+        std::erase_if(entries_, [threshold](const auto &p) {
+          return p.second.updated <= threshold;
+        });
+      }
+      it = entries_.emplace(peer_id, Entry{}).first;
+    }
+    it->second.updated = ++updates_;
+    return it->second;
+  }
+
+}  // namespace libp2p::peer
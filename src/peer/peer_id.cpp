@@ -26,7 +26,8 @@ namespace libp2p::peer {
   using multi::detail::decodeBase58;
   using multi::detail::encodeBase58;
 
-  PeerId::PeerId(multi::Multihash hash) : hash_{std::move(hash)} {}
+  PeerId::PeerId(multi::Multihash hash)
+      : hash_{std::move(hash)}, base58_{encodeBase58(hash_.toBuffer())} {}
 
   PeerId::FactoryResult PeerId::fromPublicKey(const crypto::ProtobufKey &key) {
     std::vector<uint8_t> hash;
@@ -77,14 +78,19 @@ namespace libp2p::peer {
     return !(*this == other);
   }
 
-  std::string PeerId::toBase58() const {
-    return encodeBase58(hash_.toBuffer());
+  const std::string &PeerId::toBase58() const {
+    return base58_;
   }
 
-  const std::vector<uint8_t> &PeerId::toVector() const {
+  BytesIn PeerId::toVector() const {
     return hash_.toBuffer();
   }
 
+  Bytes PeerId::toBytes() const {
+    auto bytes = toVector();
+    return Bytes(bytes.begin(), bytes.end());
+  }
+
   std::string PeerId::toHex() const {
     return hash_.toHex();
   }
@@ -0,0 +1,134 @@
+/**
+ * Copyright Quadrivium LLC
+ * All Rights Reserved
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <libp2p/peer/protocol_repository/sqlite_protocol_repository.hpp>
+
+namespace libp2p::peer {
+
+  SqliteProtocolRepository::SqliteProtocolRepository(
+      std::shared_ptr<storage::SQLiteWriteQueue> queue)
+      : queue_(std::move(queue)) {
+    BOOST_ASSERT(queue_ != nullptr);
+    auto &db = queue_->db();
+
+    db << "CREATE TABLE IF NOT EXISTS peer_protocols ("
+          "peer BLOB NOT NULL, "
+          "protocol TEXT NOT NULL, "
+          "PRIMARY KEY (peer, protocol)) WITHOUT ROWID;";
+
+    insert_ = db.createStatement(
+        "INSERT OR IGNORE INTO peer_protocols (peer, protocol) "
+        "VALUES (?, ?);");
+    remove_ = db.createStatement(
+        "DELETE FROM peer_protocols WHERE peer = ? AND protocol = ?;");
+    delete_ = db.createStatement("DELETE FROM peer_protocols WHERE peer = ?;");
+    select_ = db.createStatement(
+        "SELECT protocol FROM peer_protocols WHERE peer = ?;");
+    select_all_ =
+        db.createStatement("SELECT peer, protocol FROM peer_protocols;");
+  }
+
+  void SqliteProtocolRepository::load(const PeerId &p) const {
+    if (all_loaded_ or not loaded_.emplace(p).second) {
+      return;
+    }
+    std::vector<ProtocolName> protocols;
+    queue_->db().execQuery(
+        select_,
+        [&](ProtocolName protocol) {
+          protocols.emplace_back(std::move(protocol));
+        },
+        p.toBytes());
+    if (not protocols.empty()) {
+      // loading doesn't change observable content of repository
+      std::ignore = const_cast<SqliteProtocolRepository &>(*this)
+                        .InmemProtocolRepository::addProtocols(p, protocols);
+    }
+  }
+
+  void SqliteProtocolRepository::loadAll() const {
+    if (all_loaded_) {
+      return;
+    }
+    auto &self = const_cast<SqliteProtocolRepository &>(*this);
+    auto loaded = loaded_;
+    queue_->db().execQuery(
+        select_all_, [&](const Bytes &peer, ProtocolName protocol) {
+          auto p = PeerId::fromBytes(peer);
+          if (p and not loaded.contains(p.value())) {
+            std::ignore = self.InmemProtocolRepository::addProtocols(
+                p.value(), std::span(&protocol, 1));
+          }
+        });
+    all_loaded_ = true;
+    loaded_.clear();
+  }
+
+  void SqliteProtocolRepository::store(
+      storage::SQLite::StatementHandle statement,
+      const PeerId &p,
+      std::span<const ProtocolName> ms) {
+    for (const auto &m : ms) {
+      queue_->push(
+          [statement, peer = p.toBytes(), m](storage::SQLite &db) {
+            return db.execCommand(statement, peer, m);
+          });
+    }
+  }
+
+  outcome::result<void> SqliteProtocolRepository::addProtocols(
+      const PeerId &p, std::span<const ProtocolName> ms) {
+    load(p);
+    OUTCOME_TRY(InmemProtocolRepository::addProtocols(p, ms));
+    store(insert_, p, ms);
+    return outcome::success();
+  }
+
+  outcome::result<void> SqliteProtocolRepository::removeProtocols(
+      const PeerId &p, std::span<const ProtocolName> ms) {
+    load(p);
+    OUTCOME_TRY(InmemProtocolRepository::removeProtocols(p, ms));
+    store(remove_, p, ms);
+    return outcome::success();
+  }
+
+  outcome::result<std::vector<ProtocolName>>
+  SqliteProtocolRepository::getProtocols(const PeerId &p) const {
+    load(p);
+    return InmemProtocolRepository::getProtocols(p);
+  }
+
+  outcome::result<std::vector<ProtocolName>>
+  SqliteProtocolRepository::supportsProtocols(
+      const PeerId &p, const std::set<ProtocolName> &protocols) const {
+    load(p);
+    return InmemProtocolRepository::supportsProtocols(p, protocols);
+  }
+
+  void SqliteProtocolRepository::clear(const PeerId &p) {
+    load(p);
+    InmemProtocolRepository::clear(p);
+    queue_->push(
+        [statement = delete_, peer = p.toBytes()](storage::SQLite &db) {
+          return db.execCommand(statement, peer);
+        });
+  }
+
+  void SqliteProtocolRepository::collectGarbage() {
+    InmemProtocolRepository::collectGarbage();
+
+    // forgotten peers have no protocols stored either
+    auto peers = InmemProtocolRepository::getPeers();
+    std::erase_if(loaded_,
+                  [&](const PeerId &p) { return not peers.contains(p); });
+  }
+
+  std::unordered_set<PeerId> SqliteProtocolRepository::getPeers() const {
+    loadAll();
+    return InmemProtocolRepository::getPeers();
+  }
+
+}  // namespace libp2p::peer
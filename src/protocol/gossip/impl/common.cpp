@@ -31,6 +31,8 @@ OUTCOME_CPP_DEFINE_CATEGORY(libp2p::protocol::gossip, Error, e) {
       return "cannot connect to peer";
     case E::VALIDATION_FAILED:
       return "validation failed";
+    case E::WRITER_QUEUE_OVERFLOW:
+      return "stream writer queue overflow";
     default:
       break;
   }
@@ -107,9 +109,26 @@ namespace libp2p::protocol::gossip {
                              uint64_t _seq,
                              Bytes _data,
                              TopicId _topic)
-      : from(_from.toVector()),
+      : from(_from.toVector().begin(), _from.toVector().end()),
         seq_no(createSeqNo(_seq)),
         data(std::move(_data)),
         topic(std::move(_topic)) {}
 
+  const GossipMetrics &GossipMetrics::get() {
+    auto &registry = metrics::Registry::get();
+    static const GossipMetrics metrics{
+        registry.counter("libp2p_gossip_messages_received_total",
+                         "Messages received from peers"),
+        registry.counter("libp2p_gossip_messages_duplicated_total",
+                         "Received messages which were already seen"),
+        registry.counter("libp2p_gossip_messages_forwarded_total",
+                         "Messages forwarded to mesh peers, per peer"),
+        registry.counter("libp2p_gossip_messages_dropped_total",
+                         "Messages dropped from slow peers' outbound queues"),
+        registry.counter("libp2p_gossip_messages_dropped_bytes_total",
+                         "Bytes dropped from slow peers' outbound queues"),
+    };
+    return metrics;
+  }
+
 }  // namespace libp2p::protocol::gossip
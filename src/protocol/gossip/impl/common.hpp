@@ -6,9 +6,11 @@
 
 #pragma once
 
+#include <algorithm>
 #include <cstdint>
 #include <memory>
 
+#include <libp2p/common/metrics/registry.hpp>
 #include <libp2p/protocol/gossip/gossip.hpp>
 
 namespace libp2p::protocol::gossip {
@@ -24,7 +26,8 @@ namespace libp2p::protocol::gossip {
     READER_TIMEOUT,
     WRITER_TIMEOUT,
     CANNOT_CONNECT,
-    VALIDATION_FAILED
+    VALIDATION_FAILED,
+    WRITER_QUEUE_OVERFLOW,
   };
 
   /// Success indicator to be passed in outcome::result
@@ -33,6 +36,9 @@ namespace libp2p::protocol::gossip {
   /// Shared buffer used to broadcast messages
   using SharedBuffer = std::shared_ptr<const Bytes>;
 
+  /// Wire message assembled from shared fragments, written as a whole
+  using SharedBufferChain = std::vector<SharedBuffer>;
+
   /// Time is scheduler's clock and counter
   using Time = std::chrono::milliseconds;
 
@@ -68,6 +74,10 @@ namespace libp2p::protocol::gossip {
     boost::optional<Bytes> signature;
     boost::optional<Bytes> key;
 
+    /// Message encoded as RPC publish field, shared by all peers it is
+    /// forwarded to. Created on first forward, fields must not change after
+    mutable SharedBuffer encoded;
+
     /// Creates a new message from wire or storage
     TopicMessage(Bytes _from, Bytes _seq, Bytes _data);
 
@@ -83,8 +93,8 @@ namespace libp2p::protocol::gossip {
 
   /// Needed for sets and maps
   inline bool less(const peer::PeerId &a, const peer::PeerId &b) {
-    // N.B. toVector returns const std::vector&, i.e. it is fast
-    return a.toVector() < b.toVector();
+    // N.B. toVector returns span of inline bytes, i.e. it is fast
+    return std::ranges::lexicographical_compare(a.toVector(), b.toVector());
   }
 
   /// Tries to cast from message field to peer id
@@ -100,6 +110,17 @@ namespace libp2p::protocol::gossip {
   MessageId createMessageId(const Bytes &from,
                             const Bytes &seq,
                             const Bytes &data);
+
+  /// Message flow metrics
+  struct GossipMetrics {
+    metrics::Counter &received;
+    metrics::Counter &duplicated;
+    metrics::Counter &forwarded;
+    metrics::Counter &dropped;
+    metrics::Counter &dropped_bytes;
+
+    static const GossipMetrics &get();
+  };
 }  // namespace libp2p::protocol::gossip
 
 OUTCOME_HPP_DECLARE_ERROR(libp2p::protocol::gossip, Error);
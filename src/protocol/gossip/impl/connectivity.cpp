@@ -32,13 +32,18 @@ namespace libp2p::protocol::gossip {
                              std::shared_ptr<MessageReceiver> msg_receiver,
                              ConnectionStatusFeedback on_connected)
       : config_(std::move(config)),
+        protocols_{config_.idontwant_protocol_version},
         scheduler_(std::move(scheduler)),
         host_(std::move(host)),
         msg_receiver_(std::move(msg_receiver)),
         connected_cb_(std::move(on_connected)),
         log_("gossip",
              "Connectivity",
-             host_->getPeerInfo().id.toBase58().substr(46)) {}
+             host_->getPeerInfo().id.toBase58().substr(46)) {
+    if (config_.protocol_version != config_.idontwant_protocol_version) {
+      protocols_.push_back(config_.protocol_version);
+    }
+  }
 
   Connectivity::~Connectivity() {
     stop();
@@ -58,7 +63,7 @@ namespace libp2p::protocol::gossip {
         };
 
     host_->setProtocolHandler(
-        {config_.protocol_version},
+        protocols_,
         [self_wptr=weak_from_this()]
             (StreamAndProtocol stream) {
           auto h = self_wptr.lock();
@@ -232,7 +237,7 @@ namespace libp2p::protocol::gossip {
     // clang-format off
     host_->newStream(
         pi,
-        {config_.protocol_version},
+        protocols_,
         [wptr = weak_from_this(), this, ctx=ctx] (auto &&rstream) mutable {
             auto self = wptr.lock();
           if (self) {
@@ -254,7 +259,7 @@ namespace libp2p::protocol::gossip {
     // clang-format off
     host_->newStream(
         ctx->peer_id,
-        {config_.protocol_version},
+        protocols_,
         [wptr = weak_from_this(), this, ctx=ctx] (auto &&rstream) mutable {
           auto self = wptr.lock();
           if (self) {
@@ -286,6 +291,9 @@ namespace libp2p::protocol::gossip {
       return;
     }
 
+    ctx->accepts_idontwant =
+        rstream.value().protocol == config_.idontwant_protocol_version;
+
     // no remote peer id means dead stream
     auto peer_res = stream->remotePeerId();
     if (!peer_res) {
@@ -490,4 +498,8 @@ namespace libp2p::protocol::gossip {
     return connected_peers_;
   }
 
+  const peer::LatencyRepository &Connectivity::getLatencyRepository() const {
+    return host_->getPeerRepository().getLatencyRepository();
+  }
+
 }  // namespace libp2p::protocol::gossip
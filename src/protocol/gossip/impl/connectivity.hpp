@@ -64,6 +64,9 @@ namespace libp2p::protocol::gossip {
     /// Returns connected peers
     const PeerSet &getConnectedPeers() const;
 
+    /// Returns latency estimates of peers
+    const peer::LatencyRepository &getLatencyRepository() const;
+
    private:
     using BannedPeers = std::set<std::pair<Time, PeerContextPtr>>;
 
@@ -100,6 +103,10 @@ namespace libp2p::protocol::gossip {
     void flush(const PeerContextPtr &ctx) const;
 
     const Config config_;
+
+    /// Protocols advertised and dialed, preferred one first
+    StreamProtocols protocols_;
+
     std::shared_ptr<basic::Scheduler> scheduler_;
     std::shared_ptr<Host> host_;
     std::shared_ptr<MessageReceiver> msg_receiver_;
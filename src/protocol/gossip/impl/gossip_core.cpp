@@ -55,8 +55,11 @@ namespace libp2p::protocol::gossip {
         local_peer_id_(host_->getPeerInfo().id),
         msg_cache_(
             config_.message_cache_lifetime_msec,
+            config_.heartbeat_interval_msec,
             [sch = scheduler_] { return sch->now(); }
         ),
+        seen_cache_(config_.seen_cache_lifetime_msec,
+                    config_.seen_cache_capacity),
         local_subscriptions_(std::make_shared<LocalSubscriptions>(
             [this](bool subscribe, const TopicId &topic) {
               onLocalSubscriptionChanged(subscribe, topic);
@@ -109,7 +112,18 @@ namespace libp2p::protocol::gossip {
     }
 
     remote_subscriptions_ = std::make_shared<RemoteSubscriptions>(
-        config_, *connectivity_, *scheduler_, log_);
+        config_, *connectivity_, msg_cache_, *scheduler_, log_);
+
+    if (config_.verify_signatures) {
+      verifier_ = std::make_shared<SignatureVerifier>(
+          config_,
+          scheduler_,
+          crypto_provider_,
+          key_marshaller_,
+          [this](std::vector<SignatureVerifier::Verified> &verified) {
+            onMessagesVerified(verified);
+          });
+    }
 
     started_ = true;
 
@@ -134,6 +148,8 @@ namespace libp2p::protocol::gossip {
     // it closes all senders and receivers
     connectivity_->stop();
 
+    // pending verifications are dropped
+    verifier_.reset();
     remote_subscriptions_.reset();
     connectivity_.reset();
 
@@ -177,6 +193,7 @@ namespace libp2p::protocol::gossip {
 
     MessageId msg_id = create_message_id_(msg->from, msg->seq_no, msg->data);
 
+    seen_cache_.insert(msg_id, scheduler_->now());
     [[maybe_unused]] bool inserted = msg_cache_.insert(msg, msg_id);
     assert(inserted);
 
@@ -226,7 +243,7 @@ namespace libp2p::protocol::gossip {
     log_.debug("peer {} has msg for topic {}", from->str, topic);
 
     if (remote_subscriptions_->hasTopic(topic)
-        && !msg_cache_.contains(msg_id)) {
+        && !seen_cache_.contains(msg_id)) {
       log_.debug("requesting msg id {:x}", msg_id);
 
       from->message_builder->addIWant(msg_id);
@@ -247,6 +264,18 @@ namespace libp2p::protocol::gossip {
     }
   }
 
+  void GossipCore::onIDontWant(const PeerContextPtr &from,
+                               const MessageId &msg_id) {
+    log_.debug("peer {} doesn't want message {:x}", from->str, msg_id);
+
+    if (!from->dont_send) {
+      from->dont_send.emplace(config_.idontwant_lifetime_msec,
+                              config_.idontwant_limit);
+    }
+    from->dont_send->insert(msg_id, scheduler_->now());
+    from->message_builder->removeMessage(msg_id);
+  }
+
   void GossipCore::onGraft(const PeerContextPtr &from, const TopicId &topic) {
     assert(started_);
 
@@ -278,13 +307,49 @@ namespace libp2p::protocol::gossip {
 
     MessageId msg_id = create_message_id_(msg->from, msg->seq_no, msg->data);
     log_.debug("message arrived, msg id={:x}", msg_id);
+    GossipMetrics::get().received.inc();
 
-    if (msg_cache_.contains(msg_id)) {
-      // already there, ignore
-      log_.debug("ignoring message, already in cache");
+    if (seen_cache_.contains(msg_id)) {
+      // already seen on this or another topic, ignore
+      log_.debug("ignoring message, already seen");
+      GossipMetrics::get().duplicated.inc();
+      return;
+    }
+
+    if (config_.idontwant_message_size != 0
+        && msg->data.size() >= config_.idontwant_message_size) {
+      remote_subscriptions_->sendIDontWant(from, msg->topic, msg_id);
+    }
+
+    if (verifier_) {
+      verifier_->verify(from, std::move(msg), std::move(msg_id));
       return;
     }
 
+    onVerifiedMessage(from, msg, msg_id);
+  }
+
+  void GossipCore::onMessagesVerified(
+      std::vector<SignatureVerifier::Verified> &verified) {
+    if (!started_) {
+      return;
+    }
+
+    for (auto &v : verified) {
+      if (!v.valid) {
+        log_.debug("message signature verification failed, msg id={:x}",
+                   v.msg_id);
+        continue;
+      }
+      onVerifiedMessage(v.from, v.msg, v.msg_id);
+    }
+
+    connectivity_->flush();
+  }
+
+  void GossipCore::onVerifiedMessage(const PeerContextPtr &from,
+                                     const TopicMessage::Ptr &msg,
+                                     const MessageId &msg_id) {
     // validate message. If no validator is set then we
     // suppose that the message is valid (we might not know topic details)
     bool valid = true;
@@ -301,8 +366,18 @@ namespace libp2p::protocol::gossip {
       return;
     }
 
+    // invalid copies must not make the valid one be ignored
+    if (!seen_cache_.insert(msg_id, scheduler_->now())) {
+      // another copy was verified and validated in the meantime
+      log_.debug("ignoring message, already seen");
+      GossipMetrics::get().duplicated.inc();
+      return;
+    }
+
     if (!msg_cache_.insert(msg, msg_id)) {
-      log_.error("message cache error");
+      // seen cache forgot it earlier than message cache under load
+      log_.debug("ignoring message, already in cache");
+      GossipMetrics::get().duplicated.inc();
       return;
     }
 
@@ -324,8 +399,9 @@ namespace libp2p::protocol::gossip {
   void GossipCore::onHeartbeat() {
     assert(started_);
 
-    // shift cache
+    // shift caches
     msg_cache_.shift();
+    seen_cache_.rotate(scheduler_->now());
 
     // heartbeat changes per topic
     remote_subscriptions_->onHeartbeat();
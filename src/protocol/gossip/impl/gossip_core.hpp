@@ -17,6 +17,8 @@
 #include "message_cache.hpp"
 #include "message_receiver.hpp"
 #include "peer_set.hpp"
+#include "seen_cache.hpp"
+#include "signature_verifier.hpp"
 
 namespace libp2p::protocol::gossip {
 
@@ -68,6 +70,8 @@ namespace libp2p::protocol::gossip {
                  const TopicId &topic,
                  const MessageId &msg_id) override;
     void onIWant(const PeerContextPtr &from, const MessageId &msg_id) override;
+    void onIDontWant(const PeerContextPtr &from,
+                     const MessageId &msg_id) override;
     void onGraft(const PeerContextPtr &from, const TopicId &topic) override;
     void onPrune(const PeerContextPtr &from,
                  const TopicId &topic,
@@ -76,6 +80,14 @@ namespace libp2p::protocol::gossip {
                         TopicMessage::Ptr msg) override;
     void onMessageEnd(const PeerContextPtr &from) override;
 
+    /// Verdicts of signature verifier arrived
+    void onMessagesVerified(std::vector<SignatureVerifier::Verified> &verified);
+
+    /// Validates and forwards message which passed signature check
+    void onVerifiedMessage(const PeerContextPtr &from,
+                           const TopicMessage::Ptr &msg,
+                           const MessageId &msg_id);
+
     /// Periodic heartbeat timer fn
     void onHeartbeat();
 
@@ -115,6 +127,9 @@ namespace libp2p::protocol::gossip {
     /// Message cache w/expiration
     MessageCache msg_cache_;
 
+    /// Ids of messages received or published, to drop duplicates
+    SeenCache seen_cache_;
+
     /// Local subscriptions manager (this host subscribed to topics)
     std::shared_ptr<LocalSubscriptions> local_subscriptions_;
 
@@ -132,6 +147,9 @@ namespace libp2p::protocol::gossip {
     /// Network part of gossip component
     std::shared_ptr<Connectivity> connectivity_;
 
+    /// Verifies signatures of received messages if configured
+    std::shared_ptr<SignatureVerifier> verifier_;
+
     /// Local {un}subscribe changes to be broadcasted to peers
     std::map<TopicId, bool> broadcast_on_heartbeat_;
 
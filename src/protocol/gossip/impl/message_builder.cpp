@@ -18,6 +18,18 @@ namespace libp2p::protocol::gossip {
       // NOLINTNEXTLINE
       return reinterpret_cast<const char *>(bytes.data());
     }
+
+    /// Key of RPC publish field, wire type 2 is length-delimited
+    constexpr uint8_t kPublishTag = (pubsub::pb::RPC::kPublishFieldNumber << 3)
+                                  | 2;
+
+    /// Message fields which are covered by signature
+    void setSignedFields(pubsub::pb::Message &pb_msg, const TopicMessage &msg) {
+      pb_msg.set_from(msg.from.data(), msg.from.size());
+      pb_msg.set_data(msg.data.data(), msg.data.size());
+      pb_msg.set_seqno(msg.seq_no.data(), msg.seq_no.size());
+      pb_msg.set_topic(msg.topic);
+    }
   }  // namespace
 
   MessageBuilder::MessageBuilder() : empty_(true), control_not_empty_(false) {}
@@ -31,6 +43,10 @@ namespace libp2p::protocol::gossip {
     control_not_empty_ = false;
     ihaves_.clear();
     iwant_.clear();
+    idontwant_.clear();
+    publish_.clear();
+    publish_error_ = false;
+    publish_removed_ = 0;
     messages_added_.clear();
   }
 
@@ -41,6 +57,10 @@ namespace libp2p::protocol::gossip {
     control_not_empty_ = false;
     decltype(ihaves_){}.swap(ihaves_);
     decltype(iwant_){}.swap(iwant_);
+    decltype(idontwant_){}.swap(idontwant_);
+    decltype(publish_){}.swap(publish_);
+    publish_error_ = false;
+    publish_removed_ = 0;
     decltype(messages_added_){}.swap(messages_added_);
   }
 
@@ -55,7 +75,7 @@ namespace libp2p::protocol::gossip {
     return empty_;
   }
 
-  outcome::result<SharedBuffer> MessageBuilder::serialize() {
+  outcome::result<SharedBufferChain> MessageBuilder::serialize() {
     create_protobuf_structures();
 
     for (auto &[topic, message_ids] : ihaves_) {
@@ -73,37 +93,63 @@ namespace libp2p::protocol::gossip {
       }
     }
 
+    if (!idontwant_.empty()) {
+      auto *idw = control_pb_msg_->add_idontwant();
+      for (auto &mid : idontwant_) {
+        idw->add_messageids(toString(mid), mid.size());
+      }
+    }
+
     if (control_not_empty_) {
       pb_msg_->set_allocated_control(control_pb_msg_.get());
     }
 
-    size_t msg_sz = pb_msg_->ByteSizeLong();
+    // repeated fields may come in any order, so encoded messages are
+    // appended after subscriptions and control
+    size_t head_sz = pb_msg_->ByteSizeLong();
+    size_t msg_sz = head_sz;
+    for (auto &publish : publish_) {
+      if (publish) {
+        msg_sz += publish->size();
+      }
+    }
 
     auto varint_len = multi::UVarint{msg_sz};
     auto varint_vec = varint_len.toVector();
     size_t prefix_sz = varint_vec.size();
 
     auto buffer = std::make_shared<Bytes>();
-    buffer->resize(prefix_sz + msg_sz);
+    buffer->resize(prefix_sz + head_sz);
     memcpy(buffer->data(), varint_vec.data(), prefix_sz);
 
-    bool success =
-        // NOLINTNEXTLINE
-        pb_msg_->SerializeToArray(buffer->data() + prefix_sz, msg_sz);
+    bool success = not publish_error_
+               and pb_msg_->SerializeToArray(
+                   // NOLINTNEXTLINE
+                   buffer->data() + prefix_sz,
+                   static_cast<int>(head_sz));
 
     if (control_not_empty_) {
       std::ignore = pb_msg_->release_control();
     }
 
+    SharedBufferChain chain;
+    chain.reserve(1 + publish_.size());
+    chain.emplace_back(std::move(buffer));
+    for (auto &publish : publish_) {
+      if (publish) {
+        chain.emplace_back(std::move(publish));
+      }
+    }
+
     static constexpr size_t kSizeThreshold = 8192;
-    if (msg_sz > kSizeThreshold) {
+    if (head_sz > kSizeThreshold) {
       reset();
     } else {
       clear();
     }
 
     if (success) {
-      return buffer;
+      return chain;
     }
     return Error::MESSAGE_SERIALIZE_ERROR;
   }
@@ -129,6 +175,12 @@ namespace libp2p::protocol::gossip {
     empty_ = false;
   }
 
+  void MessageBuilder::addIDontWant(const MessageId &msg_id) {
+    idontwant_.push_back(msg_id);
+    control_not_empty_ = true;
+    empty_ = false;
+  }
+
   void MessageBuilder::addGraft(const TopicId &topic) {
     create_protobuf_structures();
 
@@ -149,34 +201,72 @@ namespace libp2p::protocol::gossip {
                                   const MessageId &msg_id) {
     create_protobuf_structures();
 
-    if (messages_added_.count(msg_id) != 0) {
+    if (!messages_added_.emplace(msg_id, publish_.size()).second) {
       // prevent duplicates
       return;
     }
-    messages_added_.insert(msg_id);
 
-    auto *dst = pb_msg_->add_publish();
-    dst->set_from(msg.from.data(), msg.from.size());
-    dst->set_data(msg.data.data(), msg.data.size());
-    dst->set_seqno(msg.seq_no.data(), msg.seq_no.size());
-    dst->set_topic(msg.topic);
+    if (auto encoded = encodePublish(msg)) {
+      publish_.emplace_back(std::move(encoded.value()));
+    } else {
+      publish_.emplace_back();
+      publish_error_ = true;
+    }
+    empty_ = false;
+  }
+
+  void MessageBuilder::removeMessage(const MessageId &msg_id) {
+    auto it = messages_added_.find(msg_id);
+    if (it == messages_added_.end()) {
+      return;
+    }
+    auto &publish = publish_[it->second];
+    if (!publish) {
+      return;
+    }
+    publish.reset();
+    ++publish_removed_;
+    if (publish_removed_ == publish_.size() and not control_not_empty_
+        and pb_msg_->subscriptions_size() == 0) {
+      // nothing left to send
+      clear();
+    }
+  }
+
+  outcome::result<SharedBuffer> MessageBuilder::encodePublish(
+      const TopicMessage &msg) {
+    if (msg.encoded) {
+      return msg.encoded;
+    }
+    pubsub::pb::Message pb_msg;
+    setSignedFields(pb_msg, msg);
     if (msg.signature) {
-      dst->set_signature(msg.signature.value().data(),
-                         msg.signature.value().size());
+      pb_msg.set_signature(msg.signature.value().data(),
+                           msg.signature.value().size());
     }
     if (msg.key) {
-      dst->set_key(msg.key.value().data(), msg.key.value().size());
+      pb_msg.set_key(msg.key.value().data(), msg.key.value().size());
     }
-    empty_ = false;
+    auto size = pb_msg.ByteSizeLong();
+    auto varint_len = multi::UVarint{size};
+    auto prefix = varint_len.toBytes();
+    auto buffer = std::make_shared<Bytes>();
+    buffer->reserve(1 + prefix.size() + size);
+    buffer->push_back(kPublishTag);
+    buffer->insert(buffer->end(), prefix.begin(), prefix.end());
+    auto offset = buffer->size();
+    buffer->resize(offset + size);
+    if (!pb_msg.SerializeToArray(&(*buffer)[offset], static_cast<int>(size))) {
+      return Error::MESSAGE_SERIALIZE_ERROR;
+    }
+    msg.encoded = std::move(buffer);
+    return msg.encoded;
   }
 
   outcome::result<Bytes> MessageBuilder::signableMessage(
       const TopicMessage &msg) {
     pubsub::pb::Message pb_msg;
-    pb_msg.set_from(msg.from.data(), msg.from.size());
-    pb_msg.set_data(msg.data.data(), msg.data.size());
-    pb_msg.set_seqno(msg.seq_no.data(), msg.seq_no.size());
-    pb_msg.set_topic(msg.topic);
+    setSignedFields(pb_msg, msg);
     constexpr std::string_view kPrefix{"libp2p-pubsub:"};
     auto size = pb_msg.ByteSizeLong();
     Bytes signable;
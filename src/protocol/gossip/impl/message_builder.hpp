@@ -7,7 +7,7 @@
 #pragma once
 
 #include <map>
-#include <unordered_set>
+#include <unordered_map>
 
 #include "common.hpp"
 
@@ -38,8 +38,9 @@ namespace libp2p::protocol::gossip {
     /// Returns true if nothing added
     bool empty() const;
 
-    /// Serializes into byte buffer and clears internal state
-    outcome::result<SharedBuffer> serialize();
+    /// Serializes into chain of buffers and clears internal state.
+    /// Messages are not copied, chain refers to their shared encoding
+    outcome::result<SharedBufferChain> serialize();
 
     /// Adds subscription notification
     void addSubscription(bool subscribe, const TopicId &topic);
@@ -50,6 +51,9 @@ namespace libp2p::protocol::gossip {
     /// Adds "I want" request
     void addIWant(const MessageId &msg_id);
 
+    /// Adds "I don't want" notification
+    void addIDontWant(const MessageId &msg_id);
+
     /// Adds graft request
     void addGraft(const TopicId &topic);
 
@@ -59,8 +63,14 @@ namespace libp2p::protocol::gossip {
     /// Adds message to be forwarded
     void addMessage(const TopicMessage &msg, const MessageId &msg_id);
 
+    /// Drops message added but not serialized yet, peer doesn't want it
+    void removeMessage(const MessageId &msg_id);
+
     static outcome::result<Bytes> signableMessage(const TopicMessage &msg);
 
+    /// Returns message encoded as RPC publish field, encodes it on first call
+    static outcome::result<SharedBuffer> encodePublish(const TopicMessage &msg);
+
    private:
     /// Creates protobuf structures if needed
     void create_protobuf_structures();
@@ -80,7 +90,20 @@ namespace libp2p::protocol::gossip {
     /// Intermediate struct for building IWant request
     std::vector<MessageId> iwant_;
 
-    /// Used to prevent duplicate forwarding
-    std::unordered_set<MessageId> messages_added_;
+    /// Intermediate struct for building IDontWant notification
+    std::vector<MessageId> idontwant_;
+
+    /// Encoded messages to be spliced into RPC, removed ones are null
+    SharedBufferChain publish_;
+
+    /// Set if a message could not be encoded
+    bool publish_error_ = false;
+
+    /// Number of messages removed from publish_
+    size_t publish_removed_ = 0;
+
+    /// Used to prevent duplicate forwarding, values are positions in
+    /// publish_
+    std::unordered_map<MessageId, size_t> messages_added_;
   };
 }  // namespace libp2p::protocol::gossip
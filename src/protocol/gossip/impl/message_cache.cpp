@@ -6,11 +6,10 @@
 
 #include "message_cache.hpp"
 
+#include <bit>
 #include <cassert>
+#include <string_view>
 
-#include <boost/multi_index/hashed_index.hpp>
-#include <boost/multi_index/ordered_index.hpp>
-#include <boost/multi_index_container.hpp>
 #include <qtils/hex.hpp>
 
 #define TRACE_ENABLED 0
@@ -18,28 +17,75 @@
 
 namespace libp2p::protocol::gossip {
 
-  MessageCache::MessageCache(Time message_lifetime, TimeFunction clock)
-      : message_lifetime_(message_lifetime), clock_(std::move(clock)) {
-    assert(message_lifetime_ > Time::zero());
-    table_ = std::make_unique<msg_cache_table::Table>();
+  namespace {
+    size_t hashOf(BytesIn id) {
+      auto h = std::hash<std::string_view>{}(
+          {reinterpret_cast<const char *>(id.data()), id.size()});
+      // 0 marks empty index slot
+      return h == 0 ? 1 : h;
+    }
+  }  // namespace
+
+  MessageCache::MessageCache(Time message_lifetime,
+                             Time window,
+                             TimeFunction clock)
+      : window_span_(window), clock_(std::move(clock)) {
+    assert(message_lifetime > Time::zero());
+    assert(window_span_ > Time::zero());
+    // one more window for the current one, so that messages live at least
+    // message_lifetime
+    windows_.resize((message_lifetime + window_span_ - Time{1}) / window_span_
+                    + 1);
+    current_ends_ = clock_() + window_span_;
   }
 
   MessageCache::~MessageCache() = default;
 
+  bool MessageCache::isLive(uint64_t window) const {
+    return window <= current_ and current_ - window < windows_.size();
+  }
+
+  BytesIn MessageCache::idOf(const Window &window,
+                             const Record &record) const {
+    return BytesIn{window.ids}.subspan(record.id_offset, record.id_size);
+  }
+
+  const MessageCache::Record *MessageCache::find(BytesIn id,
+                                                 size_t hash) const {
+    if (index_.empty()) {
+      return nullptr;
+    }
+    auto mask = index_.size() - 1;
+    for (auto i = hash & mask;; i = (i + 1) & mask) {
+      const auto &slot = index_[i];
+      if (slot.hash == 0) {
+        return nullptr;
+      }
+      if (slot.hash != hash or not isLive(slot.window)) {
+        continue;
+      }
+      const auto &window = windows_[slot.window % windows_.size()];
+      const auto &record = window.records[slot.record];
+      auto record_id = idOf(window, record);
+      if (std::equal(
+              record_id.begin(), record_id.end(), id.begin(), id.end())) {
+        return &record;
+      }
+    }
+  }
+
   bool MessageCache::contains(const MessageId &id) const {
-    return table_->get<ById>().count(id) != 0;
+    return find(id, hashOf(id)) != nullptr;
   }
 
   boost::optional<TopicMessage::Ptr> MessageCache::getMessage(
       const MessageId &id) const {
-    auto &idx = table_->get<ById>();
-    auto it = idx.find(id);
-    if (it == idx.end()) {
-      TRACE(
-          "MessageCache: {:X} not found, current size {}", id, table_->size());
+    auto record = find(id, hashOf(id));
+    if (record == nullptr) {
+      TRACE("MessageCache: {:X} not found, current size {}", id, size_);
       return boost::none;
     }
-    return it->message;
+    return record->message;
   }
 
   bool MessageCache::insert(TopicMessage::Ptr message,
@@ -47,35 +93,107 @@ namespace libp2p::protocol::gossip {
     if (!message || msg_id.empty()) {
       return false;
     }
-    auto &idx = table_->get<ById>();
-    auto it = idx.find(msg_id);
-    if (it != idx.end()) {
+    advance(clock_());
+    auto hash = hashOf(msg_id);
+    if (find(msg_id, hash) != nullptr) {
       return false;
     }
-    auto now = clock_();
-    idx.insert({msg_id, now + message_lifetime_, std::move(message)});
+    // keep load factor at most 3/4, expired slots included
+    if ((index_used_ + 1) * 4 > index_.size() * 3) {
+      rehash(size_ + 1);
+    }
+
+    auto &window = windows_[current_ % windows_.size()];
+    window.records.push_back({
+        .hash = hash,
+        .id_offset = static_cast<uint32_t>(window.ids.size()),
+        .id_size = static_cast<uint32_t>(msg_id.size()),
+        .message = std::move(message),
+    });
+    window.ids.insert(window.ids.end(), msg_id.begin(), msg_id.end());
+    ++size_;
+
+    auto mask = index_.size() - 1;
+    auto i = hash & mask;
+    while (index_[i].hash != 0 and isLive(index_[i].window)) {
+      i = (i + 1) & mask;
+    }
+    if (index_[i].hash == 0) {
+      ++index_used_;
+    }
+    index_[i] = {
+        .hash = hash,
+        .window = current_,
+        .record = static_cast<uint32_t>(window.records.size() - 1),
+    };
     return true;
   }
 
   void MessageCache::shift() {
-    auto &idx = table_->get<ByTimestamp>();
-    if (idx.empty()) {
-      return;
+    TRACE("MessageCache: size before shift: {}", size_);
+    advance(clock_());
+    TRACE("MessageCache: size after shift: {}", size_);
+  }
+
+  std::vector<MessageId> MessageCache::recentIds(const TopicId &topic,
+                                                 size_t windows,
+                                                 size_t limit) const {
+    std::vector<MessageId> ids;
+    windows = std::min<uint64_t>({windows, windows_.size(), current_ + 1});
+    for (size_t n = 0; n < windows; ++n) {
+      const auto &window = windows_[(current_ - n) % windows_.size()];
+      for (auto it = window.records.rbegin(); it != window.records.rend();
+           ++it) {
+        if (ids.size() >= limit) {
+          return ids;
+        }
+        if (it->message->topic == topic) {
+          auto id = idOf(window, *it);
+          ids.emplace_back(id.begin(), id.end());
+        }
+      }
     }
-    auto now = clock_();
+    return ids;
+  }
 
-    TRACE("MessageCache: size before shift: {}", table_->size());
+  size_t MessageCache::size() const {
+    return size_;
+  }
 
-    if (idx.rbegin()->expires_at < now) {
-      table_->clear();
-    } else {
-      auto expired_until = idx.lower_bound(now);
-      if (expired_until != idx.end()) {
-        idx.erase(idx.begin(), expired_until);
-      }
+  void MessageCache::advance(Time now) {
+    if (now < current_ends_) {
+      return;
+    }
+    uint64_t steps = (now - current_ends_) / window_span_ + 1;
+    current_ends_ += window_span_ * steps;
+    for (uint64_t i = 0; i < std::min<uint64_t>(steps, windows_.size()); ++i) {
+      auto &window = windows_[(current_ + i + 1) % windows_.size()];
+      size_ -= window.records.size();
+      // capacity is kept for the next use of the window
+      window.records.clear();
+      window.ids.clear();
     }
+    current_ += steps;
+  }
 
-    TRACE("MessageCache: size after shift: {}", table_->size());
+  void MessageCache::rehash(size_t n) {
+    std::vector<Slot> index(std::max<size_t>(16, std::bit_ceil(n * 2)));
+    auto mask = index.size() - 1;
+    for (uint64_t w = current_ + 1 - std::min<uint64_t>(windows_.size(),
+                                                        current_ + 1);
+         w <= current_;
+         ++w) {
+      const auto &records = windows_[w % windows_.size()].records;
+      for (uint32_t r = 0; r < records.size(); ++r) {
+        auto i = records[r].hash & mask;
+        while (index[i].hash != 0) {
+          i = (i + 1) & mask;
+        }
+        index[i] = {.hash = records[r].hash, .window = w, .record = r};
+      }
+    }
+    index_ = std::move(index);
+    index_used_ = size_;
   }
 
 }  // namespace libp2p::protocol::gossip
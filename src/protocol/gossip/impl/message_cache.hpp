@@ -8,51 +8,23 @@
 
 #include <functional>
 
-#include <boost/multi_index/hashed_index_fwd.hpp>
-#include <boost/multi_index/member.hpp>
-#include <boost/multi_index/ordered_index_fwd.hpp>
-#include <boost/multi_index_container_fwd.hpp>
-
 #include "common.hpp"
 
 namespace libp2p::protocol::gossip {
 
-  struct ById;
-  struct ByTimestamp;
-
-  namespace msg_cache_table {
-
-    namespace mi = boost::multi_index;
-
-    struct Record {
-      MessageId message_id;
-      Time expires_at;
-      TopicMessage::Ptr message;
-    };
-
-    /// Table of Record with 2 indices (by key and expire time)
-    using Table = boost::multi_index_container<
-        Record,
-        mi::indexed_by<
-            // hashed_non_unique by id means unordered index
-            mi::hashed_unique<
-                mi::tag<ById>,
-                mi::member<Record, MessageId, &Record::message_id>,
-                std::hash<MessageId>>,
-            // ordered_non_unique by time means accending order
-            mi::ordered_non_unique<
-                mi::tag<ByTimestamp>,
-                mi::member<Record, Time, &Record::expires_at>>>>;
-
-  }  // namespace msg_cache_table
-
-  /// Message cache with expiration
+  /**
+   * Message cache with expiration, organized as a ring of time windows
+   * (heartbeat intervals in gossip). Records and ids of a window are kept
+   * in contiguous storage which is reused when the window expires, ids are
+   * interned once per window and indexed by small handles. Whole windows
+   * expire at once, messages live at least message_lifetime
+   */
   class MessageCache {
    public:
     /// External time function
     using TimeFunction = std::function<Time()>;
 
-    MessageCache(Time message_lifetime, TimeFunction clock);
+    MessageCache(Time message_lifetime, Time window, TimeFunction clock);
 
     ~MessageCache();
 
@@ -64,13 +36,69 @@ namespace libp2p::protocol::gossip {
     /// Inserts a new message into cache. If already there, returns false
     bool insert(TopicMessage::Ptr message, const MessageId &msg_id);
 
-    /// Purges expired messages and updates seen notification data
+    /// Purges expired windows
     void shift();
 
+    /// Returns ids of topic messages from the most recent windows, newest
+    /// first, up to limit
+    std::vector<MessageId> recentIds(const TopicId &topic,
+                                     size_t windows,
+                                     size_t limit) const;
+
+    /// Number of messages cached
+    size_t size() const;
+
    private:
-    const Time message_lifetime_;
+    struct Record {
+      size_t hash;
+      uint32_t id_offset;
+      uint32_t id_size;
+      TopicMessage::Ptr message;
+    };
+
+    struct Window {
+      std::vector<Record> records;
+
+      /// Interned message ids
+      Bytes ids;
+    };
+
+    /// Index slot, refers to record by absolute window number and position.
+    /// Slots of expired windows are reused on insert
+    struct Slot {
+      size_t hash = 0;
+      uint64_t window = 0;
+      uint32_t record = 0;
+    };
+
+    bool isLive(uint64_t window) const;
+
+    BytesIn idOf(const Window &window, const Record &record) const;
+
+    /// Returns record by id if found
+    const Record *find(BytesIn id, size_t hash) const;
+
+    /// Moves current window forward if it is time
+    void advance(Time now);
+
+    /// Rebuilds index from live windows with capacity for at least n records
+    void rehash(size_t n);
+
+    const Time window_span_;
     TimeFunction clock_;
-    std::unique_ptr<msg_cache_table::Table> table_;
+    std::vector<Window> windows_;
+
+    /// Absolute number of current window, its ring position is
+    /// current_ % windows_.size()
+    uint64_t current_ = 0;
+    Time current_ends_{};
+    size_t size_ = 0;
+
+    /// Open addressing index of records
+    std::vector<Slot> index_;
+
+    /// Non-empty slots, both live and expired
+    size_t index_used_ = 0;
   };
 
 }  // namespace libp2p::protocol::gossip
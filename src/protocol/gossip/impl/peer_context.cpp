@@ -22,6 +22,10 @@ namespace libp2p::protocol::gossip {
         str(makeStringRepr(peer_id)),
         message_builder(std::make_shared<MessageBuilder>()) {}
 
+  bool PeerContext::dontSend(const MessageId &msg_id) const {
+    return dont_send && dont_send->contains(msg_id);
+  }
+
   bool operator<(const PeerContextPtr &ctx, const peer::PeerId &peer) {
     if (!ctx) {
       return false;
@@ -6,9 +6,12 @@
 
 #pragma once
 
+#include <optional>
+
 #include <libp2p/common/metrics/instance_count.hpp>
 
 #include "common.hpp"
+#include "seen_cache.hpp"
 
 namespace libp2p::protocol::gossip {
 
@@ -42,6 +45,16 @@ namespace libp2p::protocol::gossip {
     /// If true, then outbound connection is in progress
     bool is_connecting = false;
 
+    /// Outbound stream negotiated protocol version supporting IDONTWANT
+    bool accepts_idontwant = false;
+
+    /// Ids of messages this peer asked not to send (IDONTWANT),
+    /// created on first request
+    std::optional<SeenCache> dont_send;
+
+    /// Returns true if peer asked not to send this message
+    bool dontSend(const MessageId &msg_id) const;
+
     ~PeerContext() = default;
     PeerContext(PeerContext &&) = delete;
     PeerContext(const PeerContext &) = delete;
@@ -69,6 +69,19 @@ namespace libp2p::protocol::gossip {
     return ret;
   }
 
+  std::vector<PeerContextPtr> PeerSet::selectPeersByLatency(
+      size_t n,
+      const peer::LatencyRepository &latency,
+      peer::LatencyRepository::Prefer prefer) const {
+    return latency.select(
+        std::vector<PeerContextPtr>(peers_.begin(), peers_.end()),
+        n,
+        [](const PeerContextPtr &ctx) -> const peer::PeerId & {
+          return ctx->peer_id;
+        },
+        prefer);
+  }
+
   void PeerSet::selectAll(const SelectCallback &callback) const {
     boost::for_each(peers_, callback);
   }
@@ -9,6 +9,8 @@
 #include <functional>
 #include <set>
 
+#include <libp2p/peer/latency_repository.hpp>
+
 #include "peer_context.hpp"
 
 namespace libp2p::protocol::gossip {
@@ -40,6 +42,13 @@ namespace libp2p::protocol::gossip {
     /// Selects up to n random peers
     std::vector<PeerContextPtr> selectRandomPeers(size_t n) const;
 
+    /// Selects up to n random peers, low (or high) latency peers are more
+    /// likely to be selected
+    std::vector<PeerContextPtr> selectPeersByLatency(
+        size_t n,
+        const peer::LatencyRepository &latency,
+        peer::LatencyRepository::Prefer prefer) const;
+
     /// Callback for peer selection
     using SelectCallback = std::function<void(const PeerContextPtr &)>;
 
@@ -7,6 +7,7 @@
 #include "remote_subscriptions.hpp"
 
 #include <algorithm>
+#include <chrono>
 
 #include "connectivity.hpp"
 #include "message_builder.hpp"
@@ -15,10 +16,12 @@ namespace libp2p::protocol::gossip {
 
   RemoteSubscriptions::RemoteSubscriptions(const Config &config,
                                            Connectivity &connectivity,
+                                           const MessageCache &msg_cache,
                                            basic::Scheduler &scheduler,
                                            log::SubLogger &log)
       : config_(config),
         connectivity_(connectivity),
+        msg_cache_(msg_cache),
         scheduler_(scheduler),
         log_(log) {}
 
@@ -33,6 +36,8 @@ namespace libp2p::protocol::gossip {
     subs.onSelfSubscribed(subscribed);
     if (subs.empty()) {
       table_.erase(topic);
+    } else {
+      touch(topic, subs);
     }
     log_.debug("self {} {}",
                (subscribed ? "subscribed to" : "unsubscribed from"),
@@ -56,6 +61,7 @@ namespace libp2p::protocol::gossip {
     }
     TopicSubscriptions &subs = res.value();
     subs.onPeerSubscribed(peer);
+    touch(topic, subs);
   }
 
   void RemoteSubscriptions::onPeerUnsubscribed(const PeerContextPtr &peer,
@@ -80,6 +86,8 @@ namespace libp2p::protocol::gossip {
     subs.onPeerUnsubscribed(peer);
     if (subs.empty()) {
       table_.erase(topic);
+    } else {
+      touch(topic, subs);
     }
   }
 
@@ -106,6 +114,7 @@ namespace libp2p::protocol::gossip {
       return;
     }
     res.value().onGraft(peer);
+    touch(topic, res.value());
   }
 
   void RemoteSubscriptions::onPrune(const PeerContextPtr &peer,
@@ -117,6 +126,7 @@ namespace libp2p::protocol::gossip {
     }
     res.value().onPrune(peer,
                         scheduler_.now() + std::chrono::seconds(backoff_time));
+    touch(topic, res.value());
   }
 
   void RemoteSubscriptions::onNewMessage(
@@ -130,19 +140,92 @@ namespace libp2p::protocol::gossip {
       log_.error("error getting item for {}", msg->topic);
       return;
     }
-    res.value().onNewMessage(from, msg, msg_id, now);
+    TopicSubscriptions &subs = res.value();
+    auto fanout_was_set = subs.fanoutPeriodEnds() != Time::zero();
+    subs.onNewMessage(from, msg, msg_id, now);
+    if (is_published_locally) {
+      if (!fanout_was_set) {
+        fanout_expiration_.emplace(subs.fanoutPeriodEnds(), msg->topic);
+      }
+      touch(msg->topic, subs);
+    }
+  }
+
+  void RemoteSubscriptions::sendIDontWant(const PeerContextPtr &from,
+                                          const TopicId &topic,
+                                          const MessageId &msg_id) {
+    auto res = getItem(topic, false);
+    if (res) {
+      res.value().sendIDontWant(from, msg_id);
+    }
   }
 
   void RemoteSubscriptions::onHeartbeat() {
     auto now = scheduler_.now();
-    for (auto it = table_.begin(); it != table_.end();) {
+    while (!fanout_expiration_.empty()
+           && fanout_expiration_.top().first < now) {
+      auto topic = fanout_expiration_.top().second;
+      fanout_expiration_.pop();
+      auto it = table_.find(topic);
+      if (it == table_.end()) {
+        continue;
+      }
+      auto ends = it->second.fanoutPeriodEnds();
+      if (ends == Time::zero()) {
+        continue;
+      }
+      if (ends < now) {
+        dirty_.insert(std::move(topic));
+      } else {
+        // prolonged by recent publishing
+        fanout_expiration_.emplace(ends, std::move(topic));
+      }
+    }
+
+    // if the previous heartbeat is still in progress, let it finish first
+    if (backlog_.empty()) {
+      backlog_.assign(dirty_.begin(), dirty_.end());
+      dirty_.clear();
+    }
+    processDirtyTopics();
+  }
+
+  void RemoteSubscriptions::touch(const TopicId &topic,
+                                  const TopicSubscriptions &subs) {
+    if (subs.needsMeshUpdate()) {
+      dirty_.insert(topic);
+    }
+  }
+
+  void RemoteSubscriptions::processDirtyTopics() {
+    continuation_.reset();
+    auto now = scheduler_.now();
+    auto started = std::chrono::steady_clock::now();
+    while (!backlog_.empty()) {
+      auto it = table_.find(backlog_.front());
+      backlog_.pop_front();
+      if (it == table_.end()) {
+        continue;
+      }
       it->second.onHeartbeat(now);
       if (it->second.empty()) {
         // fanout interval expired - clean up
         log_.debug("deleted entry for topic {}", it->first);
-        it = table_.erase(it);
+        table_.erase(it);
       } else {
-        ++it;
+        // mesh may stay incomplete, e.g. candidates are backed off
+        touch(it->first, it->second);
+      }
+
+      if (config_.heartbeat_budget_usec != std::chrono::microseconds::zero()
+          && !backlog_.empty()
+          && std::chrono::steady_clock::now() - started
+                 >= config_.heartbeat_budget_usec) {
+        log_.debug("heartbeat budget exceeded, {} topics postponed",
+                   backlog_.size());
+        continuation_ =
+            scheduler_.scheduleWithHandle([this] { processDirtyTopics(); });
+        return;
       }
     }
   }
@@ -155,7 +238,8 @@ namespace libp2p::protocol::gossip {
     }
     if (create_if_not_exist) {
       auto [it, _] = table_.emplace(
-          topic, TopicSubscriptions(topic, config_, connectivity_, log_));
+          topic, TopicSubscriptions(
+              topic, config_, connectivity_, msg_cache_, log_));
       TopicSubscriptions &item = it->second;
       connectivity_.getConnectedPeers().selectIf(
           [&item](const PeerContextPtr &ctx) { item.onPeerSubscribed(ctx); },
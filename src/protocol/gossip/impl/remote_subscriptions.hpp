@@ -6,6 +6,10 @@
 
 #pragma once
 
+#include <deque>
+#include <queue>
+#include <unordered_set>
+
 #include <libp2p/basic/scheduler.hpp>
 #include <libp2p/log/sublogger.hpp>
 
@@ -20,6 +24,7 @@ namespace libp2p::protocol::gossip {
     /// GossipCore and lives only within its scope
     RemoteSubscriptions(const Config &config,
                         Connectivity &connectivity,
+                        const MessageCache &msg_cache,
                         basic::Scheduler &scheduler,
                         log::SubLogger &log);
 
@@ -54,22 +59,54 @@ namespace libp2p::protocol::gossip {
                       const TopicMessage::Ptr &msg,
                       const MessageId &msg_id);
 
-    /// Periodic job needed to update meshes and shift "I have" caches
+    /// Tells mesh peers of message's topic not to send their copies
+    void sendIDontWant(const PeerContextPtr &from,
+                       const TopicId &topic,
+                       const MessageId &msg_id);
+
+    /// Periodic job needed to update meshes and expire fanouts. Visits only
+    /// topics which need it, spreads the work over IO loop cycles if it
+    /// exceeds config_.heartbeat_budget_usec
     void onHeartbeat();
 
    private:
+    using FanoutExpiration = std::pair<Time, TopicId>;
+
+    /// Marks topic to be visited on heartbeat if its mesh needs update
+    void touch(const TopicId &topic, const TopicSubscriptions &subs);
+
+    /// Visits dirty topics of the current heartbeat within time budget,
+    /// schedules continuation for the rest
+    void processDirtyTopics();
+
     /// Returns table item, creates a new one if needed
     boost::optional<TopicSubscriptions &> getItem(const TopicId &topic,
                                                   bool create_if_not_exist);
 
     const Config &config_;
     Connectivity &connectivity_;
+    const MessageCache &msg_cache_;
     basic::Scheduler &scheduler_;
 
     // TODO(artem): bound table size (which may grow!)
     // by removing items not subscribed to locally. LRU(???)
     std::unordered_map<TopicId, TopicSubscriptions> table_;
 
+    /// Topics to be visited on the next heartbeat
+    std::unordered_set<TopicId> dirty_;
+
+    /// Topics of the current heartbeat not visited yet
+    std::deque<TopicId> backlog_;
+
+    /// Fanout expiration queue, one entry per topic having fanout period
+    std::priority_queue<FanoutExpiration,
+                        std::vector<FanoutExpiration>,
+                        std::greater<>>
+        fanout_expiration_;
+
+    /// Continuation of heartbeat which exceeded its budget
+    basic::Scheduler::Handle continuation_;
+
     log::SubLogger &log_;
   };
 
@@ -0,0 +1,142 @@
+/**
+ * Copyright Quadrivium LLC
+ * All Rights Reserved
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "seen_cache.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <cassert>
+#include <cstring>
+#include <random>
+
+namespace libp2p::protocol::gossip {
+
+  namespace {
+    uint64_t mix(uint64_t x) {
+      // splitmix64 finalizer
+      x ^= x >> 30;
+      x *= 0xbf58476d1ce4e5b9ull;
+      x ^= x >> 27;
+      x *= 0x94d049bb133111ebull;
+      x ^= x >> 31;
+      return x;
+    }
+
+    uint64_t randomSeed() {
+      std::random_device rd;
+      return (uint64_t{rd()} << 32) | rd();
+    }
+  }  // namespace
+
+  SeenCache::SeenCache(Time lifetime, size_t capacity, size_t buckets)
+      : span_(lifetime / std::max<size_t>(buckets - 1, 1)),
+        bucket_capacity_(std::max<size_t>(capacity / buckets, 1)),
+        seed_(randomSeed()),
+        buckets_(buckets) {
+    assert(buckets >= 2);
+    assert(lifetime > Time::zero());
+    // keep load factor at most 1/2
+    auto slots = std::bit_ceil(bucket_capacity_ * 2);
+    for (auto &bucket : buckets_) {
+      bucket.slots.resize(slots);
+    }
+  }
+
+  uint64_t SeenCache::digest(const MessageId &msg_id) const {
+    auto h = seed_ ^ msg_id.size();
+    size_t i = 0;
+    for (; i + 8 <= msg_id.size(); i += 8) {
+      uint64_t word = 0;
+      std::memcpy(&word, msg_id.data() + i, 8);
+      h = mix(h ^ word);
+    }
+    if (i < msg_id.size()) {
+      uint64_t word = 0;
+      std::memcpy(&word, msg_id.data() + i, msg_id.size() - i);
+      h = mix(h ^ word);
+    }
+    return h == 0 ? 1 : h;
+  }
+
+  bool SeenCache::find(const Bucket &bucket, uint64_t digest) const {
+    auto mask = bucket.slots.size() - 1;
+    for (auto i = digest & mask;; i = (i + 1) & mask) {
+      if (bucket.slots[i] == digest) {
+        return true;
+      }
+      if (bucket.slots[i] == 0) {
+        return false;
+      }
+    }
+  }
+
+  bool SeenCache::insert(const MessageId &msg_id, Time now) {
+    rotate(now);
+    auto d = digest(msg_id);
+    for (const auto &bucket : buckets_) {
+      if (bucket.size != 0 and find(bucket, d)) {
+        return false;
+      }
+    }
+    if (buckets_[current_].size >= bucket_capacity_) {
+      advance();
+      current_ends_ = now + span_;
+    }
+    auto &bucket = buckets_[current_];
+    auto mask = bucket.slots.size() - 1;
+    auto i = d & mask;
+    while (bucket.slots[i] != 0) {
+      i = (i + 1) & mask;
+    }
+    bucket.slots[i] = d;
+    ++bucket.size;
+    return true;
+  }
+
+  bool SeenCache::contains(const MessageId &msg_id) const {
+    auto d = digest(msg_id);
+    return std::any_of(
+        buckets_.begin(), buckets_.end(), [&](const Bucket &bucket) {
+          return bucket.size != 0 and find(bucket, d);
+        });
+  }
+
+  void SeenCache::rotate(Time now) {
+    if (now < current_ends_) {
+      return;
+    }
+    if (now - current_ends_ >= span_ * buckets_.size()) {
+      // idle for long, everything expired
+      for (size_t i = 0; i < buckets_.size(); ++i) {
+        advance();
+      }
+      current_ends_ = now + span_;
+      return;
+    }
+    while (current_ends_ <= now) {
+      advance();
+      current_ends_ += span_;
+    }
+  }
+
+  size_t SeenCache::size() const {
+    size_t size = 0;
+    for (const auto &bucket : buckets_) {
+      size += bucket.size;
+    }
+    return size;
+  }
+
+  void SeenCache::advance() {
+    current_ = (current_ + 1) % buckets_.size();
+    auto &bucket = buckets_[current_];
+    if (bucket.size != 0) {
+      std::fill(bucket.slots.begin(), bucket.slots.end(), 0);
+      bucket.size = 0;
+    }
+  }
+
+}  // namespace libp2p::protocol::gossip
@@ -0,0 +1,63 @@
+/**
+ * Copyright Quadrivium LLC
+ * All Rights Reserved
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <vector>
+
+#include "common.hpp"
+
+namespace libp2p::protocol::gossip {
+
+  /**
+   * Fixed memory cache of seen message ids, shared by all topics.
+   * Ids are stored as 64-bit digests in a ring of open addressing tables,
+   * each table collects ids for lifetime / (buckets - 1) and is cleared
+   * when the ring comes back to it. So ids are remembered for at least
+   * lifetime, unless more than capacity ids arrive within it, then tables
+   * are rotated earlier. Insert and lookup are O(buckets)
+   */
+  class SeenCache {
+   public:
+    static constexpr size_t kDefaultBuckets = 8;
+
+    SeenCache(Time lifetime, size_t capacity, size_t buckets = kDefaultBuckets);
+
+    /// Remembers message id, returns false if it was already seen
+    bool insert(const MessageId &msg_id, Time now);
+
+    /// Returns true if message id was seen
+    bool contains(const MessageId &msg_id) const;
+
+    /// Forgets ids which are older than lifetime
+    void rotate(Time now);
+
+    /// Number of ids remembered
+    size_t size() const;
+
+   private:
+    struct Bucket {
+      std::vector<uint64_t> slots;
+      size_t size = 0;
+    };
+
+    /// Seeded digest of message id, never 0, which marks empty slot
+    uint64_t digest(const MessageId &msg_id) const;
+
+    bool find(const Bucket &bucket, uint64_t digest) const;
+
+    /// Moves to the next bucket clearing it
+    void advance();
+
+    const Time span_;
+    const size_t bucket_capacity_;
+    const uint64_t seed_;
+    std::vector<Bucket> buckets_;
+    size_t current_ = 0;
+    Time current_ends_{};
+  };
+
+}  // namespace libp2p::protocol::gossip
@@ -0,0 +1,238 @@
+/**
+ * Copyright Quadrivium LLC
+ * All Rights Reserved
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "signature_verifier.hpp"
+
+#include <boost/asio/post.hpp>
+#include <libp2p/crypto/crypto_provider.hpp>
+#include <libp2p/crypto/key_marshaller.hpp>
+#include <libp2p/crypto/sha/sha256.hpp>
+
+#include "message_builder.hpp"
+
+namespace libp2p::protocol::gossip {
+
+  SignatureVerifier::SignatureVerifier(
+      const Config &config,
+      std::shared_ptr<basic::Scheduler> scheduler,
+      std::shared_ptr<crypto::CryptoProvider> crypto_provider,
+      std::shared_ptr<crypto::marshaller::KeyMarshaller> key_marshaller,
+      Feedback feedback)
+      : batch_size_(std::max<size_t>(config.verify_batch_size, 1)),
+        cache_size_(config.verify_cache_size),
+        scheduler_(std::move(scheduler)),
+        crypto_provider_(std::move(crypto_provider)),
+        key_marshaller_(std::move(key_marshaller)),
+        feedback_(std::move(feedback)),
+        workers_(std::max<size_t>(config.verify_threads, 1)) {}
+
+  SignatureVerifier::~SignatureVerifier() {
+    workers_.stop();
+    workers_.join();
+  }
+
+  void SignatureVerifier::verify(PeerContextPtr from,
+                                 TopicMessage::Ptr msg,
+                                 MessageId msg_id) {
+    Item item{.verified = {std::move(from), std::move(msg), std::move(msg_id)}};
+    const auto &message = *item.verified.msg;
+    if (auto signable = MessageBuilder::signableMessage(message)) {
+      if (auto digest = SignatureVerifier::digest(message, signable.value())) {
+        item.digest = std::move(digest.value());
+        auto &count = in_progress_[item.digest];
+        item.lookup = count != 0 or verdicts_.contains(item.digest);
+        ++count;
+        if (not item.lookup) {
+          item.signable = std::move(signable.value());
+        }
+      }
+    }
+    batch_.push_back(std::move(item));
+
+    if (batch_.size() >= batch_size_) {
+      flush();
+      return;
+    }
+    if (not flush_scheduled_) {
+      flush_scheduled_ = true;
+      scheduler_->schedule([weak_self{weak_from_this()}] {
+        if (auto self = weak_self.lock()) {
+          self->flush();
+        }
+      });
+    }
+  }
+
+  void SignatureVerifier::flush() {
+    flush_scheduled_ = false;
+    if (batch_.empty()) {
+      return;
+    }
+    boost::asio::post(workers_,
+                      [weak_self{weak_from_this()},
+                       id{next_batch_++},
+                       batch{std::move(batch_)},
+                       scheduler{scheduler_},
+                       crypto_provider{crypto_provider_},
+                       key_marshaller{key_marshaller_}]() mutable {
+                        verifyBatch(batch, *crypto_provider, *key_marshaller);
+                        scheduler->schedule(
+                            [weak_self, id, batch{std::move(batch)}]() mutable {
+                              if (auto self = weak_self.lock()) {
+                                self->onBatchVerified(id, std::move(batch));
+                              }
+                            });
+                      });
+    batch_.clear();
+  }
+
+  outcome::result<bool> SignatureVerifier::verifyMessage(
+      const TopicMessage &msg,
+      const crypto::CryptoProvider &crypto_provider,
+      const crypto::marshaller::KeyMarshaller &key_marshaller) {
+    OUTCOME_TRY(key, signerKey(msg, key_marshaller));
+    if (not key) {
+      return false;
+    }
+    OUTCOME_TRY(signable, MessageBuilder::signableMessage(msg));
+    return crypto_provider.verify(signable, msg.signature.value(), *key);
+  }
+
+  outcome::result<SignatureVerifier::Digest> SignatureVerifier::digest(
+      const TopicMessage &msg, BytesIn signable) {
+    crypto::Sha256 hasher;
+    // sizes are hashed too, so that bytes cannot move between parts
+    auto write = [&](BytesIn part) -> outcome::result<void> {
+      auto size = static_cast<uint64_t>(part.size());
+      OUTCOME_TRY(hasher.write(BytesIn{
+          reinterpret_cast<const uint8_t *>(&size), sizeof(size)}));  // NOLINT
+      return hasher.write(part);
+    };
+    OUTCOME_TRY(write(signable));
+    OUTCOME_TRY(write(msg.signature ? BytesIn{*msg.signature} : BytesIn{}));
+    OUTCOME_TRY(write(msg.key ? BytesIn{*msg.key} : BytesIn{}));
+    return hasher.digest();
+  }
+
+  outcome::result<std::optional<crypto::PublicKey>>
+  SignatureVerifier::signerKey(
+      const TopicMessage &msg,
+      const crypto::marshaller::KeyMarshaller &key_marshaller) {
+    if (not msg.signature) {
+      return std::nullopt;
+    }
+    OUTCOME_TRY(from, peerFrom(msg));
+    crypto::ProtobufKey proto_key{{}};
+    if (msg.key) {
+      proto_key.key = msg.key.value();
+      OUTCOME_TRY(key_owner, peer::PeerId::fromPublicKey(proto_key));
+      if (key_owner != from) {
+        return std::nullopt;
+      }
+    } else {
+      // small keys are inlined into peer id
+      const auto &hash = from.toMultihash();
+      if (hash.getType() != multi::HashType::identity) {
+        return std::nullopt;
+      }
+      auto key_bytes = hash.getHash();
+      proto_key.key.assign(key_bytes.begin(), key_bytes.end());
+    }
+    OUTCOME_TRY(key, key_marshaller.unmarshalPublicKey(proto_key));
+    return key;
+  }
+
+  void SignatureVerifier::verifyBatch(
+      Batch &batch,
+      const crypto::CryptoProvider &crypto_provider,
+      const crypto::marshaller::KeyMarshaller &key_marshaller) {
+    struct Signed {
+      Item *item;
+      crypto::PublicKey key;
+    };
+    std::vector<Signed> signed_items;
+    signed_items.reserve(batch.size());
+    for (auto &item : batch) {
+      if (item.lookup) {
+        continue;
+      }
+      item.verified.valid = false;
+      if (item.digest.empty()) {
+        // cannot be serialized, so cannot be signed
+        continue;
+      }
+      auto key = signerKey(*item.verified.msg, key_marshaller);
+      if (not key or not key.value()) {
+        continue;
+      }
+      signed_items.push_back({&item, std::move(*key.value())});
+    }
+
+    std::vector<crypto::CryptoProvider::VerifyItem> to_verify;
+    to_verify.reserve(signed_items.size());
+    for (const auto &s : signed_items) {
+      to_verify.push_back({
+          s.item->signable,
+          s.item->verified.msg->signature.value(),
+          s.key,
+      });
+    }
+    // batch is already on worker thread
+    auto verdicts = crypto_provider.verifyBatch(to_verify);
+    for (size_t i = 0; i < signed_items.size(); ++i) {
+      signed_items[i].item->verified.valid = verdicts[i];
+    }
+  }
+
+  void SignatureVerifier::onBatchVerified(uint64_t id, Batch batch) {
+    completed_.emplace(id, std::move(batch));
+
+    for (auto it = completed_.find(next_delivery_); it != completed_.end();
+         it = completed_.find(next_delivery_)) {
+      auto ready = std::move(it->second);
+      completed_.erase(it);
+      ++next_delivery_;
+
+      std::vector<Verified> verified;
+      verified.reserve(ready.size());
+      for (auto &item : ready) {
+        if (item.digest.empty()) {
+          verified.push_back(std::move(item.verified));
+          continue;
+        }
+        if (item.lookup) {
+          if (auto v = verdicts_.find(item.digest); v != verdicts_.end()) {
+            item.verified.valid = v->second;
+          } else {
+            // evicted before delivery, which is rare enough to verify here
+            auto res = verifyMessage(
+                *item.verified.msg, *crypto_provider_, *key_marshaller_);
+            item.verified.valid = res.has_value() and res.value();
+          }
+        }
+        remember(item.digest, item.verified.valid);
+        if (auto p = in_progress_.find(item.digest);
+            p != in_progress_.end() and --p->second == 0) {
+          in_progress_.erase(p);
+        }
+        verified.push_back(std::move(item.verified));
+      }
+      feedback_(verified);
+    }
+  }
+
+  void SignatureVerifier::remember(const Digest &digest, bool valid) {
+    if (cache_size_ == 0 or not verdicts_.emplace(digest, valid).second) {
+      return;
+    }
+    verdicts_order_.push_back(digest);
+    if (verdicts_order_.size() > cache_size_) {
+      verdicts_.erase(verdicts_order_.front());
+      verdicts_order_.pop_front();
+    }
+  }
+
+}  // namespace libp2p::protocol::gossip
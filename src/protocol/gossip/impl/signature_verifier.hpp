@@ -0,0 +1,149 @@
+/**
+ * Copyright Quadrivium LLC
+ * All Rights Reserved
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <deque>
+#include <map>
+#include <optional>
+#include <unordered_map>
+
+#include <boost/asio/thread_pool.hpp>
+#include <libp2p/basic/scheduler.hpp>
+#include <libp2p/crypto/key.hpp>
+
+#include "common.hpp"
+
+namespace libp2p::crypto {
+  class CryptoProvider;
+}
+
+namespace libp2p::crypto::marshaller {
+  class KeyMarshaller;
+}
+
+namespace libp2p::protocol::gossip {
+
+  /**
+   * Verifies signatures of received messages on worker threads.
+   * Messages are collected into batches during IO loop cycle, verdicts are
+   * fed back on IO thread in the order messages were queued. Verdicts are
+   * remembered by digest of signed content, signature and key, so that
+   * copies of the same message received from different peers are verified
+   * once, whatever their message id is
+   */
+  class SignatureVerifier
+      : public std::enable_shared_from_this<SignatureVerifier> {
+   public:
+    struct Verified {
+      PeerContextPtr from;
+      TopicMessage::Ptr msg;
+      MessageId msg_id;
+      bool valid = false;
+    };
+
+    /// Called on IO thread with verdicts of one batch
+    using Feedback = std::function<void(std::vector<Verified> &)>;
+
+    SignatureVerifier(const SignatureVerifier &) = delete;
+    SignatureVerifier &operator=(const SignatureVerifier &) = delete;
+    SignatureVerifier(SignatureVerifier &&) = delete;
+    SignatureVerifier &operator=(SignatureVerifier &&) = delete;
+
+    SignatureVerifier(
+        const Config &config,
+        std::shared_ptr<basic::Scheduler> scheduler,
+        std::shared_ptr<crypto::CryptoProvider> crypto_provider,
+        std::shared_ptr<crypto::marshaller::KeyMarshaller> key_marshaller,
+        Feedback feedback);
+
+    ~SignatureVerifier();
+
+    /// Queues message for verification
+    void verify(PeerContextPtr from, TopicMessage::Ptr msg, MessageId msg_id);
+
+    /// Sends pending messages to workers without waiting for IO loop cycle end
+    void flush();
+
+    /// Verifies message signature against its key or its author's peer id
+    static outcome::result<bool> verifyMessage(
+        const TopicMessage &msg,
+        const crypto::CryptoProvider &crypto_provider,
+        const crypto::marshaller::KeyMarshaller &key_marshaller);
+
+   private:
+    /// Key which message must be signed with, none if message can't be
+    /// valid whatever its signature is
+    static outcome::result<std::optional<crypto::PublicKey>> signerKey(
+        const TopicMessage &msg,
+        const crypto::marshaller::KeyMarshaller &key_marshaller);
+
+    /// SHA-256 of signable bytes, signature and key of message
+    using Digest = Bytes;
+
+    /// Digest of message and its signable bytes
+    static outcome::result<Digest> digest(const TopicMessage &msg,
+                                          BytesIn signable);
+
+    struct Item {
+      Verified verified;
+
+      /// Cache key of verdict
+      Digest digest;
+
+      /// Signed content, kept from digest calculation unless lookup
+      Bytes signable;
+
+      /// Verdict is taken from cache on delivery, the same signed message
+      /// is already being verified
+      bool lookup = false;
+    };
+    using Batch = std::vector<Item>;
+
+    /// Worker thread fn
+    static void verifyBatch(
+        Batch &batch,
+        const crypto::CryptoProvider &crypto_provider,
+        const crypto::marshaller::KeyMarshaller &key_marshaller);
+
+    /// Reorders completed batches and feeds them back
+    void onBatchVerified(uint64_t id, Batch batch);
+
+    /// Remembers verdict, evicts the oldest one if full
+    void remember(const Digest &digest, bool valid);
+
+    const size_t batch_size_;
+    const size_t cache_size_;
+    std::shared_ptr<basic::Scheduler> scheduler_;
+    std::shared_ptr<crypto::CryptoProvider> crypto_provider_;
+    std::shared_ptr<crypto::marshaller::KeyMarshaller> key_marshaller_;
+    Feedback feedback_;
+    boost::asio::thread_pool workers_;
+
+    /// Batch being collected
+    Batch batch_;
+
+    /// Flush of current batch is scheduled
+    bool flush_scheduled_ = false;
+
+    /// Id of the next batch to be sent to workers
+    uint64_t next_batch_ = 0;
+
+    /// Id of the next batch to be fed back
+    uint64_t next_delivery_ = 0;
+
+    /// Completed batches waiting for previous ones
+    std::map<uint64_t, Batch> completed_;
+
+    /// Digests queued for verification and not delivered yet
+    std::unordered_map<Digest, size_t> in_progress_;
+
+    /// Verdicts by digest and their insertion order
+    std::unordered_map<Digest, bool> verdicts_;
+    std::deque<Digest> verdicts_order_;
+  };
+
+}  // namespace libp2p::protocol::gossip
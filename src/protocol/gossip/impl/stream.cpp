@@ -9,7 +9,7 @@
 #include <cassert>
 
 #include <libp2p/basic/varint_reader.hpp>
-#include <libp2p/basic/write_return_size.hpp>
+#include <libp2p/basic/write.hpp>
 
 #include "message_parser.hpp"
 #include "peer_context.hpp"
@@ -30,6 +30,8 @@ namespace libp2p::protocol::gossip {
         timeout_(config.rw_timeout_msec),
         scheduler_(scheduler),
         max_message_size_(config.max_message_size),
+        max_pending_bytes_(config.max_pending_bytes),
+        overflow_policy_(config.overflow_policy),
         feedback_(feedback),
         msg_receiver_(msg_receiver),
         stream_(std::move(stream)),
@@ -125,7 +127,17 @@ namespace libp2p::protocol::gossip {
     read();
   }
 
-  void Stream::write(outcome::result<SharedBuffer> serialization_res) {
+  namespace {
+    size_t chainSize(const SharedBufferChain &buffers) {
+      size_t size = 0;
+      for (auto &buffer : buffers) {
+        size += buffer->size();
+      }
+      return size;
+    }
+  }  // namespace
+
+  void Stream::write(outcome::result<SharedBufferChain> serialization_res) {
     if (closed_) {
       return;
     }
@@ -140,33 +152,125 @@ namespace libp2p::protocol::gossip {
       return;
     }
 
-    auto &buffer = serialization_res.value();
-    if (buffer->empty()) {
+    auto &buffers = serialization_res.value();
+    auto size = chainSize(buffers);
+    if (size == 0) {
       return;
     }
 
     if (writing_bytes_ > 0) {
-      pending_bytes_ += buffer->size();
-      pending_buffers_.emplace_back(std::move(buffer));
+      enqueue(std::move(buffers));
     } else {
-      beginWrite(std::move(buffer));
+      beginWrite(std::move(buffers));
+    }
+  }
+
+  void Stream::enqueue(SharedBufferChain buffers) {
+    // head is length prefix followed by subscriptions and control,
+    // the rest are encoded publish fields
+    if (overflow_) {
+      return;
+    }
+    const auto &head = *buffers.front();
+    auto prefix = multi::UVarint::calculateSize(head);
+    if (head.size() > prefix) {
+      if (!makeSpace(head.size() - prefix, true)) {
+        return;
+      }
+      pending_bytes_ += head.size() - prefix;
+      pending_control_.emplace_back(
+          std::make_shared<Bytes>(head.begin() + prefix, head.end()));
+    }
+
+    for (auto it = buffers.begin() + 1; it != buffers.end(); ++it) {
+      auto size = (*it)->size();
+      if (!makeSpace(size, false)) {
+        GossipMetrics::get().dropped.inc();
+        GossipMetrics::get().dropped_bytes.inc(size);
+        continue;
+      }
+      pending_bytes_ += size;
+      pending_publish_.emplace_back(std::move(*it));
+    }
+  }
+
+  bool Stream::makeSpace(size_t size, bool control) {
+    if (pending_bytes_ + size <= max_pending_bytes_) {
+      return true;
     }
+    // control is never dropped, forwarded messages make space for it
+    if (control || overflow_policy_ == Config::OverflowPolicy::DROP_OLDEST) {
+      while (!pending_publish_.empty()
+             && pending_bytes_ + size > max_pending_bytes_) {
+        auto dropped = pending_publish_.front()->size();
+        pending_publish_.pop_front();
+        pending_bytes_ -= dropped;
+        GossipMetrics::get().dropped.inc();
+        GossipMetrics::get().dropped_bytes.inc(dropped);
+      }
+      if (pending_bytes_ + size <= max_pending_bytes_) {
+        return true;
+      }
+      if (!control) {
+        return false;
+      }
+    } else if (overflow_policy_ == Config::OverflowPolicy::DROP_NEWEST) {
+      return false;
+    }
+    if (!closed_ && !overflow_) {
+      overflow_ = true;
+      asyncPostError(Error::WRITER_QUEUE_OVERFLOW);
+    }
+    return false;
+  }
+
+  SharedBufferChain Stream::dequeue() {
+    SharedBufferChain buffers;
+    buffers.emplace_back();
+    size_t size = 0;
+    auto take = [&](std::deque<SharedBuffer> &lane) {
+      auto &buffer = lane.front();
+      size += buffer->size();
+      pending_bytes_ -= buffer->size();
+      buffers.emplace_back(std::move(buffer));
+      lane.pop_front();
+    };
+    // keep RPCs within limit unless a single field exceeds it
+    auto fits = [&](const std::deque<SharedBuffer> &lane) {
+      return !lane.empty()
+          && (size == 0 || size + lane.front()->size() <= max_message_size_);
+    };
+    while (fits(pending_control_)) {
+      take(pending_control_);
+    }
+    // the rest of control goes ahead of publish fields in the next RPC
+    while (pending_control_.empty() && fits(pending_publish_)) {
+      take(pending_publish_);
+    }
+    buffers.front() =
+        std::make_shared<Bytes>(multi::UVarint{size}.toVector());
+    return buffers;
   }
 
-  void Stream::beginWrite(SharedBuffer buffer) {
-    assert(buffer);
+  void Stream::beginWrite(SharedBufferChain buffers) {
+    assert(!buffers.empty());
 
-    writing_bytes_ = buffer->size();
+    writing_bytes_ = chainSize(buffers);
 
     TRACE("writing {} bytes to {}:{}", writing_bytes_, peer_->str, stream_id_);
 
+    std::vector<BytesIn> spans;
+    spans.reserve(buffers.size());
+    for (auto &buffer : buffers) {
+      spans.emplace_back(*buffer);
+    }
+
     // clang-format off
-    BytesIn span{*buffer};
-    writeReturnSize(
+    libp2p::writeVectored(
         stream_,
-        span,
-        [self_wptr = weak_from_this(), this, buffer = std::move(buffer)]
-            (outcome::result<size_t> result)
+        std::move(spans),
+        [self_wptr = weak_from_this(), this, buffers = std::move(buffers)]
+            (outcome::result<void> result)
         {
           if (self_wptr.expired() || closed_) {
             return;
@@ -188,7 +292,7 @@ namespace libp2p::protocol::gossip {
     }
   }
 
-  void Stream::onMessageWritten(outcome::result<size_t> res) {
+  void Stream::onMessageWritten(outcome::result<void> res) {
     if (writing_bytes_ == 0) {
       return;
     }
@@ -198,20 +302,12 @@ namespace libp2p::protocol::gossip {
       return;
     }
 
-    TRACE("written {} bytes to {}:{}", res.value(), peer_->str, stream_id_);
-
-    if (writing_bytes_ != res.value()) {
-      feedback_(peer_, Error::MESSAGE_WRITE_ERROR);
-      return;
-    }
+    TRACE("written {} bytes to {}:{}", writing_bytes_, peer_->str, stream_id_);
 
     endWrite();
 
-    if (!pending_buffers_.empty()) {
-      SharedBuffer &buffer = pending_buffers_.front();
-      pending_bytes_ -= buffer->size();
-      beginWrite(std::move(buffer));
-      pending_buffers_.pop_front();
+    if (!pending_control_.empty() || !pending_publish_.empty()) {
+      beginWrite(dequeue());
     }
   }
 
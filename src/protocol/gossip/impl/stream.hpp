@@ -43,7 +43,7 @@ namespace libp2p::protocol::gossip {
 
     /// Writes an outgoing message to stream, if there is serialization error
     /// it will be posted in asynchronous manner
-    void write(outcome::result<SharedBuffer> serialization_res);
+    void write(outcome::result<SharedBufferChain> serialization_res);
 
     /// Closes the reader so that it will ignore further bytes from wire
     void close();
@@ -51,8 +51,19 @@ namespace libp2p::protocol::gossip {
    private:
     void onLengthRead(outcome::result<multi::UVarint> varint);
     void onMessageRead(outcome::result<size_t> res);
-    void beginWrite(SharedBuffer buffer);
-    void onMessageWritten(outcome::result<size_t> res);
+    void beginWrite(SharedBufferChain buffers);
+
+    /// Splits RPC into lanes while previous write is in progress
+    void enqueue(SharedBufferChain buffers);
+
+    /// Makes space for control or publish fields according to overflow
+    /// policy, returns false if the new one should be dropped
+    bool makeSpace(size_t size, bool control);
+
+    /// Joins queued control and publish fields into the next RPC
+    SharedBufferChain dequeue();
+
+    void onMessageWritten(outcome::result<void> res);
     void endWrite();
     void asyncPostError(Error error);
 
@@ -60,19 +71,27 @@ namespace libp2p::protocol::gossip {
     const Time timeout_;
     basic::Scheduler &scheduler_;
     const size_t max_message_size_;
+    const size_t max_pending_bytes_;
+    const Config::OverflowPolicy overflow_policy_;
     const Feedback &feedback_;
     MessageReceiver &msg_receiver_;
     std::shared_ptr<connection::Stream> stream_;
     PeerContextPtr peer_;
 
-    std::deque<SharedBuffer> pending_buffers_;
+    /// RPC bodies without length prefix waiting for the current write:
+    /// subscriptions and control go ahead of forwarded messages
+    std::deque<SharedBuffer> pending_control_;
+    std::deque<SharedBuffer> pending_publish_;
 
     /// Number of bytes being awaited in active wrote operation
     size_t writing_bytes_ = 0;
 
-    // TODO(artem): limit pending bytes and close slow streams that way
+    /// Bytes in both pending lanes, limited by max_pending_bytes_
     size_t pending_bytes_ = 0;
 
+    /// Queue overflow error is posted, further writes are dropped
+    bool overflow_ = false;
+
     std::shared_ptr<Bytes> read_buffer_;
     /// Dont send feedback or schedule writes anymore
     bool closed_ = false;
@@ -32,10 +32,12 @@ namespace libp2p::protocol::gossip {
   TopicSubscriptions::TopicSubscriptions(TopicId topic,
                                          const Config &config,
                                          Connectivity &connectivity,
+                                         const MessageCache &msg_cache,
                                          log::SubLogger &log)
       : topic_(std::move(topic)),
         config_(config),
         connectivity_(connectivity),
+        msg_cache_(msg_cache),
         self_subscribed_(false),
         fanout_period_ends_(0),
         log_(log) {}
@@ -46,6 +48,18 @@ namespace libp2p::protocol::gossip {
         && subscribed_peers_.empty() && mesh_peers_.empty();
   }
 
+  bool TopicSubscriptions::needsMeshUpdate() const {
+    if (!self_subscribed_ || subscribed_peers_.empty()) {
+      return false;
+    }
+    auto sz = mesh_peers_.size();
+    return sz < config_.D_min || sz > config_.D_max;
+  }
+
+  Time TopicSubscriptions::fanoutPeriodEnds() const {
+    return fanout_period_ends_;
+  }
+
   void TopicSubscriptions::onNewMessage(
       const boost::optional<PeerContextPtr> &from,
       const TopicMessage::Ptr &msg,
@@ -67,8 +81,9 @@ namespace libp2p::protocol::gossip {
         [this, &msg, &msg_id, &from, &origin](const PeerContextPtr &ctx) {
           assert(ctx->message_builder);
 
-          if (needToForward(ctx, from, origin)) {
+          if (needToForward(ctx, from, origin) && !ctx->dontSend(msg_id)) {
             ctx->message_builder->addMessage(*msg, msg_id);
+            GossipMetrics::get().forwarded.inc();
 
             // forward immediately to those in mesh
             connectivity_.peerIsWritable(ctx, true);
@@ -87,21 +102,35 @@ namespace libp2p::protocol::gossip {
       }
     }
 
-    seen_cache_.emplace_back(now + config_.seen_cache_lifetime_msec, msg_id);
-
     log_.debug("message forwarded, topic={}, m={}, s={}",
                topic_,
                mesh_peers_.size(),
                subscribed_peers_.size());
   }
 
+  void TopicSubscriptions::sendIDontWant(const PeerContextPtr &from,
+                                         const MessageId &msg_id) {
+    mesh_peers_.selectAll([&](const PeerContextPtr &ctx) {
+      if (ctx->peer_id == from->peer_id or not ctx->accepts_idontwant) {
+        return;
+      }
+      ctx->message_builder->addIDontWant(msg_id);
+      // must get ahead of copies being forwarded
+      connectivity_.peerIsWritable(ctx, true);
+    });
+  }
+
   void TopicSubscriptions::onHeartbeat(Time now) {
-    if (self_subscribed_ && !subscribed_peers_.empty()) {
+    if (needsMeshUpdate()) {
       // add/remove mesh members according to desired network density D
       size_t sz = mesh_peers_.size();
 
       if (sz < config_.D_min) {
-        auto peers = subscribed_peers_.selectRandomPeers(config_.D_min - sz);
+        // prefer responsive peers, slow mesh peers delay propagation
+        auto peers = subscribed_peers_.selectPeersByLatency(
+            config_.D_min - sz,
+            connectivity_.getLatencyRepository(),
+            peer::LatencyRepository::Prefer::LOW_LATENCY);
         for (auto &p : peers) {
           auto it = dont_bother_until_.find(p);
           if (it != dont_bother_until_.end()) {
@@ -116,7 +145,10 @@ namespace libp2p::protocol::gossip {
           subscribed_peers_.erase(p->peer_id);
         }
       } else if (sz > config_.D_max) {
-        auto peers = mesh_peers_.selectRandomPeers(sz - config_.D_max);
+        auto peers = mesh_peers_.selectPeersByLatency(
+            sz - config_.D_max,
+            connectivity_.getLatencyRepository(),
+            peer::LatencyRepository::Prefer::HIGH_LATENCY);
         for (auto &p : peers) {
           removeFromMesh(p);
           mesh_peers_.erase(p->peer_id);
@@ -130,32 +162,6 @@ namespace libp2p::protocol::gossip {
       fanout_period_ends_ = Time::zero();
       log_.debug("fanout period reset for {}", topic_);
     }
-
-    // shift msg ids cache
-    auto seen_cache_size = seen_cache_.size();
-    bool changed = false;
-
-    if (seen_cache_size > config_.seen_cache_limit) {
-      auto b = seen_cache_.begin();
-      auto e = b + ssize_t(seen_cache_size - config_.seen_cache_limit);
-      seen_cache_.erase(b, e);
-      changed = true;
-    } else if (seen_cache_size != 0) {
-      auto it = std::find_if(seen_cache_.begin(),
-                             seen_cache_.end(),
-                             [now](const auto &p) { return p.first >= now; });
-      if (it != seen_cache_.begin()) {
-        seen_cache_.erase(seen_cache_.begin(), it);
-        changed = true;
-      }
-    }
-
-    if (changed) {
-      log_.debug("seen cache size changed {}->{} for {}",
-                 seen_cache_size,
-                 seen_cache_.size(),
-                 topic_);
-    }
   }
 
   void TopicSubscriptions::onSelfSubscribed(bool self_subscribed) {
@@ -175,7 +181,8 @@ namespace libp2p::protocol::gossip {
     subscribed_peers_.insert(p);
 
     // announce the peer about messages available for the topic
-    for (const auto &[_, msg_id] : seen_cache_) {
+    for (auto &msg_id : msg_cache_.recentIds(
+             topic_, config_.history_gossip, config_.seen_cache_limit)) {
       p->message_builder->addIHave(topic_, msg_id);
     }
     // will be sent on next heartbeat
@@ -6,10 +6,9 @@
 
 #pragma once
 
-#include <deque>
-
 #include <libp2p/log/sublogger.hpp>
 
+#include "message_cache.hpp"
 #include "peer_set.hpp"
 
 namespace libp2p::protocol::gossip {
@@ -24,19 +23,30 @@ namespace libp2p::protocol::gossip {
     TopicSubscriptions(TopicId topic,
                        const Config &config,
                        Connectivity &connectivity,
+                       const MessageCache &msg_cache,
                        log::SubLogger &log);
 
     /// Returns true if no peers subscribed and not self-subscribed and
     /// no fanout period at the moment (empty item may be erased)
     bool empty() const;
 
+    /// Returns true if mesh is out of D_min..D_max range and may be repaired
+    /// on heartbeat
+    bool needsMeshUpdate() const;
+
+    /// Time when fanout period ends, zero if there is no fanout
+    Time fanoutPeriodEnds() const;
+
     /// Forwards message to mesh members and announce to other subscribers
     void onNewMessage(const boost::optional<PeerContextPtr> &from,
                       const TopicMessage::Ptr &msg,
                       const MessageId &msg_id,
                       Time now);
 
-    /// Periodic job needed to update meshes and shift "I have" caches
+    /// Tells mesh peers except the sender not to send message copies
+    void sendIDontWant(const PeerContextPtr &from, const MessageId &msg_id);
+
+    /// Periodic job needed to update meshes
     void onHeartbeat(Time now);
 
     /// Local host subscribes or unsubscribes, this affects mesh
@@ -65,6 +75,9 @@ namespace libp2p::protocol::gossip {
     const Config &config_;
     Connectivity &connectivity_;
 
+    /// Recent messages are announced to new subscribers from there
+    const MessageCache &msg_cache_;
+
     /// This host subscribed to this topic or not, this affects mesh behavior
     bool self_subscribed_;
 
@@ -77,9 +90,6 @@ namespace libp2p::protocol::gossip {
     /// Mesh members to whom messages are forwarded in push manner
     PeerSet mesh_peers_;
 
-    /// "I have" notifications for new subscribers aka seen messages cache
-    std::deque<std::pair<Time, MessageId>> seen_cache_;
-
     /// Prune backoff times per peer
     std::unordered_map<PeerContextPtr, Time> dont_bother_until_;
 
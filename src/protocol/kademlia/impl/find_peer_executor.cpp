@@ -26,6 +26,7 @@ namespace libp2p::protocol::kademlia {
       std::shared_ptr<SessionHost> session_host,
       std::shared_ptr<PeerRouting> peer_routing,
       const std::shared_ptr<PeerRoutingTable> &peer_routing_table,
+      std::shared_ptr<ResponseTimes> response_times,
       PeerId sought_peer_id,
       FoundPeerInfoHandler handler)
       : config_(config),
@@ -35,18 +36,13 @@ namespace libp2p::protocol::kademlia {
         peer_routing_(std::move(peer_routing)),
         sought_peer_id_(std::move(sought_peer_id)),
         target_(sought_peer_id_),
+        paths_(config_,
+               target_,
+               peer_routing_table->getNearestPeers(
+                   target_, config_.closerPeerCount * 2),
+               std::move(response_times)),
         handler_(std::move(handler)),
         log_("KademliaExecutor", "kademlia", "FindPeer", ++instance_number) {
-    auto nearest_peer_ids = peer_routing_table->getNearestPeers(
-        target_, config_.closerPeerCount * 2);
-
-    nearest_peer_ids_.insert(std::move_iterator(nearest_peer_ids.begin()),
-                             std::move_iterator(nearest_peer_ids.end()));
-
-    std::for_each(nearest_peer_ids_.begin(),
-                  nearest_peer_ids_.end(),
-                  [this](auto &peer_id) { queue_.emplace(peer_id, target_); });
-
     log_.debug("created");
   }
 
@@ -62,6 +58,7 @@ namespace libp2p::protocol::kademlia {
       return Error::FULFILLED;
     }
     started_ = true;
+    timer_.emplace(queryTimer("find_peer"));
 
     serialized_request_ = std::make_shared<std::vector<uint8_t>>();
 
@@ -97,11 +94,18 @@ namespace libp2p::protocol::kademlia {
     if (not done_.compare_exchange_strong(x, true)) {
       return;
     }
+    // Peer found by fewer paths than quorum is better than nothing
+    if (result.has_error() and found_) {
+      result = *found_;
+    }
     if (result.has_value()) {
       log_.debug("done: peer is found");
     } else {
       log_.debug("done: {}", result.error());
     }
+    if (timer_) {
+      timer_->observe();
+    }
     handler_(result);
   }
 
@@ -112,10 +116,13 @@ namespace libp2p::protocol::kademlia {
 
     auto self_peer_id = host_->getId();
 
-    while (started_ and not done_ and not queue_.empty()
-           and requests_in_progress_ < config_.requestConcurency) {
-      auto peer_id = *queue_.top();
-      queue_.pop();
+    while (started_ and not done_) {
+      auto next =
+          paths_.next(host_->getPeerRepository().getLatencyRepository());
+      if (not next) {
+        break;
+      }
+      auto &[path, peer_id] = *next;
 
       // Exclude yoursef, because not found locally anyway
       if (peer_id == self_peer_id) {
@@ -134,12 +141,22 @@ namespace libp2p::protocol::kademlia {
         continue;
       }
 
-      ++requests_in_progress_;
+      basic::Scheduler::Handle slow_timer;
+      if (auto delay = paths_.slowRequestTime()) {
+        slow_timer = scheduler_->scheduleWithHandle(
+            [wp = weak_from_this(), peer_id] {
+              if (auto self = wp.lock()) {
+                self->onSlowRequest(peer_id);
+              }
+            },
+            *delay);
+      }
+      paths_.begin(path, peer_id, std::move(slow_timer));
 
       log_.debug("connecting to {}; active {}, in queue {}",
                  peer_id.toBase58(),
-                 requests_in_progress_,
-                 queue_.size());
+                 paths_.inProgress(),
+                 paths_.queued());
 
       auto holder =
           std::make_shared<std::pair<std::shared_ptr<FindPeerExecutor>,
@@ -147,10 +164,10 @@ namespace libp2p::protocol::kademlia {
 
       holder->first = shared_from_this();
       holder->second = scheduler_->scheduleWithHandle(
-          [holder] {
+          [holder, peer_id] {
             if (holder->first) {
               holder->second.reset();
-              holder->first->onConnected(Error::TIMEOUT);
+              holder->first->onConnected(peer_id, Error::TIMEOUT);
               holder->first.reset();
             }
           },
@@ -159,29 +176,41 @@ namespace libp2p::protocol::kademlia {
       host_->newStream(
           peer_info,
           config_.protocols,
-          [holder](auto &&stream_res) {
+          [holder, peer_id](auto &&stream_res) {
             if (holder->first) {
               holder->second.reset();
-              holder->first->onConnected(stream_res);
+              holder->first->onConnected(peer_id, stream_res);
               holder->first.reset();
             }
           },
           config_.connectionTimeout);
     }
 
-    if (requests_in_progress_ == 0) {
+    if (paths_.inProgress() == 0) {
       done(Error::VALUE_NOT_FOUND);
     }
   }
 
-  void FindPeerExecutor::onConnected(StreamAndProtocolOrError stream_res) {
+  void FindPeerExecutor::onSlowRequest(const PeerId &peer_id) {
+    if (done_ or not paths_.slow(peer_id)) {
+      return;
+    }
+    log_.debug("request to {} is slow; active {}, in queue {}",
+               peer_id.toBase58(),
+               paths_.inProgress(),
+               paths_.queued());
+    spawn();
+  }
+
+  void FindPeerExecutor::onConnected(const PeerId &peer_id,
+                                     StreamAndProtocolOrError stream_res) {
     if (not stream_res) {
-      --requests_in_progress_;
+      paths_.finish(peer_id, false);
 
       log_.debug("cannot connect to peer: {}; active {}, in queue {}",
                  stream_res.error(),
-                 requests_in_progress_,
-                 queue_.size());
+                 paths_.inProgress(),
+                 paths_.queued());
 
       spawn();
       return;
@@ -194,20 +223,20 @@ namespace libp2p::protocol::kademlia {
 
     log_.debug("connected to {}; active {}, in queue {}",
                addr,
-               requests_in_progress_,
-               queue_.size());
+               paths_.inProgress(),
+               paths_.queued());
 
     log_.debug("outgoing stream with {}",
                stream->remotePeerId().value().toBase58());
 
     auto session = session_host_->openSession(stream);
     if (!session->write(serialized_request_, shared_from_this())) {
-      --requests_in_progress_;
+      paths_.finish(peer_id, false);
 
       log_.debug("write to {} failed; active {}, in queue {}",
                  addr,
-                 requests_in_progress_,
-                 queue_.size());
+                 paths_.inProgress(),
+                 paths_.queued());
 
       spawn();
       return;
@@ -228,18 +257,21 @@ namespace libp2p::protocol::kademlia {
 
   void FindPeerExecutor::onResult(const std::shared_ptr<Session> &session,
                                   outcome::result<Message> msg_res) {
-    FinalAction respawn([this] {
-      --requests_in_progress_;
-      spawn();
-    });
+    auto remote_peer_id_res = session->stream()->remotePeerId();
+    BOOST_ASSERT(remote_peer_id_res.has_value());
+    auto &remote_peer_id = remote_peer_id_res.value();
+
+    auto path = paths_.finish(remote_peer_id, msg_res.has_value()).value_or(0);
+
+    FinalAction respawn([this] { spawn(); });
 
     // Check if gotten some message
     if (not msg_res) {
       log_.warn("Result from {} is failed: {}; active {}, in queue {}",
-                session->stream()->remotePeerId().value().toBase58(),
+                remote_peer_id.toBase58(),
                 msg_res.error(),
-                requests_in_progress_,
-                queue_.size());
+                paths_.inProgress(),
+                paths_.queued());
       return;
     }
     auto &msg = msg_res.value();
@@ -249,16 +281,12 @@ namespace libp2p::protocol::kademlia {
       BOOST_UNREACHABLE_RETURN();
     }
 
-    auto remote_peer_id_res = session->stream()->remotePeerId();
-    BOOST_ASSERT(remote_peer_id_res.has_value());
-    auto &remote_peer_id = remote_peer_id_res.value();
-
     auto self_peer_id = host_->getId();
 
     log_.debug("Result from {} is gotten; active {}, in queue {}",
                remote_peer_id.toBase58(),
-               requests_in_progress_,
-               queue_.size());
+               paths_.inProgress(),
+               paths_.queued());
 
     // Append gotten peer to queue
     if (msg.closer_peers) {
@@ -286,7 +314,13 @@ namespace libp2p::protocol::kademlia {
 
         // Found
         if (peer.info.id == sought_peer_id_) {
-          done(peer.info);
+          if (not found_) {
+            found_ = peer.info;
+          }
+          paths_.converge(path);
+          if (paths_.quorum()) {
+            done(*found_);
+          }
         }
 
         // Skip himself
@@ -299,10 +333,8 @@ namespace libp2p::protocol::kademlia {
           continue;
         }
 
-        // New peer add to queue
-        if (auto [it, ok] = nearest_peer_ids_.emplace(peer.info.id); ok) {
-          queue_.emplace(*it, target_);
-        }
+        // New peer add to queue of path
+        paths_.add(path, peer.info.id);
       }
     }
   }
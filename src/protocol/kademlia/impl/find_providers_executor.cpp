@@ -25,6 +25,7 @@ namespace libp2p::protocol::kademlia {
       std::shared_ptr<basic::Scheduler> scheduler,
       std::shared_ptr<SessionHost> session_host,
       const std::shared_ptr<PeerRoutingTable> &peer_routing_table,
+      std::shared_ptr<ResponseTimes> response_times,
       ContentId content_id,
       FoundProvidersHandler handler)
       : config_(config),
@@ -34,6 +35,11 @@ namespace libp2p::protocol::kademlia {
         content_id_(std::move(content_id)),
         handler_(std::move(handler)),
         target_(content_id_),
+        paths_(config_,
+               target_,
+               peer_routing_table->getNearestPeers(
+                   target_, config_.closerPeerCount * 2),
+               std::move(response_times)),
         log_("KademliaExecutor",
              "kademlia",
              "FindProviders",
@@ -42,16 +48,6 @@ namespace libp2p::protocol::kademlia {
     BOOST_ASSERT(scheduler_ != nullptr);
     BOOST_ASSERT(session_host_ != nullptr);
 
-    auto nearest_peer_ids = peer_routing_table->getNearestPeers(
-        target_, config_.closerPeerCount * 2);
-
-    nearest_peer_ids_.insert(std::move_iterator(nearest_peer_ids.begin()),
-                             std::move_iterator(nearest_peer_ids.end()));
-
-    std::for_each(nearest_peer_ids_.begin(),
-                  nearest_peer_ids_.end(),
-                  [this](auto &peer_id) { queue_.emplace(peer_id, target_); });
-
     log_.debug("created");
   }
 
@@ -67,6 +63,7 @@ namespace libp2p::protocol::kademlia {
       return Error::FULFILLED;
     }
     started_ = true;
+    timer_.emplace(queryTimer("find_providers"));
 
     serialized_request_ = std::make_shared<std::vector<uint8_t>>();
 
@@ -113,6 +110,9 @@ namespace libp2p::protocol::kademlia {
     }
 
     log_.debug("done: {} providers is found", result.size());
+    if (timer_) {
+      timer_->observe();
+    }
     handler_(std::move(result));
   }
 
@@ -123,10 +123,13 @@ namespace libp2p::protocol::kademlia {
 
     auto self_peer_id = host_->getId();
 
-    while (started_ and not done_ and not queue_.empty()
-           and requests_in_progress_ < config_.requestConcurency) {
-      auto peer_id = *queue_.top();
-      queue_.pop();
+    while (started_ and not done_) {
+      auto next =
+          paths_.next(host_->getPeerRepository().getLatencyRepository());
+      if (not next) {
+        break;
+      }
+      auto &[path, peer_id] = *next;
 
       // Exclude yoursef, because not found locally anyway
       if (peer_id == self_peer_id) {
@@ -145,12 +148,22 @@ namespace libp2p::protocol::kademlia {
         continue;
       }
 
-      ++requests_in_progress_;
+      basic::Scheduler::Handle slow_timer;
+      if (auto delay = paths_.slowRequestTime()) {
+        slow_timer = scheduler_->scheduleWithHandle(
+            [wp = weak_from_this(), peer_id] {
+              if (auto self = wp.lock()) {
+                self->onSlowRequest(peer_id);
+              }
+            },
+            *delay);
+      }
+      paths_.begin(path, peer_id, std::move(slow_timer));
 
       log_.debug("connecting to {}; active {}, in queue {}",
                  peer_id.toBase58(),
-                 requests_in_progress_,
-                 queue_.size());
+                 paths_.inProgress(),
+                 paths_.queued());
 
       auto holder =
           std::make_shared<std::pair<std::shared_ptr<FindProvidersExecutor>,
@@ -158,10 +171,10 @@ namespace libp2p::protocol::kademlia {
 
       holder->first = shared_from_this();
       holder->second = scheduler_->scheduleWithHandle(
-          [holder] {
+          [holder, peer_id] {
             if (holder->first) {
               holder->second.reset();
-              holder->first->onConnected(Error::TIMEOUT);
+              holder->first->onConnected(peer_id, Error::TIMEOUT);
               holder->first.reset();
             }
           },
@@ -170,29 +183,41 @@ namespace libp2p::protocol::kademlia {
       host_->newStream(
           peer_info,
           config_.protocols,
-          [holder](auto &&stream_res) {
+          [holder, peer_id](auto &&stream_res) {
             if (holder->first) {
               holder->second.reset();
-              holder->first->onConnected(stream_res);
+              holder->first->onConnected(peer_id, stream_res);
               holder->first.reset();
             }
           },
           config_.connectionTimeout);
     }
 
-    if (requests_in_progress_ == 0) {
+    if (paths_.inProgress() == 0) {
       done();
     }
   }
 
-  void FindProvidersExecutor::onConnected(StreamAndProtocolOrError stream_res) {
+  void FindProvidersExecutor::onSlowRequest(const PeerId &peer_id) {
+    if (done_ or not paths_.slow(peer_id)) {
+      return;
+    }
+    log_.debug("request to {} is slow; active {}, in queue {}",
+               peer_id.toBase58(),
+               paths_.inProgress(),
+               paths_.queued());
+    spawn();
+  }
+
+  void FindProvidersExecutor::onConnected(const PeerId &peer_id,
+                                          StreamAndProtocolOrError stream_res) {
     if (not stream_res) {
-      --requests_in_progress_;
+      paths_.finish(peer_id, false);
 
       log_.debug("cannot connect to peer: {}; active {}, in queue {}",
                  stream_res.error(),
-                 requests_in_progress_,
-                 queue_.size());
+                 paths_.inProgress(),
+                 paths_.queued());
 
       spawn();
       return;
@@ -205,8 +230,8 @@ namespace libp2p::protocol::kademlia {
 
     log_.debug("connected to {}; active {}, in queue {}",
                addr,
-               requests_in_progress_,
-               queue_.size());
+               paths_.inProgress(),
+               paths_.queued());
 
     log_.debug("outgoing stream with {}",
                stream->remotePeerId().value().toBase58());
@@ -214,12 +239,12 @@ namespace libp2p::protocol::kademlia {
     auto session = session_host_->openSession(stream);
 
     if (!session->write(serialized_request_, shared_from_this())) {
-      --requests_in_progress_;
+      paths_.finish(peer_id, false);
 
       log_.debug("write to {} failed; active {}, in queue {}",
                  addr,
-                 requests_in_progress_,
-                 queue_.size());
+                 paths_.inProgress(),
+                 paths_.queued());
 
       spawn();
       return;
@@ -240,18 +265,21 @@ namespace libp2p::protocol::kademlia {
 
   void FindProvidersExecutor::onResult(const std::shared_ptr<Session> &session,
                                        outcome::result<Message> msg_res) {
-    FinalAction respawn([this] {
-      --requests_in_progress_;
-      spawn();
-    });
+    auto remote_peer_id_res = session->stream()->remotePeerId();
+    BOOST_ASSERT(remote_peer_id_res.has_value());
+    auto &remote_peer_id = remote_peer_id_res.value();
+
+    auto path = paths_.finish(remote_peer_id, msg_res.has_value()).value_or(0);
+
+    FinalAction respawn([this] { spawn(); });
 
     // Check if gotten some message
     if (not msg_res) {
       log_.warn("Result from {} is failed: {}; active {}, in queue {}",
-                session->stream()->remotePeerId().value().toBase58(),
+                remote_peer_id.toBase58(),
                 msg_res.error(),
-                requests_in_progress_,
-                queue_.size());
+                paths_.inProgress(),
+                paths_.queued());
       return;
     }
     auto &msg = msg_res.value();
@@ -261,16 +289,12 @@ namespace libp2p::protocol::kademlia {
       BOOST_UNREACHABLE_RETURN();
     }
 
-    auto remote_peer_id_res = session->stream()->remotePeerId();
-    BOOST_ASSERT(remote_peer_id_res.has_value());
-    auto &remote_peer_id = remote_peer_id_res.value();
-
     auto self_peer_id = host_->getId();
 
     log_.debug("Result from {} is gotten; active {}, in queue {}",
                remote_peer_id.toBase58(),
-               requests_in_progress_,
-               queue_.size());
+               paths_.inProgress(),
+               paths_.queued());
 
     // Providers found
     if (msg.provider_peers) {
@@ -293,10 +317,12 @@ namespace libp2p::protocol::kademlia {
 
         // Save provider
         providers_.emplace(peer.info.id);
+        paths_.converge(path);
       }
 
-      // If we have enough providers, that's all
-      if (providers_.size() >= config_.maxProvidersPerKey) {
+      // If we have enough providers or disjoint paths agree, that's all
+      if (providers_.size() >= config_.maxProvidersPerKey
+          or (paths_.disjoint() and paths_.quorum())) {
         done();
       }
     }
@@ -335,10 +361,8 @@ namespace libp2p::protocol::kademlia {
           continue;
         }
 
-        // New peer add to queue
-        if (auto [it, ok] = nearest_peer_ids_.emplace(peer.info.id); ok) {
-          queue_.emplace(*it, target_);
-        }
+        // New peer add to queue of path
+        paths_.add(path, peer.info.id);
       }
     }
   }
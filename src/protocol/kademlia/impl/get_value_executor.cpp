@@ -32,6 +32,7 @@ namespace libp2p::protocol::kademlia {
       std::shared_ptr<PeerRouting> peer_routing,
       std::shared_ptr<ContentRoutingTable> content_routing_table,
       const std::shared_ptr<PeerRoutingTable> &peer_routing_table,
+      std::shared_ptr<ResponseTimes> response_times,
       std::shared_ptr<ExecutorsFactory> executor_factory,
       std::shared_ptr<Validator> validator,
       ContentId key,
@@ -47,6 +48,11 @@ namespace libp2p::protocol::kademlia {
         key_(std::move(key)),
         handler_(std::move(handler)),
         target_(key_),
+        paths_(config_,
+               target_,
+               peer_routing_table->getNearestPeers(
+                   target_, config_.closerPeerCount * 2),
+               std::move(response_times)),
         log_("KademliaExecutor", "kademlia", "GetValue", ++instance_number) {
     BOOST_ASSERT(host_ != nullptr);
     BOOST_ASSERT(scheduler_ != nullptr);
@@ -56,16 +62,6 @@ namespace libp2p::protocol::kademlia {
     BOOST_ASSERT(executor_factory_ != nullptr);
     BOOST_ASSERT(validator_ != nullptr);
 
-    auto nearest_peer_ids = peer_routing_table->getNearestPeers(
-        target_, config_.closerPeerCount * 2);
-
-    nearest_peer_ids_.insert(std::move_iterator(nearest_peer_ids.begin()),
-                             std::move_iterator(nearest_peer_ids.end()));
-
-    std::for_each(nearest_peer_ids_.begin(),
-                  nearest_peer_ids_.end(),
-                  [this](auto &peer_id) { queue_.emplace(peer_id, target_); });
-
     received_records_ = std::make_unique<Table>();
     log_.debug("created");
   }
@@ -82,6 +78,7 @@ namespace libp2p::protocol::kademlia {
       return Error::FULFILLED;
     }
     started_ = true;
+    timer_.emplace(queryTimer("get_value"));
 
     serialized_request_ = std::make_shared<std::vector<uint8_t>>();
 
@@ -109,10 +106,13 @@ namespace libp2p::protocol::kademlia {
 
     auto self_peer_id = host_->getId();
 
-    while (started_ and not done_ and not queue_.empty()
-           and requests_in_progress_ < config_.requestConcurency) {
-      auto peer_id = *queue_.top();
-      queue_.pop();
+    while (started_ and not done_) {
+      auto next =
+          paths_.next(host_->getPeerRepository().getLatencyRepository());
+      if (not next) {
+        break;
+      }
+      auto &[path, peer_id] = *next;
 
       // Exclude yoursef, because not found locally anyway
       if (peer_id == self_peer_id) {
@@ -131,12 +131,22 @@ namespace libp2p::protocol::kademlia {
         continue;
       }
 
-      ++requests_in_progress_;
+      basic::Scheduler::Handle slow_timer;
+      if (auto delay = paths_.slowRequestTime()) {
+        slow_timer = scheduler_->scheduleWithHandle(
+            [wp = weak_from_this(), peer_id] {
+              if (auto self = wp.lock()) {
+                self->onSlowRequest(peer_id);
+              }
+            },
+            *delay);
+      }
+      paths_.begin(path, peer_id, std::move(slow_timer));
 
       log_.debug("connecting to {}; active {}, in queue {}",
                  peer_info.id.toBase58(),
-                 requests_in_progress_,
-                 queue_.size());
+                 paths_.inProgress(),
+                 paths_.queued());
 
       auto holder =
           std::make_shared<std::pair<std::shared_ptr<GetValueExecutor>,
@@ -144,10 +154,10 @@ namespace libp2p::protocol::kademlia {
 
       holder->first = shared_from_this();
       holder->second = scheduler_->scheduleWithHandle(
-          [holder] {
+          [holder, peer_id] {
             if (holder->first) {
               holder->second.reset();
-              holder->first->onConnected(Error::TIMEOUT);
+              holder->first->onConnected(peer_id, Error::TIMEOUT);
               holder->first.reset();
             }
           },
@@ -156,10 +166,10 @@ namespace libp2p::protocol::kademlia {
       host_->newStream(
           peer_info,
           config_.protocols,
-          [holder](auto &&stream_res) {
+          [holder, peer_id](auto &&stream_res) {
             if (holder->first) {
               holder->second.reset();
-              holder->first->onConnected(stream_res);
+              holder->first->onConnected(peer_id, stream_res);
               holder->first.reset();
             }
           },
@@ -170,21 +180,36 @@ namespace libp2p::protocol::kademlia {
       return;
     }
 
-    if (requests_in_progress_ == 0) {
+    if (paths_.inProgress() == 0) {
       done_ = true;
       log_.debug("done");
+      if (timer_) {
+        timer_->observe();
+      }
       handler_(Error::VALUE_NOT_FOUND);
     }
   }
 
-  void GetValueExecutor::onConnected(StreamAndProtocolOrError stream_res) {
+  void GetValueExecutor::onSlowRequest(const PeerId &peer_id) {
+    if (done_ or not paths_.slow(peer_id)) {
+      return;
+    }
+    log_.debug("request to {} is slow; active {}, in queue {}",
+               peer_id.toBase58(),
+               paths_.inProgress(),
+               paths_.queued());
+    spawn();
+  }
+
+  void GetValueExecutor::onConnected(const PeerId &peer_id,
+                                     StreamAndProtocolOrError stream_res) {
     if (not stream_res) {
-      --requests_in_progress_;
+      paths_.finish(peer_id, false);
 
       log_.debug("cannot connect to peer: {}; active {}, in queue {}",
                  stream_res.error(),
-                 requests_in_progress_,
-                 queue_.size());
+                 paths_.inProgress(),
+                 paths_.queued());
 
       spawn();
       return;
@@ -196,8 +221,8 @@ namespace libp2p::protocol::kademlia {
     std::string addr(stream->remoteMultiaddr().value().getStringAddress());
     log_.debug("connected to {}; active {}, in queue {}",
                addr,
-               requests_in_progress_,
-               queue_.size());
+               paths_.inProgress(),
+               paths_.queued());
 
     log_.debug("outgoing stream with {}",
                stream->remotePeerId().value().toBase58());
@@ -205,12 +230,12 @@ namespace libp2p::protocol::kademlia {
     auto session = session_host_->openSession(stream);
 
     if (!session->write(serialized_request_, shared_from_this())) {
-      --requests_in_progress_;
+      paths_.finish(peer_id, false);
 
       log_.debug("write to {} failed; active {}, in queue {}",
                  addr,
-                 requests_in_progress_,
-                 queue_.size());
+                 paths_.inProgress(),
+                 paths_.queued());
 
       spawn();
       return;
@@ -233,18 +258,21 @@ namespace libp2p::protocol::kademlia {
       return;
     }
 
-    FinalAction respawn([this] {
-      --requests_in_progress_;
-      spawn();
-    });
+    auto remote_peer_id_res = session->stream()->remotePeerId();
+    BOOST_ASSERT(remote_peer_id_res.has_value());
+    auto &remote_peer_id = remote_peer_id_res.value();
+
+    auto path = paths_.finish(remote_peer_id, msg_res.has_value()).value_or(0);
+
+    FinalAction respawn([this] { spawn(); });
 
     // Check if gotten some message
     if (not msg_res) {
       log_.warn("Result from {} failed: {}; active {}, in queue {}",
-                session->stream()->remotePeerId().value().toBase58(),
+                remote_peer_id.toBase58(),
                 msg_res.error(),
-                requests_in_progress_,
-                queue_.size());
+                paths_.inProgress(),
+                paths_.queued());
       return;
     }
     auto &msg = msg_res.value();
@@ -254,16 +282,12 @@ namespace libp2p::protocol::kademlia {
       BOOST_UNREACHABLE_RETURN();
     }
 
-    auto remote_peer_id_res = session->stream()->remotePeerId();
-    BOOST_ASSERT(remote_peer_id_res.has_value());
-    auto &remote_peer_id = remote_peer_id_res.value();
-
     auto self_peer_id = host_->getId();
 
     log_.debug("Result from {} is gotten; active {}, in queue {}",
                remote_peer_id.toBase58(),
-               requests_in_progress_,
-               queue_.size());
+               paths_.inProgress(),
+               paths_.queued());
 
     // Append gotten peer to queue
     if (msg.closer_peers) {
@@ -294,10 +318,8 @@ namespace libp2p::protocol::kademlia {
           continue;
         }
 
-        // New peer add to queue
-        if (auto [it, ok] = nearest_peer_ids_.emplace(peer.info.id); ok) {
-          queue_.emplace(*it, target_);
-        }
+        // New peer add to queue of path
+        paths_.add(path, peer.info.id);
       }
     }
 
@@ -311,8 +333,12 @@ namespace libp2p::protocol::kademlia {
       }
 
       received_records_->insert({remote_peer_id, value});
+      paths_.converge(path);
 
-      if (received_records_->size() >= config_.valueLookupsQuorum) {
+      // Disjoint paths check consistency instead of responses count
+      if (paths_.disjoint()
+              ? paths_.quorum()
+              : received_records_->size() >= config_.valueLookupsQuorum) {
         std::vector<Value> values;
         std::transform(received_records_->begin(),
                        received_records_->end(),
@@ -329,6 +355,9 @@ namespace libp2p::protocol::kademlia {
         // Return result to upstear
         done_ = true;
         log_.debug("done");
+        if (timer_) {
+          timer_->observe();
+        }
         handler_(best);
 
         // Inform peer of new value
@@ -46,6 +46,7 @@ namespace libp2p::protocol::kademlia {
         bus_(std::move(bus)),
         random_generator_(std::move(random_generator)),
         self_id_(host_->getId()),
+        response_times_(std::make_shared<ResponseTimes>()),
         log_("Kademlia", "kademlia") {
     BOOST_ASSERT(host_ != nullptr);
     BOOST_ASSERT(storage_ != nullptr);
@@ -69,6 +70,8 @@ namespace libp2p::protocol::kademlia {
     // save himself into peer repo
     addPeer(host_->getPeerInfo(), true);
 
+    restorePeers();
+
     // handle streams for observed protocol
     host_->setProtocolHandler(
         config_.protocols, [wp = weak_from_this()](StreamAndProtocol stream) {
@@ -555,6 +558,34 @@ namespace libp2p::protocol::kademlia {
     return findPeer(peer_id, handler);
   }
 
+  void KademliaImpl::restorePeers() {
+    auto &repo = host_->getPeerRepository();
+    const std::set<peer::ProtocolName> protocols(config_.protocols.begin(),
+                                                 config_.protocols.end());
+    auto self = host_->getId();
+    size_t restored = 0;
+    for (const auto &peer : repo.getProtocolRepository().getPeers()) {
+      if (peer == self) {
+        continue;
+      }
+      auto supported =
+          repo.getProtocolRepository().supportsProtocols(peer, protocols);
+      if (not supported or supported.value().empty()) {
+        continue;
+      }
+      auto addresses = repo.getAddressRepository().getAddresses(peer);
+      if (not addresses or addresses.value().empty()) {
+        continue;
+      }
+      if (peer_routing_table_->update(peer, false, false)) {
+        ++restored;
+      }
+    }
+    if (restored != 0) {
+      log_.debug("{} peers are restored from peer repository", restored);
+    }
+  }
+
   void KademliaImpl::randomWalk() {
     BOOST_ASSERT(config_.randomWalk.enabled);
 
@@ -601,6 +632,12 @@ namespace libp2p::protocol::kademlia {
     log_.debug("session completed, total sessions: {}", sessions_.size());
   }
 
+  void KademliaImpl::onResponseTime(const peer::PeerId &peer_id,
+                                    std::chrono::microseconds elapsed) {
+    host_->getPeerRepository().getLatencyRepository().addRoundTrip(peer_id,
+                                                                   elapsed);
+  }
+
   void KademliaImpl::handleProtocol(StreamAndProtocol stream_and_protocol) {
     auto &stream = stream_and_protocol.stream;
 
@@ -642,6 +679,7 @@ namespace libp2p::protocol::kademlia {
                                               shared_from_this(),
                                               content_routing_table_,
                                               peer_routing_table_,
+                                              response_times_,
                                               shared_from_this(),
                                               validator_,
                                               std::move(key),
@@ -666,6 +704,7 @@ namespace libp2p::protocol::kademlia {
                                                    scheduler_,
                                                    shared_from_this(),
                                                    peer_routing_table_,
+                                                   response_times_,
                                                    std::move(content_id),
                                                    std::move(handler));
   }
@@ -678,6 +717,7 @@ namespace libp2p::protocol::kademlia {
                                               shared_from_this(),
                                               shared_from_this(),
                                               peer_routing_table_,
+                                              response_times_,
                                               std::move(peer_id),
                                               std::move(handler));
   }
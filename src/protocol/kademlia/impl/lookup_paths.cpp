@@ -0,0 +1,166 @@
+/**
+ * Copyright Quadrivium LLC
+ * All Rights Reserved
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <libp2p/protocol/kademlia/impl/lookup_paths.hpp>
+
+#include <algorithm>
+
+namespace libp2p::protocol::kademlia {
+
+  LookupPaths::LookupPaths(const Config &config,
+                           const NodeId &target,
+                           std::vector<PeerId> nearest_peer_ids,
+                           std::shared_ptr<ResponseTimes> response_times)
+      : config_(config),
+        target_(target),
+        response_times_(std::move(response_times)),
+        paths_(std::max<size_t>(config_.disjointPaths, 1)) {
+    std::vector<PeerIdWithDistance> nearest;
+    nearest.reserve(nearest_peer_ids.size());
+    for (auto &peer_id : nearest_peer_ids) {
+      if (auto [it, ok] = known_peer_ids_.emplace(std::move(peer_id)); ok) {
+        nearest.emplace_back(*it, target_);
+      }
+    }
+
+    // Closest peers are dealt round-robin, so that every path starts close
+    std::sort(nearest.begin(), nearest.end());
+    for (size_t i = 0; i < nearest.size(); ++i) {
+      paths_[i % paths_.size()].queue.push(nearest[i]);
+    }
+  }
+
+  bool LookupPaths::add(size_t path, const PeerId &peer_id) {
+    BOOST_ASSERT(path < paths_.size());
+    auto [it, ok] = known_peer_ids_.emplace(peer_id);
+    if (ok) {
+      paths_[path].queue.emplace(*it, target_);
+    }
+    return ok;
+  }
+
+  bool LookupPaths::hasFreeSlot(const Path &path) const {
+    return path.requests - path.slow_requests < config_.requestConcurency
+       and path.requests < std::max(config_.requestConcurency,
+                                    config_.maxRequestConcurency);
+  }
+
+  std::optional<LookupPaths::Next> LookupPaths::next(
+      const peer::LatencyRepository &latency) {
+    for (size_t i = 0; i < paths_.size(); ++i) {
+      auto index = (next_path_ + i) % paths_.size();
+      auto &path = paths_[index];
+      if (path.queue.empty() or not hasFreeSlot(path)
+          or (disjoint() and path.converged)) {
+        continue;
+      }
+      next_path_ = (index + 1) % paths_.size();
+      return Next{
+          .path = index,
+          .peer_id = popPreferredPeer(
+              path.queue, config_.latencySelectionWindow, latency),
+      };
+    }
+    return std::nullopt;
+  }
+
+  std::optional<Time> LookupPaths::slowRequestTime() const {
+    if (response_times_ == nullptr) {
+      return std::nullopt;
+    }
+    auto time = response_times_->percentile(config_.slowRequestPercentile);
+    if (not time) {
+      return std::nullopt;
+    }
+    time = std::max<Time>(*time, config_.minSlowRequestTime);
+    if (*time >= config_.responseTimeout) {
+      return std::nullopt;
+    }
+    return time;
+  }
+
+  void LookupPaths::begin(size_t path,
+                          const PeerId &peer_id,
+                          basic::Scheduler::Handle slow_timer) {
+    BOOST_ASSERT(path < paths_.size());
+    auto [it, ok] =
+        requests_.emplace(peer_id,
+                          Request{
+                              .path = path,
+                              .started = std::chrono::steady_clock::now(),
+                              .slow_timer = std::move(slow_timer),
+                          });
+    if (ok) {
+      ++paths_[path].requests;
+    }
+  }
+
+  bool LookupPaths::slow(const PeerId &peer_id) {
+    auto it = requests_.find(peer_id);
+    if (it == requests_.end() or it->second.slow) {
+      return false;
+    }
+    it->second.slow = true;
+    ++paths_[it->second.path].slow_requests;
+    return true;
+  }
+
+  std::optional<size_t> LookupPaths::finish(const PeerId &peer_id,
+                                            bool responded) {
+    auto it = requests_.find(peer_id);
+    if (it == requests_.end()) {
+      return std::nullopt;
+    }
+    auto &request = it->second;
+    if (responded and response_times_ != nullptr) {
+      response_times_->add(std::chrono::duration_cast<Time>(
+          std::chrono::steady_clock::now() - request.started));
+    }
+    auto &path = paths_[request.path];
+    --path.requests;
+    if (request.slow) {
+      --path.slow_requests;
+    }
+    auto index = request.path;
+    requests_.erase(it);
+    return index;
+  }
+
+  void LookupPaths::converge(size_t path) {
+    BOOST_ASSERT(path < paths_.size());
+    if (not paths_[path].converged) {
+      paths_[path].converged = true;
+      ++converged_;
+    }
+  }
+
+  bool LookupPaths::disjoint() const {
+    return paths_.size() > 1;
+  }
+
+  bool LookupPaths::quorum() const {
+    if (not disjoint()) {
+      return converged_ != 0;
+    }
+    auto needed = config_.disjointPathsQuorum == 0
+                    ? paths_.size() / 2 + 1
+                    : std::min(config_.disjointPathsQuorum, paths_.size());
+    return converged_ >= needed;
+  }
+
+  size_t LookupPaths::inProgress() const {
+    return requests_.size();
+  }
+
+  size_t LookupPaths::queued() const {
+    size_t queued = 0;
+    for (const auto &path : paths_) {
+      queued += path.queue.size();
+    }
+    return queued;
+  }
+
+}  // namespace libp2p::protocol::kademlia
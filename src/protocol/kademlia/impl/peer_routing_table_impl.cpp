@@ -6,6 +6,7 @@
 
 #include <libp2p/protocol/kademlia/impl/peer_routing_table_impl.hpp>
 
+#include <algorithm>
 #include <numeric>
 
 OUTCOME_CPP_DEFINE_CATEGORY(libp2p::protocol::kademlia,
@@ -42,13 +43,8 @@ namespace libp2p::protocol::kademlia {
     return peers_.size();
   }
 
-  void Bucket::append(const Bucket &bucket) {
-    peers_.insert(peers_.end(), bucket.peers_.begin(), bucket.peers_.end());
-  }
-
-  void Bucket::sort(const NodeId &node_id) {
-    XorDistanceComparator cmp(node_id);
-    peers_.sort(cmp);
+  const std::vector<BucketPeerInfo> &Bucket::peers() const {
+    return peers_;
   }
 
   auto Bucket::find(const peer::PeerId &p) const {
@@ -60,9 +56,8 @@ namespace libp2p::protocol::kademlia {
   bool Bucket::moveToFront(const PeerId &pid) {
     auto it = find(pid);
     if (it != peers_.end()) {
-      if (it != peers_.begin()) {
-        peers_.splice(peers_.begin(), peers_, it);
-      }
+      auto pos = peers_.begin() + (it - peers_.cbegin());
+      std::rotate(peers_.begin(), pos, std::next(pos));
       return false;
     }
     return true;
@@ -86,15 +81,6 @@ namespace libp2p::protocol::kademlia {
     return result;
   }
 
-  void Bucket::truncate(size_t limit) {
-    if (limit == 0) {
-      peers_.clear();
-    } else if (peers_.size() > limit) {
-      peers_.erase(std::next(peers_.begin(), static_cast<long>(limit)),
-                   peers_.end());
-    }
-  }
-
   std::vector<peer::PeerId> Bucket::peerIds() const {
     std::vector<peer::PeerId> peerIds;
     peerIds.reserve(peers_.size());
@@ -122,14 +108,14 @@ namespace libp2p::protocol::kademlia {
   Bucket Bucket::split(size_t commonLenPrefix, const NodeId &target) {
     Bucket b{};
 
-    std::list<BucketPeerInfo> new_peers;
+    std::vector<BucketPeerInfo> new_peers;
+    new_peers.reserve(peers_.size());
 
-    while (!peers_.empty()) {
-      auto it = peers_.begin();
-      if (it->node_id.commonPrefixLen(target) > commonLenPrefix) {
-        b.peers_.splice(b.peers_.end(), peers_, it);
+    for (auto &peer : peers_) {
+      if (peer.node_id.commonPrefixLen(target) > commonLenPrefix) {
+        b.peers_.push_back(std::move(peer));
       } else {
-        new_peers.splice(new_peers.end(), peers_, it);
+        new_peers.push_back(std::move(peer));
       }
     }
 
@@ -170,27 +156,45 @@ namespace libp2p::protocol::kademlia {
     size_t cpl = node_id.commonPrefixLen(local_);
     size_t bucketId = getBucketId(buckets_, cpl);
 
-    // make a copy of a bucket
-    auto bucket = buckets_.at(bucketId);
+    // distance to target is computed once per candidate
+    std::vector<std::pair<Hash256, const peer::PeerId *>> candidates;
+    auto collect = [&](const Bucket &bucket) {
+      for (const auto &peer : bucket.peers()) {
+        candidates.emplace_back(peer.node_id.distance(node_id), &peer.peer_id);
+      }
+    };
+
+    auto &bucket = buckets_.at(bucketId);
+    candidates.reserve(bucket.size());
+    collect(bucket);
     if (bucket.size() < count) {
       // In the case of an unusual split, one bucket may be short or empty.
       // if this happens, search both surrounding buckets for nearby peers
       if (bucketId > 0) {
-        auto &left = buckets_.at(bucketId - 1);
-        bucket.append(left);
+        collect(buckets_.at(bucketId - 1));
       }
       if (bucketId < buckets_.size() - 1) {
-        auto &right = buckets_.at(bucketId + 1);
-        bucket.append(right);
+        collect(buckets_.at(bucketId + 1));
       }
     }
 
-    // sort bucket in ascending order by XOR distance from local peer.
-    bucket.sort(node_id);
-
-    bucket.truncate(count);
-
-    return bucket.peerIds();
+    // select closest peers in ascending order by XOR distance from target
+    auto limit = std::min(count, candidates.size());
+    auto middle = candidates.begin() + static_cast<ptrdiff_t>(limit);
+    std::partial_sort(candidates.begin(),
+                      middle,
+                      candidates.end(),
+                      [](const auto &a, const auto &b) {
+                        return a.first < b.first;
+                      });
+
+    std::vector<peer::PeerId> result;
+    result.reserve(limit);
+    std::transform(candidates.begin(),
+                   middle,
+                   std::back_inserter(result),
+                   [](const auto &candidate) { return *candidate.second; });
+    return result;
   }
 
   namespace {
@@ -0,0 +1,48 @@
+/**
+ * Copyright Quadrivium LLC
+ * All Rights Reserved
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <libp2p/protocol/kademlia/impl/response_times.hpp>
+
+#include <algorithm>
+
+namespace libp2p::protocol::kademlia {
+
+  namespace {
+    // percentile of fewer samples is mostly noise
+    constexpr size_t kMinSamples = 8;
+  }  // namespace
+
+  ResponseTimes::ResponseTimes(size_t capacity)
+      : capacity_(std::max<size_t>(capacity, kMinSamples)) {
+    samples_.reserve(capacity_);
+  }
+
+  void ResponseTimes::add(Time time) {
+    if (samples_.size() < capacity_) {
+      samples_.push_back(time);
+      return;
+    }
+    samples_[next_] = time;
+    next_ = (next_ + 1) % capacity_;
+  }
+
+  std::optional<Time> ResponseTimes::percentile(double q) const {
+    if (samples_.size() < kMinSamples or q <= 0 or q >= 1) {
+      return std::nullopt;
+    }
+    auto samples = samples_;
+    auto nth = samples.begin()
+             + std::min(samples.size() - 1,
+                        static_cast<size_t>(q * samples.size()));
+    std::nth_element(samples.begin(), nth, samples.end());
+    return *nth;
+  }
+
+  size_t ResponseTimes::size() const {
+    return samples_.size();
+  }
+
+}  // namespace libp2p::protocol::kademlia
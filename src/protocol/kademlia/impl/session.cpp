@@ -87,7 +87,7 @@ namespace libp2p::protocol::kademlia {
     }
 
     for (auto &pair : response_handlers_) {
-      pair.second.reset();
+      pair.second.timeout.reset();
       pair.first->onResult(shared_from_this(), reason.as_failure());
     }
     response_handlers_.clear();
@@ -182,9 +182,10 @@ namespace libp2p::protocol::kademlia {
     for (auto it = response_handlers_.begin();
          it != response_handlers_.end();) {
       auto cit = it++;
-      auto &[response_handler, timeout_handle] = *cit;
+      auto &[response_handler, pending] = *cit;
       if (response_handler->match(msg)) {
-        timeout_handle.reset();
+        pending.timeout.reset();
+        onResponseTime(pending.sent);
         response_handler->onResult(shared_from_this(), msg);
         response_handlers_.erase(cit);
         pocessed = true;
@@ -267,19 +268,19 @@ namespace libp2p::protocol::kademlia {
       return;
     }
 
-    response_handlers_.emplace(
-        response_handler,
-        scheduler->scheduleWithHandle(
-            [wp = weak_from_this(), response_handler] {
-              if (auto self = wp.lock()) {
-                if (response_handler) {
-                  self->cancelResponseTimeout(response_handler);
-                  response_handler->onResult(self, Error::TIMEOUT);
-                  self->close();
-                }
-              }
-            },
-            response_handler->responseTimeout()));
+    auto &pending = response_handlers_[response_handler];
+    pending.sent = std::chrono::steady_clock::now();
+    pending.timeout = scheduler->scheduleWithHandle(
+        [wp = weak_from_this(), response_handler] {
+          if (auto self = wp.lock()) {
+            if (response_handler) {
+              self->cancelResponseTimeout(response_handler);
+              response_handler->onResult(self, Error::TIMEOUT);
+              self->close();
+            }
+          }
+        },
+        response_handler->responseTimeout());
   }
 
   void Session::cancelResponseTimeout(
@@ -290,9 +291,20 @@ namespace libp2p::protocol::kademlia {
 
     if (auto it = response_handlers_.find(response_handler);
         it != response_handlers_.end()) {
-      it->second.reset();
+      it->second.timeout.reset();
       response_handlers_.erase(it);
     }
   }
 
+  void Session::onResponseTime(std::chrono::steady_clock::time_point sent) {
+    auto session_host = session_host_.lock();
+    auto peer_id_res = stream_->remotePeerId();
+    if (session_host and peer_id_res) {
+      session_host->onResponseTime(
+          peer_id_res.value(),
+          std::chrono::duration_cast<std::chrono::microseconds>(
+              std::chrono::steady_clock::now() - sent));
+    }
+  }
+
 }  // namespace libp2p::protocol::kademlia
@@ -0,0 +1,207 @@
+/**
+ * Copyright Quadrivium LLC
+ * All Rights Reserved
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <libp2p/protocol/kademlia/impl/storage_backend_sqlite.hpp>
+
+#include <limits>
+
+#include <libp2p/protocol/kademlia/error.hpp>
+
+namespace libp2p::protocol::kademlia {
+
+  namespace {
+    constexpr auto kNeverExpires = std::numeric_limits<int64_t>::max();
+  }  // namespace
+
+  StorageBackendSqlite::StorageBackendSqlite(
+      std::shared_ptr<storage::SQLiteWriteQueue> queue)
+      : StorageBackendSqlite(std::move(queue), Config{}) {}
+
+  StorageBackendSqlite::StorageBackendSqlite(
+      std::shared_ptr<storage::SQLiteWriteQueue> queue, Config config)
+      : queue_(std::move(queue)),
+        config_(config),
+        log_(log::createLogger("KademliaStorage")) {
+    BOOST_ASSERT(queue_ != nullptr);
+    auto &db = queue_->db();
+
+    db << "CREATE TABLE IF NOT EXISTS kademlia_records ("
+          "key BLOB PRIMARY KEY, "
+          "value BLOB NOT NULL, "
+          "expires INTEGER NOT NULL) WITHOUT ROWID;";
+    db << "CREATE INDEX IF NOT EXISTS kademlia_records_expires "
+          "ON kademlia_records (expires);";
+
+    upsert_ = db.createStatement(
+        "INSERT OR REPLACE INTO kademlia_records (key, value, expires) "
+        "VALUES (?, ?, ?);");
+    delete_ = db.createStatement("DELETE FROM kademlia_records WHERE key = ?;");
+    select_ = db.createStatement(
+        "SELECT value, expires FROM kademlia_records "
+        "WHERE key = ? AND expires > ?;");
+    delete_expired_ = db.createStatement(
+        "DELETE FROM kademlia_records WHERE expires <= ?;");
+  }
+
+  outcome::result<void> StorageBackendSqlite::putValue(Key key, Value value) {
+    return write(std::move(key), Record{std::move(value), kNeverExpires});
+  }
+
+  outcome::result<Value> StorageBackendSqlite::getValue(const Key &key) const {
+    OUTCOME_TRY(record, find(key));
+    return std::move(record.value);
+  }
+
+  outcome::result<void> StorageBackendSqlite::erase(const Key &key) {
+    return write(key, std::nullopt);
+  }
+
+  bool StorageBackendSqlite::expires() const {
+    return true;
+  }
+
+  outcome::result<void> StorageBackendSqlite::putRecord(Key key,
+                                                        Value value,
+                                                        Time ttl) {
+    return write(
+        std::move(key),
+        Record{std::move(value),
+               storage::SQLiteWriteQueue::now() + ttl.count()});
+  }
+
+  outcome::result<ValueAndTime> StorageBackendSqlite::getRecord(
+      const Key &key) const {
+    OUTCOME_TRY(record, find(key));
+    return ValueAndTime{
+        std::move(record.value),
+        Time{record.expires - storage::SQLiteWriteQueue::now()}};
+  }
+
+  outcome::result<void> StorageBackendSqlite::wipeExpired() {
+    OUTCOME_TRY(flush());
+    auto now = storage::SQLiteWriteQueue::now();
+    auto wiped = queue_->db().execCommand(delete_expired_, now);
+    if (wiped < 0) {
+      return Error::INTERNAL_ERROR;
+    }
+    for (auto it = lru_.begin(); it != lru_.end();) {
+      if (it->record.expires <= now) {
+        index_.erase(it->key);
+        it = lru_.erase(it);
+      } else {
+        ++it;
+      }
+    }
+    log_->debug("{} expired records are wiped", wiped);
+    return outcome::success();
+  }
+
+  outcome::result<void> StorageBackendSqlite::flush() {
+    if (not queue_->flush()) {
+      return Error::INTERNAL_ERROR;
+    }
+    return outcome::success();
+  }
+
+  outcome::result<StorageBackendSqlite::Record> StorageBackendSqlite::find(
+      const Key &key) const {
+    auto now = storage::SQLiteWriteQueue::now();
+
+    prunePending();
+    if (auto it = pending_.find(key); it != pending_.end()) {
+      const auto &record = it->second.record;
+      if (not record or record->expires <= now) {
+        return Error::VALUE_NOT_FOUND;
+      }
+      return *record;
+    }
+
+    if (auto it = index_.find(key); it != index_.end()) {
+      if (it->second->record.expires <= now) {
+        uncache(key);
+        return Error::VALUE_NOT_FOUND;
+      }
+      lru_.splice(lru_.begin(), lru_, it->second);
+      return it->second->record;
+    }
+
+    std::optional<Record> record;
+    auto ok = queue_->db().execQuery(
+        select_,
+        [&](Value value, Expires expires) {
+          record = Record{std::move(value), expires};
+        },
+        key,
+        now);
+    if (not ok) {
+      return Error::INTERNAL_ERROR;
+    }
+    if (not record) {
+      return Error::VALUE_NOT_FOUND;
+    }
+    cache(key, *record);
+    return std::move(*record);
+  }
+
+  void StorageBackendSqlite::cache(const Key &key, const Record &record) const {
+    if (config_.cache_size == 0) {
+      return;
+    }
+    if (auto it = index_.find(key); it != index_.end()) {
+      it->second->record = record;
+      lru_.splice(lru_.begin(), lru_, it->second);
+      return;
+    }
+    lru_.push_front({key, record});
+    index_.emplace(key, lru_.begin());
+    if (lru_.size() > config_.cache_size) {
+      index_.erase(lru_.back().key);
+      lru_.pop_back();
+    }
+  }
+
+  void StorageBackendSqlite::uncache(const Key &key) const {
+    if (auto it = index_.find(key); it != index_.end()) {
+      lru_.erase(it->second);
+      index_.erase(it);
+    }
+  }
+
+  outcome::result<void> StorageBackendSqlite::write(
+      Key key, std::optional<Record> record) {
+    if (record) {
+      cache(key, *record);
+    } else {
+      uncache(key);
+    }
+    prunePending();
+
+    // queue may commit the write at once
+    auto commits = queue_->commits();
+    queue_->push([upsert = upsert_, remove = delete_, key, record](
+                     storage::SQLite &db) {
+      if (not record) {
+        return db.execCommand(remove, key);
+      }
+      return db.execCommand(upsert, key, record->value, record->expires);
+    });
+    pending_.insert_or_assign(std::move(key),
+                              Pending{std::move(record), commits});
+    return outcome::success();
+  }
+
+  void StorageBackendSqlite::prunePending() const {
+    auto commits = queue_->commits();
+    if (commits == pruned_commits_) {
+      return;
+    }
+    std::erase_if(pending_, [commits](const auto &p) {
+      return p.second.commits < commits;
+    });
+    pruned_commits_ = commits;
+  }
+
+}  // namespace libp2p::protocol::kademlia
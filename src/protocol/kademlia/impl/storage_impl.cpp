@@ -37,6 +37,11 @@ namespace libp2p::protocol::kademlia {
   StorageImpl::~StorageImpl() = default;
 
   outcome::result<void> StorageImpl::putValue(Key key, Value value) {
+    if (backend_->expires()) {
+      return backend_->putRecord(
+          std::move(key), std::move(value), config_.storageRecordTTL);
+    }
+
     OUTCOME_TRY(backend_->putValue(key, value));
 
     auto now = scheduler_->now();
@@ -57,6 +62,11 @@ namespace libp2p::protocol::kademlia {
   }
 
   outcome::result<ValueAndTime> StorageImpl::getValue(const Key &key) const {
+    if (backend_->expires()) {
+      OUTCOME_TRY(record, backend_->getRecord(key));
+      return {std::move(record.first), scheduler_->now() + record.second};
+    }
+
     auto &idx = table_->get<ByKey>();
     auto it = idx.find(key);
     if (it == idx.end()) {
@@ -67,6 +77,10 @@ namespace libp2p::protocol::kademlia {
   }
 
   bool StorageImpl::hasValue(const Key &key) const {
+    if (backend_->expires()) {
+      return backend_->getRecord(key).has_value();
+    }
+
     auto &idx = table_->get<ByKey>();
     auto it = idx.find(key);
     if (it == idx.end()) {
@@ -76,6 +90,13 @@ namespace libp2p::protocol::kademlia {
   }
 
   void StorageImpl::onRefreshTimer() {
+    // backend wipes expired records by itself, the table is not used
+    if (backend_->expires()) {
+      std::ignore = backend_->wipeExpired();
+      setTimerRefresh();
+      return;
+    }
+
     auto now = scheduler_->now();
 
     // cleanup expired records
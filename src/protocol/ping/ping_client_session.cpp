@@ -20,6 +20,8 @@ namespace libp2p::protocol {
       : scheduler_{scheduler},
         bus_{bus},
         channel_{bus_.getChannel<event::protocol::PeerIsDeadChannel>()},
+        round_trip_channel_{
+            bus_.getChannel<event::protocol::RoundTripMeasuredChannel>()},
         stream_{std::move(stream)},
         rand_gen_{std::move(rand_gen)},
         config_{config},
@@ -54,6 +56,7 @@ namespace libp2p::protocol {
         config_.timeout);
 
     write_buffer_ = rand_gen_->randomBytes(config_.message_size);
+    write_started_ = std::chrono::steady_clock::now();
     writeReturnSize(stream_,
                     write_buffer_,
                     [self{shared_from_this()}](outcome::result<size_t> r) {
@@ -99,6 +102,15 @@ namespace libp2p::protocol {
       return close();
     }
 
+    if (round_trip_channel_.hasSubscribers()) {
+      if (auto peer_id_res = stream_->remotePeerId()) {
+        round_trip_channel_.publish(
+            {peer_id_res.value(),
+             std::chrono::duration_cast<std::chrono::microseconds>(
+                 std::chrono::steady_clock::now() - write_started_)});
+      }
+    }
+
     timer_ = scheduler_->scheduleWithHandle(
         [weak{weak_from_this()}] {
           if (auto self = weak.lock()) {
@@ -35,6 +35,20 @@ namespace libp2p::security::noise {
     return res;
   }
 
+  outcome::result<size_t> NoiseCCP1305Impl::encryptInto(uint64_t nonce,
+                                                        BytesIn plaintext,
+                                                        BytesIn aad,
+                                                        BytesOut out) {
+    return ccp_->encryptInto(ccp_->uint64toNonce(nonce), plaintext, aad, out);
+  }
+
+  outcome::result<size_t> NoiseCCP1305Impl::decryptInto(uint64_t nonce,
+                                                        BytesIn ciphertext,
+                                                        BytesIn aad,
+                                                        BytesOut out) {
+    return ccp_->decryptInto(ccp_->uint64toNonce(nonce), ciphertext, aad, out);
+  }
+
   std::shared_ptr<AEADCipher> NamedCCPImpl::cipher(Key32 key) {
     return std::make_shared<NoiseCCP1305Impl>(key);
   }
@@ -7,6 +7,7 @@
 #include <libp2p/security/noise/noise_connection.hpp>
 
 #include <libp2p/basic/read_return_size.hpp>
+#include <libp2p/basic/write_return_size.hpp>
 #include <libp2p/common/ambigous_size.hpp>
 #include <libp2p/crypto/x25519_provider/x25519_provider_impl.hpp>
 #include <libp2p/security/noise/crypto/interfaces.hpp>
@@ -82,20 +83,33 @@ namespace libp2p::connection {
                                  size_t bytes,
                                  OperationContext ctx,
                                  ReadCallbackFunc cb) {
-    if (not frame_buffer_->empty()) {
-      auto n{std::min(bytes, frame_buffer_->size())};
-      auto begin{frame_buffer_->begin()};
-      auto end{begin + static_cast<int64_t>(n)};
-      std::copy(begin, end, out.begin());
-      frame_buffer_->erase(begin, end);
+    if (frame_read_offset_ < frame_buffer_->size()) {
+      auto n{std::min(bytes, frame_buffer_->size() - frame_read_offset_)};
+      auto begin{frame_buffer_->begin()
+                 + static_cast<int64_t>(frame_read_offset_)};
+      std::copy(begin, begin + static_cast<int64_t>(n), out.begin());
+      frame_read_offset_ += n;
       return cb(n);
     }
     framer_->read(
         [self{shared_from_this()}, out, bytes, cb{std::move(cb)}, ctx](
             auto _data) mutable {
           OUTCOME_CB(data, _data);
-          OUTCOME_CB(decrypted, self->decoder_cs_->decrypt({}, *data, {}));
-          self->frame_buffer_->assign(decrypted.begin(), decrypted.end());
+          self->frame_read_offset_ = 0;
+          if (data->size() >= security::noise::kTagSize
+              and bytes >= data->size() - security::noise::kTagSize) {
+            // whole frame fits, open it right into the client's buffer
+            auto result =
+                self->decoder_cs_->decryptInto(*data, {}, out.first(bytes));
+            data->clear();
+            if (result.has_value() and result.value() == 0) {
+              // empty frame
+              return self->readSome(out, bytes, ctx, std::move(cb));
+            }
+            return cb(result);
+          }
+          OUTCOME_CB(n, self->decoder_cs_->decryptInto(*data, {}, *data));
+          data->resize(n);
           self->readSome(out, bytes, ctx, std::move(cb));
         });
   }
@@ -104,31 +118,53 @@ namespace libp2p::connection {
                               size_t bytes,
                               NoiseConnection::OperationContext ctx,
                               basic::Writer::WriteCallbackFunc cb) {
-    auto *self{this};  // for OUTCOME_CB
     if (0 == bytes) {
       BOOST_ASSERT(ctx.bytes_served >= ctx.total_bytes);
       eraseWriteBuffer(ctx.write_buffer);
       return cb(ctx.total_bytes);
     }
     auto n{std::min(bytes, security::noise::kMaxPlainText)};
-    OUTCOME_CB(encrypted, encoder_cs_->encrypt({}, in.subspan(0, n), {}));
     if (write_buffers_.end() == ctx.write_buffer) {
-      constexpr auto dummy_size = 1;
-      constexpr auto dummy_value = 0x0;
-      ctx.write_buffer =
-          write_buffers_.emplace(write_buffers_.end(), dummy_size, dummy_value);
+      ctx.write_buffer = acquireWriteBuffer();
     }
-    ctx.write_buffer->swap(encrypted);
-    framer_->write(*ctx.write_buffer,
-                   [self{shared_from_this()},
-                    in{in.subspan(static_cast<int64_t>(n))},
-                    bytes{bytes - n},
-                    cb{std::move(cb)},
-                    ctx](auto _n) mutable {
-                     OUTCOME_CB(n, _n);
-                     ctx.bytes_served += n;
-                     self->write(in, bytes, ctx, std::move(cb));
-                   });
+    writeFrame(in.first(n),
+               *ctx.write_buffer,
+               [self{shared_from_this()},
+                in{in.subspan(n)},
+                bytes{bytes - n},
+                cb{std::move(cb)},
+                ctx](auto _n) mutable {
+                 OUTCOME_CB(n, _n);
+                 ctx.bytes_served += n;
+                 self->write(in, bytes, ctx, std::move(cb));
+               });
+  }
+
+  void NoiseConnection::writeFrame(BytesIn plaintext,
+                                   Bytes &frame,
+                                   WriteCallbackFunc cb) {
+    BOOST_ASSERT(plaintext.size() <= security::noise::kMaxPlainText);
+    auto sealed = encoder_cs_->encryptInto(
+        plaintext,
+        {},
+        BytesOut{frame}.subspan(security::noise::kLengthPrefixSize));
+    if (sealed.has_error()) {
+      return cb(sealed.error());
+    }
+    auto n = sealed.value();
+    frame[0] = static_cast<uint8_t>(n >> 8);
+    frame[1] = static_cast<uint8_t>(n & 0xff);
+    writeReturnSize(
+        connection_,
+        BytesIn{frame}.first(security::noise::kLengthPrefixSize + n),
+        [self{shared_from_this()},
+         plaintext_size{plaintext.size()},
+         cb{std::move(cb)}](outcome::result<size_t> res) {
+          if (res.has_error()) {
+            return cb(res.error());
+          }
+          cb(plaintext_size);
+        });
   }
 
   void NoiseConnection::writeSome(BytesIn in,
@@ -142,6 +178,36 @@ namespace libp2p::connection {
     write(in, bytes, context, std::move(cb));
   }
 
+  void NoiseConnection::writeSomeVectored(
+      std::span<const BytesIn> in,
+      libp2p::basic::Writer::WriteCallbackFunc cb) {
+    OperationContext ctx{
+        .bytes_served = 0,
+        .total_bytes = 0,
+        .write_buffer = acquireWriteBuffer(),
+    };
+    // segments are gathered right into the frame buffer and encrypted in
+    // place
+    auto plaintext = BytesOut{*ctx.write_buffer}.subspan(
+        security::noise::kLengthPrefixSize, security::noise::kMaxPlainText);
+    size_t size = 0;
+    for (auto &segment : in) {
+      auto n = std::min(segment.size(), plaintext.size() - size);
+      std::copy_n(segment.begin(), n, plaintext.begin() + size);
+      size += n;
+      if (size == plaintext.size()) {
+        break;
+      }
+    }
+    writeFrame(plaintext.first(size),
+               *ctx.write_buffer,
+               [self{shared_from_this()}, cb{std::move(cb)}, ctx](
+                   outcome::result<size_t> res) mutable {
+                 self->eraseWriteBuffer(ctx.write_buffer);
+                 cb(res);
+               });
+  }
+
   void NoiseConnection::deferReadCallback(outcome::result<size_t> res,
                                           ReadCallbackFunc cb) {
     connection_->deferReadCallback(res, std::move(cb));
@@ -181,11 +247,25 @@ namespace libp2p::connection {
     return remote_;
   }
 
+  NoiseConnection::BufferList::iterator
+  NoiseConnection::acquireWriteBuffer() {
+    if (free_write_buffers_.empty()) {
+      return write_buffers_.emplace(
+          write_buffers_.end(),
+          security::noise::kLengthPrefixSize + security::noise::kMaxMsgLen);
+    }
+    write_buffers_.splice(write_buffers_.end(),
+                          free_write_buffers_,
+                          free_write_buffers_.begin());
+    return std::prev(write_buffers_.end());
+  }
+
   void NoiseConnection::eraseWriteBuffer(BufferList::iterator &iterator) {
     if (write_buffers_.end() == iterator) {
       return;
     }
-    write_buffers_.erase(iterator);
+    free_write_buffers_.splice(
+        free_write_buffers_.end(), write_buffers_, iterator);
     iterator = write_buffers_.end();
   }
 }  // namespace libp2p::connection
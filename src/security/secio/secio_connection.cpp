@@ -7,8 +7,11 @@
 #include <libp2p/security/secio/secio_connection.hpp>
 
 #include <algorithm>
+#include <array>
+#include <cstring>
 
 #include <arpa/inet.h>
+#include <openssl/mem.h>
 #include <libp2p/basic/read_return_size.hpp>
 #include <libp2p/basic/write_return_size.hpp>
 #include <libp2p/common/ambigous_size.hpp>
@@ -187,15 +190,6 @@ namespace libp2p::connection {
     original_connection_->deferWriteCallback(ec, std::move(cb));
   }
 
-  inline void SecioConnection::popUserData(BytesOut out, size_t bytes) {
-    auto to{out.begin()};
-    for (size_t read = 0; read < bytes; ++read) {
-      *to = user_data_buffer_.front();
-      user_data_buffer_.pop();
-      ++to;
-    }
-  }
-
   void SecioConnection::read(BytesOut out,
                              size_t bytes,
                              basic::Reader::ReadCallbackFunc cb) {
@@ -218,10 +212,7 @@ namespace libp2p::connection {
     size_t read_limit{out_size < bytes ? out_size : bytes};
 
     if (not user_data_buffer_.empty()) {
-      auto bytes_available{user_data_buffer_.size()};
-      size_t to_read{bytes_available < read_limit ? bytes_available
-                                                  : read_limit};
-      popUserData(out, to_read);
+      auto to_read{user_data_buffer_.consume(out.first(read_limit))};
       SL_TRACE(log_, "Successfully read {} bytes", to_read);
       cb(to_read);
       return;
@@ -234,17 +225,27 @@ namespace libp2p::connection {
         user_cb(size_read_res);
         return;
       }
-      self->readSome(out, bytes, user_cb);
+      if (size_read_res.value() == 0) {
+        // empty frame, nothing to return yet
+        self->readSome(out, bytes, user_cb);
+        return;
+      }
+      SL_TRACE(
+          self->log_, "Successfully read {} bytes", size_read_res.value());
+      user_cb(size_read_res);
     };
 
-    readNextMessage(cb_wrapper);
+    readNextMessage(out.first(read_limit), cb_wrapper);
   }
 
-  void SecioConnection::readNextMessage(ReadCallbackFunc cb) {
+  void SecioConnection::readNextMessage(BytesOut out, ReadCallbackFunc cb) {
     original_connection_->read(
         *read_buffer_,
         kLenMarkerSize,
-        [self{shared_from_this()}, buffer = read_buffer_, cb{std::move(cb)}](
+        [self{shared_from_this()},
+         buffer = read_buffer_,
+         out,
+         cb{std::move(cb)}](
             outcome::result<size_t> read_bytes_res) mutable {
           IO_OUTCOME_TRY(len_marker_size, read_bytes_res, cb);
           if (len_marker_size != kLenMarkerSize) {
@@ -268,7 +269,7 @@ namespace libp2p::connection {
           self->original_connection_->read(
               *buffer,
               frame_len,
-              [self, buffer, frame_len, cb{cb}](
+              [self, buffer, frame_len, out, cb{cb}](
                   outcome::result<size_t> read_bytes) mutable {
                 IO_OUTCOME_TRY(read_frame_bytes, read_bytes, cb);
                 if (frame_len != read_frame_bytes) {
@@ -283,27 +284,49 @@ namespace libp2p::connection {
                 SL_TRACE(
                     self->log_, "Received frame with len {}", read_frame_bytes);
                 IO_OUTCOME_TRY(mac_size, self->macSize(), cb);
+                if (frame_len < mac_size) {
+                  self->log_->error("Frame of size {} cannot hold {} bytes MAC",
+                                    frame_len,
+                                    mac_size);
+                  cb(Error::STREAM_IS_BROKEN);
+                  return;
+                }
                 const auto data_size{frame_len - mac_size};
                 auto data_span{std::span(buffer->data(), data_size)};
                 auto mac_span{std::span(*buffer).subspan(data_size, mac_size)};
-                IO_OUTCOME_TRY(remote_mac, self->macRemote(data_span), cb);
-                if (BytesIn(remote_mac) != BytesIn(mac_span)) {
+                std::array<uint8_t, kMaxMacSize> remote_mac{};
+                auto remote_mac_span{std::span(remote_mac).first(mac_size)};
+                if (auto r = self->macRemote(data_span, remote_mac_span);
+                    r.has_error()) {
+                  cb(r.error());
+                  return;
+                }
+                if (CRYPTO_memcmp(
+                        remote_mac_span.data(), mac_span.data(), mac_size)
+                    != 0) {
                   self->log_->error(
                       "Signature does not validate for the received frame");
                   cb(Error::INVALID_MAC);
                   return;
                 }
-                IO_OUTCOME_TRY(decrypted_bytes,
-                               (*self->remote_decryptor_)->crypt(data_span),
-                               cb);
-                size_t decrypted_bytes_len{decrypted_bytes.size()};
-                for (auto &&e : decrypted_bytes) {
-                  self->user_data_buffer_.emplace(std::forward<decltype(e)>(e));
+                auto &decryptor{**self->remote_decryptor_};
+                size_t decrypted_bytes_len{data_size};
+                if (data_size <= out.size()) {
+                  // the whole frame fits, decrypt right into client's buffer
+                  IO_OUTCOME_TRY(
+                      written, decryptor.cryptInto(data_span, out), cb);
+                  decrypted_bytes_len = written;
+                } else {
+                  // AES-CTR is a stream cipher, so decryption is done in place
+                  IO_OUTCOME_TRY(
+                      decrypted, decryptor.cryptInto(data_span, data_span), cb);
+                  decrypted_bytes_len = self->user_data_buffer_.addAndConsume(
+                      data_span.first(decrypted), out);
                 }
                 SL_TRACE(self->log_,
                          "Frame decrypted successfully {} -> {}",
                          frame_len,
-                         decrypted_bytes_len);
+                         data_size);
                 cb(decrypted_bytes_len);
               });
         });
@@ -316,25 +339,42 @@ namespace libp2p::connection {
 
     if (!isInitialized()) {
       cb(Error::CONN_NOT_INITIALIZED);
+      return;
     }
+    ambigousSize(in, bytes);
     IO_OUTCOME_TRY(mac_size, macSize(), cb);
     size_t frame_len{bytes + mac_size};
-    Bytes frame_buffer;
-    constexpr size_t len_field_size{kLenMarkerSize};
-    frame_buffer.reserve(len_field_size + frame_len);
-
-    common::putUint32BE(frame_buffer, frame_len);
-    IO_OUTCOME_TRY(encrypted_data, (*local_encryptor_)->crypt(in), cb);
-    IO_OUTCOME_TRY(mac_data, macLocal(encrypted_data), cb);
-    frame_buffer.insert(frame_buffer.end(),
-                        std::make_move_iterator(encrypted_data.begin()),
-                        std::make_move_iterator(encrypted_data.end()));
-    frame_buffer.insert(frame_buffer.end(),
-                        std::make_move_iterator(mac_data.begin()),
-                        std::make_move_iterator(mac_data.end()));
+
+    if (not write_buffer_ or write_buffer_.use_count() > 1) {
+      // previous frame is still being written
+      write_buffer_ = std::make_shared<Bytes>();
+    }
+    auto frame_buffer{write_buffer_};
+    frame_buffer->resize(kLenMarkerSize + frame_len);
+    BytesOut frame{*frame_buffer};
+
+    auto len_marker{htonl(static_cast<uint32_t>(frame_len))};
+    memcpy(frame.data(), &len_marker, kLenMarkerSize);
+    auto encrypted{frame.subspan(kLenMarkerSize, bytes)};
+    IO_OUTCOME_TRY(encrypted_size,
+                   (*local_encryptor_)->cryptInto(in, encrypted),
+                   cb);
+    if (encrypted_size != bytes) {
+      cb(Error::STREAM_IS_BROKEN);
+      return;
+    }
+    if (auto r = macLocal(encrypted,
+                          frame.subspan(kLenMarkerSize + bytes, mac_size));
+        r.has_error()) {
+      cb(r.error());
+      return;
+    }
+
     basic::Writer::WriteCallbackFunc cb_wrapper =
-        [user_cb{std::move(cb)}, bytes, raw_bytes{frame_buffer.size()}](
-            auto &&res) {
+        [user_cb{std::move(cb)},
+         bytes,
+         frame_buffer,
+         raw_bytes{frame_buffer->size()}](auto &&res) {
           if (not res) {
             return user_cb(res);  // pulling out the error occurred
           }
@@ -343,7 +383,7 @@ namespace libp2p::connection {
           }
           user_cb(bytes);
         };
-    writeReturnSize(original_connection_, frame_buffer, cb_wrapper);
+    writeReturnSize(original_connection_, *frame_buffer, cb_wrapper);
   }
 
   bool SecioConnection::isClosed() const {
@@ -366,14 +406,16 @@ namespace libp2p::connection {
     }
   }
 
-  outcome::result<Bytes> SecioConnection::macLocal(BytesIn message) const {
-    return hmac_provider_->calculateDigest(
-        hash_type_, local_stretched_key_.mac_key, message);
+  outcome::result<void> SecioConnection::macLocal(BytesIn message,
+                                                  BytesOut out) const {
+    return hmac_provider_->calculateDigestInto(
+        hash_type_, local_stretched_key_.mac_key, message, out);
   }
 
-  outcome::result<Bytes> SecioConnection::macRemote(BytesIn message) const {
-    return hmac_provider_->calculateDigest(
-        hash_type_, remote_stretched_key_.mac_key, message);
+  outcome::result<void> SecioConnection::macRemote(BytesIn message,
+                                                   BytesOut out) const {
+    return hmac_provider_->calculateDigestInto(
+        hash_type_, remote_stretched_key_.mac_key, message, out);
   }
 
 }  // namespace libp2p::connection
@@ -0,0 +1,146 @@
+/**
+ * Copyright Quadrivium LLC
+ * All Rights Reserved
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <libp2p/storage/sqlite_write_queue.hpp>
+
+#include <boost/assert.hpp>
+
+namespace libp2p::storage {
+
+  SQLiteWriteQueue::SQLiteWriteQueue(
+      std::shared_ptr<SQLite> db, std::shared_ptr<basic::Scheduler> scheduler)
+      : SQLiteWriteQueue(std::move(db), std::move(scheduler), Config{}) {}
+
+  SQLiteWriteQueue::SQLiteWriteQueue(
+      std::shared_ptr<SQLite> db,
+      std::shared_ptr<basic::Scheduler> scheduler,
+      Config config)
+      : db_(std::move(db)),
+        scheduler_(std::move(scheduler)),
+        config_(config),
+        log_(log::createLogger("SQLiteWriteQueue")) {
+    BOOST_ASSERT(db_ != nullptr);
+    BOOST_ASSERT(scheduler_ != nullptr);
+
+    // WAL lets readers go on while batch is committed, and with it NORMAL
+    // synchronization is still safe against corruption
+    std::string journal_mode;
+    *db_ << "PRAGMA journal_mode = WAL;" >> journal_mode;
+    *db_ << "PRAGMA synchronous = NORMAL;";
+
+    begin_ = db_->createStatement("BEGIN;");
+    commit_ = db_->createStatement("COMMIT;");
+    rollback_ = db_->createStatement("ROLLBACK;");
+  }
+
+  SQLiteWriteQueue::~SQLiteWriteQueue() {
+    if (not flush()) {
+      log_->error("{} writes are lost", writes_.size());
+    }
+  }
+
+  SQLite &SQLiteWriteQueue::db() {
+    return *db_;
+  }
+
+  void SQLiteWriteQueue::push(Write write) {
+    if (writes_.size() >= config_.max_queue_size) {
+      log_->error("queue is full, the oldest write is dropped");
+      writes_.pop_front();
+    }
+    writes_.push_back({std::move(write)});
+    // database may be unavailable for a while, wait for the timer then
+    if (not failing_ and writes_.size() >= config_.max_batch_size) {
+      flush();
+      return;
+    }
+    armFlushTimer();
+  }
+
+  bool SQLiteWriteQueue::flush() {
+    flush_timer_.reset();
+    if (writes_.empty()) {
+      return true;
+    }
+    std::vector<Pending> writes{std::make_move_iterator(writes_.begin()),
+                                std::make_move_iterator(writes_.end())};
+    writes_.clear();
+
+    auto failed = [&] {
+      log_->error("cannot write {} changes: {}",
+                  writes.size(),
+                  db_->getErrorMessage());
+      db_->execCommand(rollback_);
+      retry(std::move(writes));
+      return false;
+    };
+
+    if (db_->execCommand(begin_) < 0) {
+      return failed();
+    }
+    // failed statement does not abort transaction, the rest is committed
+    std::vector<Pending> failed_writes;
+    for (auto &pending : writes) {
+      if (pending.write(*db_) < 0) {
+        log_->warn("cannot write change: {}", db_->getErrorMessage());
+        failed_writes.push_back(pending);
+      }
+    }
+    if (db_->execCommand(commit_) < 0) {
+      return failed();
+    }
+    ++commits_;
+    if (failed_writes.empty()) {
+      failing_ = false;
+      return true;
+    }
+    retry(std::move(failed_writes));
+    return false;
+  }
+
+  void SQLiteWriteQueue::retry(std::vector<Pending> writes) {
+    failing_ = true;
+    size_t dropped = 0;
+    // ahead of writes queued later
+    for (auto it = writes.rbegin(); it != writes.rend(); ++it) {
+      if (++it->attempts >= config_.max_attempts) {
+        ++dropped;
+        continue;
+      }
+      writes_.push_front(std::move(*it));
+    }
+    if (dropped != 0) {
+      log_->error("{} writes are dropped after {} attempts",
+                  dropped,
+                  config_.max_attempts);
+    }
+    if (not writes_.empty()) {
+      armFlushTimer();
+    }
+  }
+
+  size_t SQLiteWriteQueue::size() const {
+    return writes_.size();
+  }
+
+  uint64_t SQLiteWriteQueue::commits() const {
+    return commits_;
+  }
+
+  void SQLiteWriteQueue::armFlushTimer() {
+    if (not flush_timer_) {
+      flush_timer_ = scheduler_->scheduleWithHandle([this] { flush(); },
+                                                    config_.flush_interval);
+    }
+  }
+
+  int64_t SQLiteWriteQueue::now() {
+    return std::chrono::duration_cast<std::chrono::milliseconds>(
+               std::chrono::system_clock::now().time_since_epoch())
+        .count();
+  }
+
+}  // namespace libp2p::storage
@@ -7,6 +7,7 @@
 #include <libp2p/transport/impl/upgrader_impl.hpp>
 
 #include <fmt/format.h>
+#include <libp2p/common/metrics/registry.hpp>
 #include <libp2p/multi/converters/conversion_error.hpp>
 #include <numeric>
 
@@ -36,6 +37,31 @@ namespace {
     }
     return nullptr;
   }
+
+  /// Wraps callback to record handshake duration and failures of protocol
+  libp2p::transport::Upgrader::OnSecuredCallbackFunc measureHandshake(
+      const libp2p::peer::ProtocolName &proto,
+      libp2p::transport::Upgrader::OnSecuredCallbackFunc cb) {
+    auto &registry = libp2p::metrics::Registry::get();
+    libp2p::metrics::Labels labels{{"protocol", proto}};
+    libp2p::metrics::Timer timer{
+        registry.histogram("libp2p_security_handshake_seconds",
+                           "Duration of security handshakes",
+                           libp2p::metrics::latencyBuckets(),
+                           labels)};
+    auto &failures =
+        registry.counter("libp2p_security_handshake_failures_total",
+                         "Failed security handshakes",
+                         labels);
+    return [cb{std::move(cb)}, timer, &failures](auto &&res) {
+      if (res.has_value()) {
+        timer.observe();
+      } else {
+        failures.inc();
+      }
+      cb(std::forward<decltype(res)>(res));
+    };
+  }
 }  // namespace
 
 namespace libp2p::transport {
@@ -211,7 +237,9 @@ namespace libp2p::transport {
             return cb(Error::NO_ADAPTOR_FOUND);
           }
 
-          return adaptor->secureInbound(std::move(conn), std::move(cb));
+          return adaptor->secureInbound(
+              std::move(conn),
+              measureHandshake(proto_res.value(), std::move(cb)));
         });
   }
 
@@ -240,7 +268,9 @@ namespace libp2p::transport {
           }
 
           return adaptor->secureOutbound(
-              std::move(conn), remoteId, std::move(cb));
+              std::move(conn),
+              remoteId,
+              measureHandshake(proto_res.value(), std::move(cb)));
         });
   }
 
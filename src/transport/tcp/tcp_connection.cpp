@@ -199,6 +199,18 @@ namespace libp2p::transport {
                              closeOnError(*this, std::move(cb)));
   }
 
+  void TcpConnection::writeSomeVectored(std::span<const BytesIn> in,
+                                        TcpConnection::WriteCallbackFunc cb) {
+    std::vector<boost::asio::const_buffer> buffers;
+    buffers.reserve(in.size());
+    for (auto &segment : in) {
+      buffers.emplace_back(asioBuffer(segment));
+    }
+    TRACE("{} write some vectored, {} buffers", debug_str_, buffers.size());
+    // asio passes up to 64 buffers into one writev()
+    socket_.async_write_some(buffers, closeOnError(*this, std::move(cb)));
+  }
+
   namespace {
     template <typename Callback, typename Arg>
     void deferCallback(boost::asio::io_context &ctx,
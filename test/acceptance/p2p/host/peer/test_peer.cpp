@@ -184,7 +184,7 @@ Peer::sptr<host::BasicHost> Peer::makeHost(const crypto::KeyPair &keyPair) {
       multiselect, std::move(router), tmgr, cmgr);
 
   auto dialer = std::make_unique<network::DialerImpl>(
-      multiselect, tmgr, cmgr, listener, scheduler_);
+      multiselect, tmgr, cmgr, listener, scheduler_, network::DialerConfig{});
 
   auto network = std::make_unique<network::NetworkImpl>(
       std::move(listener), std::move(dialer), cmgr);
@@ -199,8 +199,13 @@ Peer::sptr<host::BasicHost> Peer::makeHost(const crypto::KeyPair &keyPair) {
 
   auto protocol_repo = std::make_shared<peer::InmemProtocolRepository>();
 
-  auto peer_repo = std::make_unique<peer::PeerRepositoryImpl>(
-      std::move(addr_repo), std::move(key_repo), std::move(protocol_repo));
+  auto latency_repo = std::make_shared<peer::LatencyRepository>();
+
+  auto peer_repo =
+      std::make_unique<peer::PeerRepositoryImpl>(std::move(addr_repo),
+                                                 std::move(key_repo),
+                                                 std::move(protocol_repo),
+                                                 std::move(latency_repo));
 
   return std::make_shared<host::BasicHost>(idmgr,
                                            std::move(network),
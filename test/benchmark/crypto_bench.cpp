@@ -0,0 +1,73 @@
+/**
+ * Copyright Quadrivium LLC
+ * All Rights Reserved
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <libp2p/crypto/crypto_provider/crypto_provider_impl.hpp>
+#include <libp2p/crypto/ecdsa_provider/ecdsa_provider_impl.hpp>
+#include <libp2p/crypto/ed25519_provider/ed25519_provider_impl.hpp>
+#include <libp2p/crypto/hmac_provider/hmac_provider_impl.hpp>
+#include <libp2p/crypto/random_generator/boost_generator.hpp>
+#include <libp2p/crypto/rsa_provider/rsa_provider_impl.hpp>
+#include <libp2p/crypto/secp256k1_provider/secp256k1_provider_impl.hpp>
+
+namespace libp2p::benchmark {
+
+  using crypto::Key;
+  using crypto::PublicKeyCache;
+
+  /// Crypto provider with all providers sharing the key cache
+  std::shared_ptr<crypto::CryptoProvider> makeCryptoProvider(
+      std::shared_ptr<PublicKeyCache> key_cache) {
+    auto csprng = std::make_shared<crypto::random::BoostRandomGenerator>();
+    return std::make_shared<crypto::CryptoProviderImpl>(
+        csprng,
+        std::make_shared<crypto::ed25519::Ed25519ProviderImpl>(key_cache),
+        std::make_shared<crypto::rsa::RsaProviderImpl>(key_cache),
+        std::make_shared<crypto::ecdsa::EcdsaProviderImpl>(key_cache),
+        std::make_shared<crypto::secp256k1::Secp256k1ProviderImpl>(csprng,
+                                                                   key_cache),
+        std::make_shared<crypto::hmac::HmacProviderImpl>());
+  }
+
+  /// Signature verification, with public key decoded on every call (cold)
+  /// or taken from the key cache (warm)
+  template <bool kWarm>
+  void BM_Verify(::benchmark::State &state) {
+    auto key_cache = std::make_shared<PublicKeyCache>(
+        PublicKeyCache::Config{.capacity = kWarm ? 4096u : 0u});
+    auto crypto = makeCryptoProvider(key_cache);
+    auto type = static_cast<Key::Type>(state.range(0));
+    auto keys = crypto->generateKeys(type, crypto::common::RSAKeyType::RSA2048)
+                    .value();
+    Bytes message(256, 0x42);
+    auto signature = crypto->sign(message, keys.privateKey).value();
+
+    // warms cache up
+    if (not crypto->verify(message, signature, keys.publicKey).value()) {
+      state.SkipWithError("verification failed");
+      return;
+    }
+    for (auto _ : state) {
+      auto res = crypto->verify(message, signature, keys.publicKey);
+      ::benchmark::DoNotOptimize(res);
+    }
+  }
+
+  void verifyArgs(::benchmark::internal::Benchmark *b) {
+    b->ArgName("key_type");
+    for (auto type : {Key::Type::RSA,
+                      Key::Type::Ed25519,
+                      Key::Type::Secp256k1,
+                      Key::Type::ECDSA}) {
+      b->Arg(static_cast<int>(type));
+    }
+  }
+
+  BENCHMARK(BM_Verify<false>)->Name("Crypto/Verify/Cold")->Apply(verifyArgs);
+  BENCHMARK(BM_Verify<true>)->Name("Crypto/Verify/Warm")->Apply(verifyArgs);
+
+}  // namespace libp2p::benchmark
@@ -0,0 +1,209 @@
+/**
+ * Copyright Quadrivium LLC
+ * All Rights Reserved
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <queue>
+#include <random>
+
+#include "src/protocol/gossip/impl/message_builder.hpp"
+#include "src/protocol/gossip/impl/peer_context.hpp"
+#include "testutil/libp2p/peer.hpp"
+
+namespace libp2p::benchmark {
+
+  namespace gossip = protocol::gossip;
+
+  /// Forwarding of a new message of state.range(1) bytes to state.range(0)
+  /// peers: every peer gets the message added to its builder and serialized
+  void BM_GossipFanOut(::benchmark::State &state) {
+    auto from = testutil::randomPeerId();
+    Bytes data(state.range(1), 0x42);
+    uint64_t seq = 0;
+    std::vector<gossip::MessageBuilder> builders(state.range(0));
+
+    for (auto _ : state) {
+      gossip::TopicMessage msg{from, ++seq, data, "topic"};
+      auto msg_id = gossip::createMessageId(msg.from, msg.seq_no, msg.data);
+      for (auto &builder : builders) {
+        builder.addMessage(msg, msg_id);
+        auto buffer = builder.serialize();
+        if (not buffer) {
+          state.SkipWithError("serialize failed");
+          return;
+        }
+      }
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+    state.SetBytesProcessed(state.iterations() * state.range(0)
+                            * state.range(1));
+  }
+
+  BENCHMARK(BM_GossipFanOut)
+      ->Name("Gossip/FanOut")
+      ->Args({6, 1024})
+      ->Args({12, 1024})
+      ->Args({50, 1024})
+      ->Args({10, 1 << 20});
+
+  /// Propagation of one message of state.range(0) bytes over a random mesh
+  /// of kPeers peers, kDegree mesh links each, 100 Mbit/s links with 10-50 ms
+  /// latency. state.range(1) enables IDONTWANT. Counts bytes of copies
+  /// received by peers which already had the message
+  void BM_GossipDuplicates(::benchmark::State &state) {
+    constexpr size_t kPeers = 30;
+    constexpr size_t kDegree = 8;
+    constexpr double kBytesPerMs = 100e6 / 8 / 1000;
+    const size_t size = state.range(0);
+    const bool idontwant = state.range(1) != 0;
+
+    struct Link {
+      size_t to;
+      double latency;
+      double busy_until = 0;
+      /// Sender's context of receiving peer
+      std::shared_ptr<gossip::PeerContext> ctx;
+    };
+    std::vector<std::vector<Link>> mesh(kPeers);
+    std::mt19937 rng{0};
+    auto linked = [&](size_t a, size_t b) {
+      return std::any_of(mesh[a].begin(), mesh[a].end(), [b](const Link &l) {
+        return l.to == b;
+      });
+    };
+    for (size_t a = 0; a < kPeers; ++a) {
+      while (mesh[a].size() < kDegree) {
+        size_t b = rng() % kPeers;
+        if (b == a or linked(a, b)) {
+          continue;
+        }
+        double latency = 10 + rng() % 40;
+        mesh[a].push_back({b, latency});
+        mesh[b].push_back({a, latency});
+      }
+    }
+    for (auto &links : mesh) {
+      for (auto &link : links) {
+        link.ctx =
+            std::make_shared<gossip::PeerContext>(testutil::randomPeerId());
+      }
+    }
+    auto link = [&](size_t a, size_t b) -> Link & {
+      return *std::find_if(mesh[a].begin(), mesh[a].end(), [b](auto &l) {
+        return l.to == b;
+      });
+    };
+
+    enum class Type { kSend, kMessage, kDontWant };
+    struct Event {
+      double time;
+      Type type;
+      size_t from;
+      size_t to;
+      bool operator>(const Event &other) const {
+        return time > other.time;
+      }
+    };
+
+    auto from = testutil::randomPeerId();
+    Bytes data(size, 0x42);
+    uint64_t seq = 0;
+    double duplicate_bytes = 0;
+    double sent_bytes = 0;
+
+    for (auto _ : state) {
+      gossip::TopicMessage msg{from, ++seq, data, "topic"};
+      auto msg_id = gossip::createMessageId(msg.from, msg.seq_no, msg.data);
+      std::vector<bool> has(kPeers, false);
+      std::priority_queue<Event, std::vector<Event>, std::greater<>> events;
+      for (auto &links : mesh) {
+        for (auto &l : links) {
+          l.busy_until = 0;
+          l.ctx->dont_send.reset();
+        }
+      }
+
+      auto forward = [&](size_t peer, size_t except, double now) {
+        for (auto &l : mesh[peer]) {
+          if (l.to != except and not l.ctx->dontSend(msg_id)) {
+            l.ctx->message_builder->addMessage(msg, msg_id);
+            events.push({std::max(now, l.busy_until), Type::kSend, peer, l.to});
+          }
+        }
+      };
+
+      has[0] = true;
+      forward(0, 0, 0);
+      while (not events.empty()) {
+        auto e = events.top();
+        events.pop();
+        switch (e.type) {
+          case Type::kSend: {
+            auto &l = link(e.from, e.to);
+            if (l.busy_until > e.time) {
+              events.push({l.busy_until, Type::kSend, e.from, e.to});
+              break;
+            }
+            if (l.ctx->message_builder->empty()) {
+              break;
+            }
+            auto chain = l.ctx->message_builder->serialize();
+            size_t bytes = 0;
+            for (auto &buffer : chain.value()) {
+              bytes += buffer->size();
+            }
+            sent_bytes += bytes;
+            l.busy_until = e.time + bytes / kBytesPerMs;
+            if (chain.value().size() > 1) {
+              events.push(
+                  {l.busy_until + l.latency, Type::kMessage, e.from, e.to});
+            }
+            break;
+          }
+          case Type::kMessage: {
+            if (has[e.to]) {
+              duplicate_bytes += size;
+              break;
+            }
+            has[e.to] = true;
+            if (idontwant) {
+              for (auto &l : mesh[e.to]) {
+                if (l.to != e.from) {
+                  events.push(
+                      {e.time + l.latency, Type::kDontWant, e.to, l.to});
+                }
+              }
+            }
+            forward(e.to, e.from, e.time);
+            break;
+          }
+          case Type::kDontWant: {
+            auto &ctx = *link(e.to, e.from).ctx;
+            if (not ctx.dont_send) {
+              ctx.dont_send.emplace(gossip::Time{3000}, 1024);
+            }
+            ctx.dont_send->insert(msg_id, gossip::Time{0});
+            ctx.message_builder->removeMessage(msg_id);
+            break;
+          }
+        }
+      }
+    }
+    state.counters["duplicate_bytes"] = ::benchmark::Counter(
+        duplicate_bytes, ::benchmark::Counter::kAvgIterations);
+    state.counters["sent_bytes"] =
+        ::benchmark::Counter(sent_bytes, ::benchmark::Counter::kAvgIterations);
+  }
+
+  BENCHMARK(BM_GossipDuplicates)
+      ->Name("Gossip/Duplicates")
+      ->ArgNames({"size", "idontwant"})
+      ->Args({1 << 10, 0})
+      ->Args({1 << 10, 1})
+      ->Args({1 << 20, 0})
+      ->Args({1 << 20, 1});
+
+}  // namespace libp2p::benchmark
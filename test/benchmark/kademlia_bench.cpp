@@ -0,0 +1,70 @@
+/**
+ * Copyright Quadrivium LLC
+ * All Rights Reserved
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <libp2p/protocol/kademlia/impl/peer_routing_table_impl.hpp>
+
+#include "testutil/libp2p/peer.hpp"
+
+namespace libp2p::benchmark {
+
+  using protocol::kademlia::NodeId;
+
+  struct StaticIdentityManager : peer::IdentityManager {
+    const peer::PeerId &getId() const override {
+      return id;
+    }
+
+    const crypto::KeyPair &getKeyPair() const override {
+      return keypair;
+    }
+
+    peer::PeerId id = testutil::randomPeerId();
+    crypto::KeyPair keypair;
+  };
+
+  /// FIND_NODE lookup in a routing table filled with state.range(0) peers
+  void BM_KademliaGetNearestPeers(::benchmark::State &state) {
+    srand(0);  // NOLINT
+    protocol::kademlia::Config config;
+    protocol::kademlia::PeerRoutingTableImpl table{
+        config,
+        std::make_shared<StaticIdentityManager>(),
+        std::make_shared<event::Bus>()};
+    for (int64_t i = 0; i < state.range(0); ++i) {
+      std::ignore = table.update(testutil::randomPeerId(), false);
+    }
+
+    std::vector<NodeId> targets;
+    for (size_t i = 0; i < 1024; ++i) {
+      targets.emplace_back(testutil::randomPeerId());
+    }
+
+    size_t i = 0;
+    for (auto _ : state) {
+      auto peers = table.getNearestPeers(targets[i++ % targets.size()],
+                                         config.closerPeerCount);
+      ::benchmark::DoNotOptimize(peers);
+    }
+    state.counters["table_size"] = static_cast<double>(table.size());
+  }
+
+  void BM_KademliaCommonPrefixLen(::benchmark::State &state) {
+    NodeId a{testutil::randomPeerId()};
+    NodeId b{testutil::randomPeerId()};
+    for (auto _ : state) {
+      ::benchmark::DoNotOptimize(a.commonPrefixLen(b));
+    }
+  }
+
+  BENCHMARK(BM_KademliaGetNearestPeers)
+      ->Name("Kademlia/GetNearestPeers")
+      ->RangeMultiplier(4)
+      ->Range(64, 4096);
+  BENCHMARK(BM_KademliaCommonPrefixLen)->Name("Kademlia/CommonPrefixLen");
+
+}  // namespace libp2p::benchmark
@@ -0,0 +1,169 @@
+/**
+ * Copyright Quadrivium LLC
+ * All Rights Reserved
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <boost/asio/error.hpp>
+#include <boost/asio/io_context.hpp>
+#include <boost/asio/post.hpp>
+
+#include <libp2p/basic/read_buffer.hpp>
+#include <libp2p/basic/read_return_size.hpp>
+#include <libp2p/common/ambigous_size.hpp>
+#include <libp2p/connection/secure_connection.hpp>
+
+namespace libp2p::benchmark {
+
+  /**
+   * In-memory secure connection, one end of a pair.
+   * Bytes written to one end become readable on the other one, callbacks are
+   * posted to io_context so that no syscalls are involved in measurements.
+   */
+  class MemoryConnection
+      : public connection::SecureConnection,
+        public std::enable_shared_from_this<MemoryConnection> {
+   public:
+    using Ptr = std::shared_ptr<MemoryConnection>;
+
+    static std::pair<Ptr, Ptr> makePair(
+        std::shared_ptr<boost::asio::io_context> io,
+        const peer::PeerId &initiator,
+        const peer::PeerId &responder) {
+      auto a =
+          std::make_shared<MemoryConnection>(io, initiator, responder, true);
+      auto b =
+          std::make_shared<MemoryConnection>(io, responder, initiator, false);
+      a->other_ = b;
+      b->other_ = a;
+      return {a, b};
+    }
+
+    MemoryConnection(std::shared_ptr<boost::asio::io_context> io,
+                     peer::PeerId local,
+                     peer::PeerId remote,
+                     bool initiator)
+        : io_{std::move(io)},
+          local_{std::move(local)},
+          remote_{std::move(remote)},
+          initiator_{initiator} {}
+
+    outcome::result<peer::PeerId> localPeer() const override {
+      return local_;
+    }
+
+    outcome::result<peer::PeerId> remotePeer() const override {
+      return remote_;
+    }
+
+    outcome::result<crypto::PublicKey> remotePublicKey() const override {
+      return crypto::PublicKey{};
+    }
+
+    bool isInitiator() const override {
+      return initiator_;
+    }
+
+    outcome::result<multi::Multiaddress> localMultiaddr() override {
+      return multi::Multiaddress::create("/ip4/127.0.0.1/tcp/1");
+    }
+
+    outcome::result<multi::Multiaddress> remoteMultiaddr() override {
+      return multi::Multiaddress::create("/ip4/127.0.0.1/tcp/2");
+    }
+
+    bool isClosed() const override {
+      return closed_;
+    }
+
+    outcome::result<void> close() override {
+      closed_ = true;
+      if (auto other = other_.lock()) {
+        other->closed_ = true;
+        other->completeRead(
+            make_error_code(boost::asio::error::connection_reset));
+      }
+      completeRead(make_error_code(boost::asio::error::connection_reset));
+      return outcome::success();
+    }
+
+    void read(BytesOut out, size_t bytes, ReadCallbackFunc cb) override {
+      ambigousSize(out, bytes);
+      readReturnSize(shared_from_this(), out, std::move(cb));
+    }
+
+    void readSome(BytesOut out, size_t bytes, ReadCallbackFunc cb) override {
+      ambigousSize(out, bytes);
+      if (closed_) {
+        return deferReadCallback(
+            make_error_code(boost::asio::error::connection_reset),
+            std::move(cb));
+      }
+      if (not buffer_.empty()) {
+        return deferReadCallback(buffer_.consume(out), std::move(cb));
+      }
+      pending_out_ = out;
+      pending_cb_ = std::move(cb);
+    }
+
+    void writeSome(BytesIn in, size_t bytes, WriteCallbackFunc cb) override {
+      ambigousSize(in, bytes);
+      auto other = other_.lock();
+      if (closed_ or not other) {
+        return deferWriteCallback(
+            make_error_code(boost::asio::error::connection_reset),
+            std::move(cb));
+      }
+      other->deliver(in);
+      boost::asio::post(*io_, [cb{std::move(cb)}, bytes] { cb(bytes); });
+    }
+
+    void deferReadCallback(outcome::result<size_t> res,
+                           ReadCallbackFunc cb) override {
+      boost::asio::post(*io_, [res, cb{std::move(cb)}] { cb(res); });
+    }
+
+    void deferWriteCallback(std::error_code ec, WriteCallbackFunc cb) override {
+      boost::asio::post(*io_, [ec, cb{std::move(cb)}] { cb(ec); });
+    }
+
+   private:
+    void deliver(BytesIn in) {
+      if (pending_cb_) {
+        auto n = buffer_.addAndConsume(in, pending_out_);
+        completeRead(n);
+        return;
+      }
+      buffer_.add(in);
+    }
+
+    void completeRead(outcome::result<size_t> res) {
+      if (not pending_cb_) {
+        return;
+      }
+      auto cb = std::move(pending_cb_);
+      pending_cb_ = nullptr;
+      deferReadCallback(res, std::move(cb));
+    }
+
+    std::shared_ptr<boost::asio::io_context> io_;
+    peer::PeerId local_;
+    peer::PeerId remote_;
+    bool initiator_;
+    bool closed_ = false;
+    std::weak_ptr<MemoryConnection> other_;
+    basic::ReadBuffer buffer_;
+    BytesOut pending_out_;
+    ReadCallbackFunc pending_cb_;
+  };
+
+  /// Runs io_context handlers until the flag is set
+  inline void runUntil(boost::asio::io_context &io, const bool &done) {
+    io.restart();
+    while (not done and io.run_one() != 0) {
+    }
+  }
+
+}  // namespace libp2p::benchmark
@@ -0,0 +1,125 @@
+/**
+ * Copyright Quadrivium LLC
+ * All Rights Reserved
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <map>
+#include <unordered_map>
+
+#include <libp2p/multi/multiaddress.hpp>
+#include <libp2p/multi/multibase_codec/codecs/base58.hpp>
+#include <libp2p/peer/peer_id.hpp>
+
+#include "testutil/libp2p/peer.hpp"
+
+namespace libp2p::benchmark {
+
+  constexpr std::string_view kAddress =
+      "/ip4/192.168.0.1/tcp/30333/p2p/"
+      "12D3KooWEyoppNCUx8Yx66oV9fJnriXwCcXwDDUA2kj6vnc6iDEp";
+
+  void BM_MultiaddressParse(::benchmark::State &state) {
+    for (auto _ : state) {
+      auto ma = multi::Multiaddress::create(kAddress);
+      ::benchmark::DoNotOptimize(ma);
+    }
+  }
+
+  void BM_MultiaddressFromBytes(::benchmark::State &state) {
+    auto bytes =
+        multi::Multiaddress::create(kAddress).value().getBytesAddress();
+    for (auto _ : state) {
+      auto ma = multi::Multiaddress::create(bytes);
+      ::benchmark::DoNotOptimize(ma);
+    }
+  }
+
+  void BM_PeerIdFromBase58(::benchmark::State &state) {
+    auto base58 = testutil::randomPeerId().toBase58();
+    for (auto _ : state) {
+      auto peer_id = peer::PeerId::fromBase58(base58);
+      ::benchmark::DoNotOptimize(peer_id);
+    }
+  }
+
+  void BM_PeerIdToBase58(::benchmark::State &state) {
+    auto peer_id = testutil::randomPeerId();
+    for (auto _ : state) {
+      auto base58 = peer_id.toBase58();
+      ::benchmark::DoNotOptimize(base58);
+    }
+  }
+
+  /// Codec itself, PeerId caches its string
+  void BM_Base58Encode(::benchmark::State &state) {
+    auto peer_id = testutil::randomPeerId();
+    auto bytes = peer_id.toVector();
+    for (auto _ : state) {
+      auto base58 = multi::detail::encodeBase58(bytes);
+      ::benchmark::DoNotOptimize(base58);
+    }
+  }
+
+  void BM_Base58Decode(::benchmark::State &state) {
+    auto base58 = testutil::randomPeerId().toBase58();
+    for (auto _ : state) {
+      auto bytes = multi::detail::decodeBase58(base58);
+      ::benchmark::DoNotOptimize(bytes);
+    }
+  }
+
+  void BM_PeerIdHash(::benchmark::State &state) {
+    auto peer_id = testutil::randomPeerId();
+    std::hash<peer::PeerId> hasher;
+    for (auto _ : state) {
+      auto hash = hasher(peer_id);
+      ::benchmark::DoNotOptimize(hash);
+    }
+  }
+
+  void BM_PeerIdCopy(::benchmark::State &state) {
+    auto peer_id = testutil::randomPeerId();
+    for (auto _ : state) {
+      auto copy = peer_id;
+      ::benchmark::DoNotOptimize(copy);
+    }
+  }
+
+  /// Lookups of peers, which are present in map, as in connection manager
+  template <typename Map>
+  void BM_PeerIdLookup(::benchmark::State &state) {
+    std::vector<peer::PeerId> peers;
+    Map map;
+    for (int64_t i = 0; i < state.range(0); ++i) {
+      peers.push_back(testutil::randomPeerId());
+      map.emplace(peers.back(), i);
+    }
+    size_t i = 0;
+    for (auto _ : state) {
+      auto it = map.find(peers[i]);
+      ::benchmark::DoNotOptimize(it);
+      i = (i + 1) % peers.size();
+    }
+  }
+
+  BENCHMARK(BM_MultiaddressParse)->Name("Multiaddress/Parse");
+  BENCHMARK(BM_MultiaddressFromBytes)->Name("Multiaddress/FromBytes");
+  BENCHMARK(BM_PeerIdFromBase58)->Name("PeerId/FromBase58");
+  BENCHMARK(BM_PeerIdToBase58)->Name("PeerId/ToBase58");
+  BENCHMARK(BM_Base58Encode)->Name("Base58/Encode");
+  BENCHMARK(BM_Base58Decode)->Name("Base58/Decode");
+  BENCHMARK(BM_PeerIdHash)->Name("PeerId/Hash");
+  BENCHMARK(BM_PeerIdCopy)->Name("PeerId/Copy");
+  BENCHMARK(BM_PeerIdLookup<std::unordered_map<peer::PeerId, int64_t>>)
+      ->Name("PeerId/UnorderedMapLookup")
+      ->Arg(64)
+      ->Arg(4096);
+  BENCHMARK(BM_PeerIdLookup<std::map<peer::PeerId, int64_t>>)
+      ->Name("PeerId/MapLookup")
+      ->Arg(64)
+      ->Arg(4096);
+
+}  // namespace libp2p::benchmark
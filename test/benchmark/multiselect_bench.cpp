@@ -0,0 +1,56 @@
+/**
+ * Copyright Quadrivium LLC
+ * All Rights Reserved
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <libp2p/protocol_muxer/multiselect.hpp>
+
+#include "benchmark/memory_connection.hpp"
+#include "testutil/libp2p/peer.hpp"
+
+namespace libp2p::benchmark {
+
+  using protocol_muxer::multiselect::Multiselect;
+
+  /// Full negotiation round trip between initiator and responder, the
+  /// responder supports state.range(0) protocols and the last one is chosen
+  void BM_MultiselectNegotiate(::benchmark::State &state) {
+    auto io = std::make_shared<boost::asio::io_context>();
+    auto [a, b] = MemoryConnection::makePair(
+        io, testutil::randomPeerId(), testutil::randomPeerId());
+    Multiselect initiator;
+    Multiselect responder;
+
+    std::vector<peer::ProtocolName> supported;
+    for (int64_t i = 0; i < state.range(0); ++i) {
+      supported.emplace_back(fmt::format("/bench/{}/1.0.0", i));
+    }
+    std::vector<peer::ProtocolName> wanted{supported.back()};
+
+    for (auto _ : state) {
+      size_t pending = 2;
+      bool failed = false;
+      bool done = false;
+      auto on_done = [&](outcome::result<peer::ProtocolName> res) {
+        failed = failed or res.has_error();
+        done = --pending == 0;
+      };
+      initiator.selectOneOf(wanted, a, true, true, on_done);
+      responder.selectOneOf(supported, b, false, true, on_done);
+      runUntil(*io, done);
+      if (failed or not done) {
+        state.SkipWithError("negotiation failed");
+        break;
+      }
+    }
+  }
+
+  BENCHMARK(BM_MultiselectNegotiate)
+      ->Name("Multiselect/Negotiate")
+      ->Arg(1)
+      ->Arg(16);
+
+}  // namespace libp2p::benchmark
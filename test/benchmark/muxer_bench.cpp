@@ -0,0 +1,164 @@
+/**
+ * Copyright Quadrivium LLC
+ * All Rights Reserved
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <libp2p/basic/read.hpp>
+#include <libp2p/basic/scheduler/asio_scheduler_backend.hpp>
+#include <libp2p/basic/scheduler/scheduler_impl.hpp>
+#include <libp2p/basic/write.hpp>
+#include <libp2p/muxer/mplex/mplexed_connection.hpp>
+#include <libp2p/muxer/yamux/yamuxed_connection.hpp>
+
+#include "benchmark/memory_connection.hpp"
+#include "testutil/libp2p/peer.hpp"
+
+namespace libp2p::benchmark {
+
+  /// Two muxed connections over a MemoryConnection pair with an open stream
+  struct MuxerPair {
+    template <typename MakeMuxed>
+    explicit MuxerPair(MakeMuxed make_muxed) {
+      auto scheduler = std::make_shared<basic::SchedulerImpl>(
+          std::make_shared<basic::AsioSchedulerBackend>(io),
+          basic::Scheduler::Config{});
+      auto [a, b] = MemoryConnection::makePair(
+          io, testutil::randomPeerId(), testutil::randomPeerId());
+      client = make_muxed(a, scheduler);
+      server = make_muxed(b, scheduler);
+
+      server->onStream(
+          [this](std::shared_ptr<connection::Stream> s) { inbound = s; });
+      client->onStream([](std::shared_ptr<connection::Stream>) {});
+      server->start();
+      client->start();
+
+      client->newStream([this](auto &&res) {
+        if (res) {
+          outbound = res.value();
+        }
+      });
+      io->restart();
+      while (not(inbound and outbound) and io->run_one() != 0) {
+      }
+      if (not(inbound and outbound)) {
+        throw std::runtime_error{"cannot open muxed stream"};
+      }
+    }
+
+    ~MuxerPair() {
+      client->stop();
+      server->stop();
+      io->restart();
+      io->poll();
+    }
+
+    std::shared_ptr<boost::asio::io_context> io =
+        std::make_shared<boost::asio::io_context>();
+    std::shared_ptr<connection::CapableConnection> client;
+    std::shared_ptr<connection::CapableConnection> server;
+    std::shared_ptr<connection::Stream> outbound;
+    std::shared_ptr<connection::Stream> inbound;
+  };
+
+  auto makeYamux(std::shared_ptr<connection::SecureConnection> conn,
+                 std::shared_ptr<basic::Scheduler> scheduler) {
+    return std::make_shared<connection::YamuxedConnection>(
+        std::move(conn),
+        std::move(scheduler),
+        [](const peer::PeerId &,
+           const std::shared_ptr<connection::CapableConnection> &) {});
+  }
+
+  auto makeMplex(std::shared_ptr<connection::SecureConnection> conn,
+                 std::shared_ptr<basic::Scheduler>) {
+    return std::make_shared<connection::MplexedConnection>(
+        std::move(conn), muxer::MuxedConnectionConfig{});
+  }
+
+  /// One-way transfer of state.range(0) bytes per iteration
+  template <auto MakeMuxed>
+  void BM_MuxerTransfer(::benchmark::State &state) {
+    MuxerPair pair{MakeMuxed};
+    Bytes out(state.range(0), 0x42);
+    Bytes in(out.size());
+
+    for (auto _ : state) {
+      size_t pending = 2;
+      bool failed = false;
+      bool done = false;
+      auto on_done = [&](outcome::result<void> res) {
+        failed = failed or res.has_error();
+        done = --pending == 0;
+      };
+      libp2p::write(pair.outbound, out, on_done);
+      libp2p::read(pair.inbound, in, on_done);
+      runUntil(*pair.io, done);
+      if (failed or not done) {
+        state.SkipWithError("transfer failed");
+        break;
+      }
+    }
+    state.SetBytesProcessed(state.iterations() * state.range(0));
+  }
+
+  /// Request-response of state.range(0) bytes, measures round trip latency
+  template <auto MakeMuxed>
+  void BM_MuxerRoundTrip(::benchmark::State &state) {
+    MuxerPair pair{MakeMuxed};
+    Bytes request(state.range(0), 0x42);
+    Bytes buffer(request.size());
+    Bytes response(request.size());
+
+    for (auto _ : state) {
+      bool done = false;
+      bool failed = false;
+      auto fail = [&] { failed = done = true; };
+      libp2p::write(pair.outbound, request, [&](outcome::result<void> res) {
+        if (not res) {
+          fail();
+        }
+      });
+      libp2p::read(pair.inbound, buffer, [&](outcome::result<void> res) {
+        if (not res) {
+          return fail();
+        }
+        libp2p::write(pair.inbound, buffer, [&](outcome::result<void> res) {
+          if (not res) {
+            fail();
+          }
+        });
+      });
+      libp2p::read(pair.outbound, response, [&](outcome::result<void> res) {
+        failed = res.has_error();
+        done = true;
+      });
+      runUntil(*pair.io, done);
+      if (failed or not done) {
+        state.SkipWithError("round trip failed");
+        break;
+      }
+    }
+  }
+
+  BENCHMARK(BM_MuxerTransfer<makeYamux>)
+      ->Name("Yamux/Transfer")
+      ->RangeMultiplier(16)
+      ->Range(1 << 10, 1 << 22);
+  BENCHMARK(BM_MuxerRoundTrip<makeYamux>)
+      ->Name("Yamux/RoundTrip")
+      ->Arg(64)
+      ->Arg(4096);
+  BENCHMARK(BM_MuxerTransfer<makeMplex>)
+      ->Name("Mplex/Transfer")
+      ->RangeMultiplier(16)
+      ->Range(1 << 10, 1 << 22);
+  BENCHMARK(BM_MuxerRoundTrip<makeMplex>)
+      ->Name("Mplex/RoundTrip")
+      ->Arg(64)
+      ->Arg(4096);
+
+}  // namespace libp2p::benchmark
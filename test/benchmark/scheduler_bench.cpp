@@ -0,0 +1,81 @@
+/**
+ * Copyright Quadrivium LLC
+ * All Rights Reserved
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <random>
+
+#include <libp2p/basic/scheduler/manual_scheduler_backend.hpp>
+#include <libp2p/basic/scheduler/scheduler_impl.hpp>
+#include <libp2p/basic/scheduler/timing_wheel_scheduler.hpp>
+
+namespace libp2p::benchmark {
+
+  using basic::ManualSchedulerBackend;
+  using basic::Scheduler;
+  using std::chrono::milliseconds;
+
+  /**
+   * Schedule and cancel of a timeout while state.range(0) other timeouts are
+   * pending, i.e. what each yamux stream or kademlia request does
+   */
+  template <typename SchedulerT>
+  void BM_SchedulerScheduleCancel(::benchmark::State &state) {
+    auto backend = std::make_shared<ManualSchedulerBackend>();
+    auto scheduler =
+        std::make_shared<SchedulerT>(backend, Scheduler::Config{});
+    std::mt19937 random{0};
+    std::vector<Scheduler::Handle> pending;
+    for (int64_t i = 0; i < state.range(0); ++i) {
+      pending.emplace_back(scheduler->scheduleWithHandle(
+          [] {}, milliseconds(10000 + random() % 60000)));
+    }
+    backend->shift(milliseconds::zero());
+
+    for (auto _ : state) {
+      auto handle = scheduler->scheduleWithHandle(
+          [] {}, milliseconds(10000 + random() % 60000));
+      backend->shift(milliseconds::zero());
+      handle.reset();
+      backend->shift(milliseconds::zero());
+    }
+  }
+
+  /// Firing of state.range(0) timers spread over one second
+  template <typename SchedulerT>
+  void BM_SchedulerFire(::benchmark::State &state) {
+    auto backend = std::make_shared<ManualSchedulerBackend>();
+    auto scheduler =
+        std::make_shared<SchedulerT>(backend, Scheduler::Config{});
+    std::mt19937 random{0};
+    size_t fired = 0;
+    for (auto _ : state) {
+      for (int64_t i = 0; i < state.range(0); ++i) {
+        scheduler->schedule([&] { ++fired; }, milliseconds(random() % 1000));
+      }
+      backend->run();
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(fired));
+  }
+
+  BENCHMARK(BM_SchedulerScheduleCancel<basic::SchedulerImpl>)
+      ->Name("Scheduler/Multimap/ScheduleCancel")
+      ->RangeMultiplier(8)
+      ->Range(1 << 6, 1 << 15);
+  BENCHMARK(BM_SchedulerScheduleCancel<basic::TimingWheelScheduler>)
+      ->Name("Scheduler/TimingWheel/ScheduleCancel")
+      ->RangeMultiplier(8)
+      ->Range(1 << 6, 1 << 15);
+  BENCHMARK(BM_SchedulerFire<basic::SchedulerImpl>)
+      ->Name("Scheduler/Multimap/Fire")
+      ->Arg(1 << 10)
+      ->Arg(1 << 14);
+  BENCHMARK(BM_SchedulerFire<basic::TimingWheelScheduler>)
+      ->Name("Scheduler/TimingWheel/Fire")
+      ->Arg(1 << 10)
+      ->Arg(1 << 14);
+
+}  // namespace libp2p::benchmark
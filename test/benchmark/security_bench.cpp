@@ -0,0 +1,103 @@
+/**
+ * Copyright Quadrivium LLC
+ * All Rights Reserved
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <optional>
+
+#include <benchmark/benchmark.h>
+
+#include <libp2p/crypto/aes_ctr/aes_ctr_impl.hpp>
+#include <libp2p/crypto/hmac_provider/hmac_provider_impl.hpp>
+#include <libp2p/security/noise/crypto/state.hpp>
+#include <libp2p/security/noise/handshake.hpp>
+
+namespace libp2p::benchmark {
+
+  using security::noise::CipherState;
+  using security::noise::defaultCipherSuite;
+  using security::noise::Key32;
+
+  /// Noise transport frame seal, the way NoiseConnection does it
+  void BM_NoiseEncrypt(::benchmark::State &state) {
+    CipherState cipher{defaultCipherSuite(), Key32{1, 2, 3}};
+    Bytes plaintext(state.range(0), 0x42);
+    Bytes frame(plaintext.size() + 16);
+
+    for (auto _ : state) {
+      auto res = cipher.encryptInto(plaintext, {}, frame);
+      ::benchmark::DoNotOptimize(res);
+    }
+    state.SetBytesProcessed(state.iterations() * state.range(0));
+  }
+
+  /// Noise transport frame open, the way NoiseConnection does it
+  void BM_NoiseDecrypt(::benchmark::State &state) {
+    constexpr size_t kFrames = 1024;
+    CipherState encryptor{defaultCipherSuite(), Key32{1, 2, 3}};
+    Bytes plaintext(state.range(0), 0x42);
+    std::vector<Bytes> frames;
+    for (size_t i = 0; i < kFrames; ++i) {
+      auto &frame = frames.emplace_back(plaintext.size() + 16);
+      std::ignore = encryptor.encryptInto(plaintext, {}, frame).value();
+    }
+
+    // nonces must match, so decrypt the same prepared sequence of frames
+    std::optional<CipherState> decryptor;
+    size_t i = kFrames;
+    for (auto _ : state) {
+      if (i == kFrames) {
+        state.PauseTiming();
+        decryptor.emplace(defaultCipherSuite(), Key32{1, 2, 3});
+        i = 0;
+        state.ResumeTiming();
+      }
+      auto res = decryptor->decryptInto(frames[i++], {}, plaintext);
+      if (not res) {
+        state.SkipWithError("decryption failed");
+        break;
+      }
+    }
+    state.SetBytesProcessed(state.iterations() * state.range(0));
+  }
+
+  /// Secio frame: AES-CTR encryption followed by HMAC of ciphertext
+  void BM_SecioSeal(::benchmark::State &state) {
+    crypto::common::Aes256Secret secret{};
+    crypto::aes::AesCtrImpl aes{secret, crypto::aes::AesCtrImpl::Mode::ENCRYPT};
+    crypto::hmac::HmacProviderImpl hmac;
+    Bytes mac_key(32, 0x11);
+    Bytes plaintext(state.range(0), 0x42);
+    Bytes frame(plaintext.size() + 32);
+    BytesOut ciphertext{frame.data(), plaintext.size()};
+
+    for (auto _ : state) {
+      auto res = aes.cryptInto(plaintext, ciphertext);
+      auto mac = hmac.calculateDigestInto(crypto::common::HashType::SHA256,
+                                          mac_key,
+                                          ciphertext,
+                                          BytesOut{frame}.subspan(
+                                              plaintext.size()));
+      if (not res or not mac) {
+        state.SkipWithError("seal failed");
+        break;
+      }
+    }
+    state.SetBytesProcessed(state.iterations() * state.range(0));
+  }
+
+  BENCHMARK(BM_NoiseEncrypt)
+      ->Name("Noise/Encrypt")
+      ->RangeMultiplier(8)
+      ->Range(64, 65519);
+  BENCHMARK(BM_NoiseDecrypt)
+      ->Name("Noise/Decrypt")
+      ->RangeMultiplier(8)
+      ->Range(64, 65519);
+  BENCHMARK(BM_SecioSeal)
+      ->Name("Secio/Seal")
+      ->RangeMultiplier(8)
+      ->Range(64, 1 << 16);
+
+}  // namespace libp2p::benchmark
@@ -9,6 +9,7 @@
 #include <libp2p/basic/scheduler/asio_scheduler_backend.hpp>
 #include <libp2p/basic/scheduler/manual_scheduler_backend.hpp>
 #include <libp2p/basic/scheduler/scheduler_impl.hpp>
+#include <libp2p/basic/scheduler/timing_wheel_scheduler.hpp>
 #include <libp2p/common/shared_fn.hpp>
 
 #include "testutil/prepare_loggers.hpp"
@@ -114,3 +115,61 @@ TEST(Scheduler, ManualScheduler) {
 
   backend->run();
 }
+
+TEST(Scheduler, TimingWheelManualScheduler) {
+  using namespace libp2p::basic;
+
+  auto backend = std::make_shared<ManualSchedulerBackend>();
+  auto scheduler =
+      std::make_shared<TimingWheelScheduler>(backend, Scheduler::Config{});
+
+  auto h = timers(scheduler);
+
+  backend->run();
+}
+
+/**
+ * @given timing wheel scheduler with timers spread over several wheel levels
+ * @when time runs until all timers fire
+ * @then every timer not cancelled fires once, not earlier than its time and
+ * in order of expiration
+ */
+TEST(Scheduler, TimingWheelOrder) {
+  using namespace libp2p::basic;
+  using std::chrono::milliseconds;
+
+  auto backend = std::make_shared<ManualSchedulerBackend>();
+  auto scheduler =
+      std::make_shared<TimingWheelScheduler>(backend, Scheduler::Config{});
+
+  auto start = backend->now();
+  std::vector<milliseconds> delays{
+      milliseconds(3),
+      milliseconds(64),
+      milliseconds(65),
+      milliseconds(1000),
+      milliseconds(4095),
+      milliseconds(4097),
+      milliseconds(100000),
+      milliseconds(3600000),
+      milliseconds(50),
+  };
+  std::vector<milliseconds> fired;
+  std::vector<Scheduler::Handle> handles;
+  for (auto delay : delays) {
+    handles.emplace_back(scheduler->scheduleWithHandle(
+        [&, delay] {
+          EXPECT_GE(backend->now() - start, delay);
+          fired.emplace_back(delay);
+        },
+        delay));
+  }
+  auto cancelled = scheduler->scheduleWithHandle(
+      [] { FAIL() << "cancelled timer called"; }, milliseconds(4096));
+  cancelled.reset();
+
+  backend->run();
+
+  std::sort(delays.begin(), delays.end());
+  EXPECT_EQ(fired, delays);
+}
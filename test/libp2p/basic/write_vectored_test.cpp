@@ -0,0 +1,72 @@
+/**
+ * Copyright Quadrivium LLC
+ * All Rights Reserved
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <gtest/gtest.h>
+
+#include <libp2p/basic/write.hpp>
+
+using libp2p::Bytes;
+using libp2p::BytesIn;
+
+namespace {
+  /// Writer which accepts at most max_chunk bytes per call
+  struct ChunkedWriter : libp2p::basic::Writer {
+    explicit ChunkedWriter(size_t max_chunk) : max_chunk{max_chunk} {}
+
+    void writeSome(BytesIn in, size_t bytes, WriteCallbackFunc cb) override {
+      auto n = std::min(bytes, max_chunk);
+      written.insert(written.end(), in.begin(), in.begin() + n);
+      ++calls;
+      cb(n);
+    }
+
+    void deferWriteCallback(std::error_code ec, WriteCallbackFunc cb) override {
+      cb(ec);
+    }
+
+    size_t max_chunk;
+    Bytes written;
+    size_t calls = 0;
+  };
+}  // namespace
+
+/**
+ * @given writer accepting small chunks and several buffers, some empty
+ * @when writing them with writeVectored
+ * @then all bytes are written in order and callback is called once
+ */
+TEST(WriteVectored, PartialWrites) {
+  Bytes a{1, 2, 3};
+  Bytes b;
+  Bytes c{4, 5, 6, 7, 8};
+  Bytes d{9};
+
+  for (size_t max_chunk : {1, 2, 3, 4, 100}) {
+    auto writer = std::make_shared<ChunkedWriter>(max_chunk);
+    size_t callbacks = 0;
+    libp2p::writeVectored(writer, {a, b, c, d}, [&](auto res) {
+      EXPECT_TRUE(res.has_value());
+      ++callbacks;
+    });
+    EXPECT_EQ(callbacks, 1);
+    EXPECT_EQ(writer->written, (Bytes{1, 2, 3, 4, 5, 6, 7, 8, 9}));
+  }
+}
+
+/**
+ * @given writer with default vectored write implementation
+ * @when writing several buffers
+ * @then they are gathered into one writeSome call
+ */
+TEST(WriteVectored, DefaultImplementationGathers) {
+  auto writer = std::make_shared<ChunkedWriter>(100);
+  Bytes a{1, 2};
+  Bytes b{3, 4};
+  libp2p::writeVectored(
+      writer, {a, b}, [](auto res) { EXPECT_TRUE(res.has_value()); });
+  EXPECT_EQ(writer->calls, 1);
+  EXPECT_EQ(writer->written, (Bytes{1, 2, 3, 4}));
+}
@@ -6,6 +6,7 @@
 
 #include <libp2p/common/metrics/instance_count.hpp>
 #include <libp2p/common/metrics/instance_list.hpp>
+#include <libp2p/common/metrics/registry.hpp>
 
 #include <gtest/gtest.h>
 #include <set>
@@ -71,3 +72,53 @@ TEST(MetricsInstance, AddSecond) {
   Foo foo2;
   expectFoo({&foo1, &foo2});
 }
+
+/**
+ * @given metrics registry
+ * @when same metric is requested twice
+ * @then same instance is returned and its updates are visible
+ */
+TEST(MetricsRegistry, SameMetric) {
+  auto &registry = libp2p::metrics::Registry::get();
+  auto &a = registry.counter("test_same_total", "help", {{"k", "v"}});
+  auto &b = registry.counter("test_same_total", "help", {{"k", "v"}});
+  auto &c = registry.counter("test_same_total", "help", {{"k", "w"}});
+  EXPECT_EQ(&a, &b);
+  EXPECT_NE(&a, &c);
+  a.inc(2);
+  b.inc();
+  EXPECT_EQ(b.value(), 3);
+  EXPECT_EQ(c.value(), 0);
+  EXPECT_THROW(registry.gauge("test_same_total", "help"), std::logic_error);
+}
+
+/**
+ * @given counter, gauge and histogram
+ * @when they are updated and registry snapshot is taken
+ * @then snapshot is in Prometheus text format
+ */
+TEST(MetricsRegistry, Prometheus) {
+  libp2p::metrics::Registry registry;
+  registry.counter("test_bytes_total", "Bytes", {{"dir", "in"}}).inc(42);
+  registry.gauge("test_streams", "Streams").set(-3);
+  auto &histogram =
+      registry.histogram("test_latency_seconds", "Latency", {0.1, 1});
+  histogram.observe(0.05);
+  histogram.observe(0.5);
+  histogram.observe(5);
+
+  EXPECT_EQ(registry.prometheus(),
+            "# HELP test_bytes_total Bytes\n"
+            "# TYPE test_bytes_total counter\n"
+            "test_bytes_total{dir=\"in\"} 42\n"
+            "# HELP test_latency_seconds Latency\n"
+            "# TYPE test_latency_seconds histogram\n"
+            "test_latency_seconds_bucket{le=\"0.1\"} 1\n"
+            "test_latency_seconds_bucket{le=\"1\"} 2\n"
+            "test_latency_seconds_bucket{le=\"+Inf\"} 3\n"
+            "test_latency_seconds_sum 5.55\n"
+            "test_latency_seconds_count 3\n"
+            "# HELP test_streams Streams\n"
+            "# TYPE test_streams gauge\n"
+            "test_streams -3\n");
+}
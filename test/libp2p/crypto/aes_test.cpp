@@ -14,6 +14,7 @@ using namespace libp2p::crypto;
 using namespace libp2p::common;
 using libp2p::Bytes;
 using libp2p::BytesIn;
+using libp2p::BytesOut;
 
 class AesTest : public testing::Test {
  protected:
@@ -147,3 +148,33 @@ TEST_F(AesTest, Stream) {
       out.end(), result_part_2.value().begin(), result_part_2.value().end());
   ASSERT_EQ(plain_text_256, out);
 }
+
+/**
+ * @given encrypted stream
+ * @when it is decrypted by crypt and by cryptInto in-place in two approaches
+ * @then results of both are equal and valid
+ */
+TEST_F(AesTest, CryptIntoMatchesCrypt) {
+  Aes256Secret secret{};
+
+  std::copy(key_256.begin(), key_256.end(), secret.key.begin());
+  std::copy(iv.begin(), iv.end(), secret.iv.begin());
+
+  auto &&result_ref = aes::AesCtrImpl(secret, aes::AesCtrImpl::Mode::DECRYPT)
+                          .crypt(cipher_text_256);
+  ASSERT_TRUE(result_ref);
+
+  aes::AesCtrImpl ctr(secret, aes::AesCtrImpl::Mode::DECRYPT);
+  Bytes buffer = cipher_text_256;
+  const auto kDelimiter = 20;
+  auto part_1 = BytesOut(buffer).subspan(0, kDelimiter);
+  auto part_2 = BytesOut(buffer).subspan(kDelimiter);
+  auto &&written_1 = ctr.cryptInto(part_1, part_1);
+  auto &&written_2 = ctr.cryptInto(part_2, part_2);
+  ASSERT_TRUE(written_1);
+  ASSERT_TRUE(written_2);
+  ASSERT_EQ(written_1.value(), part_1.size());
+  ASSERT_EQ(written_2.value(), part_2.size());
+  ASSERT_EQ(buffer, result_ref.value());
+  ASSERT_EQ(buffer, plain_text_256);
+}
@@ -158,3 +158,23 @@ TEST_F(ChaChaPolyTest, Decrypt) {
   auto result = EXPECT_OK(codec.decrypt(nonce, ciphertext, aad));
   ASSERT_EQ(result, plaintext);
 }
+
+/**
+ * @given CCP implementation
+ * @when the predefined input is encrypted and decrypted in place
+ * @then the results equal to expected and one instance serves both directions
+ */
+TEST_F(ChaChaPolyTest, InPlace) {
+  ChaCha20Poly1305Impl codec(key);
+
+  Bytes buffer = plaintext;
+  buffer.resize(plaintext.size() + 16);
+  auto sealed = EXPECT_OK(codec.encryptInto(
+      nonce, std::span(buffer).first(plaintext.size()), aad, buffer));
+  ASSERT_EQ(sealed, ciphertext.size());
+  ASSERT_EQ(buffer, ciphertext);
+
+  auto opened = EXPECT_OK(codec.decryptInto(nonce, buffer, aad, buffer));
+  buffer.resize(opened);
+  ASSERT_EQ(buffer, plaintext);
+}
@@ -107,3 +107,32 @@ TEST_F(HmacTest, HmacCtrTest) {
   ASSERT_TRUE(digest2);
   ASSERT_EQ(digest2.value(), sha256_dgst);
 }
+
+/**
+ * @given keys of all the supported hash types, default message
+ * @when digest is calculated into caller-supplied buffer
+ * @then obtained digest matches the one of calculateDigest
+ */
+TEST_F(HmacTest, CalculateDigestIntoMatchesCalculateDigest) {
+  for (auto &[hash_type, key] :
+       {std::pair{common::HashType::SHA1, sha1_key},
+        std::pair{common::HashType::SHA256, sha256_key},
+        std::pair{common::HashType::SHA512, sha512_key}}) {
+    auto &&digest = provider.calculateDigest(hash_type, key, message);
+    ASSERT_TRUE(digest);
+    Bytes out(digest.value().size());
+    ASSERT_TRUE(provider.calculateDigestInto(hash_type, key, message, out));
+    ASSERT_EQ(out, digest.value());
+  }
+}
+
+/**
+ * @given 32 bytes key, default message
+ * @when digest is calculated into buffer of wrong size
+ * @then error is returned
+ */
+TEST_F(HmacTest, CalculateDigestIntoWrongSize) {
+  Bytes out(20);
+  ASSERT_FALSE(provider.calculateDigestInto(
+      common::HashType::SHA256, sha256_key, message, out));
+}
@@ -362,3 +362,39 @@ TEST_F(KeyGoCompatibility, Secp256k1) {
   ASSERT_TRUE(verify_go_result.has_value());
   ASSERT_TRUE(verify_go_result.value());
 }
+
+class VerifyBatchTest : public KeyGenTest, public ::testing::Test {};
+
+/**
+ * @given signatures by keys of different types, some of them invalid
+ * @when they are verified in batch
+ * @then verdict of every item is the same as of single verification
+ */
+TEST_F(VerifyBatchTest, MixedKeyTypes) {
+  std::vector<libp2p::crypto::KeyPair> keys;
+  for (auto type :
+       {Key::Type::Ed25519, Key::Type::Secp256k1, Key::Type::ECDSA}) {
+    keys.push_back(EXPECT_OK(crypto_provider_->generateKeys(type)));
+  }
+
+  constexpr size_t kItems = 48;
+  std::vector<Bytes> messages;
+  std::vector<Bytes> signatures;
+  std::vector<CryptoProvider::VerifyItem> items;
+  std::vector<bool> expected;
+  for (size_t i = 0; i < kItems; ++i) {
+    const auto &key = keys[i % keys.size()];
+    messages.push_back(Bytes{static_cast<uint8_t>(i)});
+    signatures.push_back(
+        EXPECT_OK(crypto_provider_->sign(messages.back(), key.privateKey)));
+    // every 5th is signed by other key
+    expected.push_back(i % 5 != 0);
+  }
+  for (size_t i = 0; i < kItems; ++i) {
+    const auto &key = keys[(i + (expected[i] ? 0 : 1)) % keys.size()];
+    items.push_back({messages[i], signatures[i], key.publicKey});
+  }
+
+  EXPECT_EQ(crypto_provider_->verifyBatch(items), expected);
+  EXPECT_TRUE(crypto_provider_->verifyBatch({}).empty());
+}
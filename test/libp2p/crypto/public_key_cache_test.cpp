@@ -0,0 +1,92 @@
+/**
+ * Copyright Quadrivium LLC
+ * All Rights Reserved
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <libp2p/crypto/public_key_cache.hpp>
+
+#include <gtest/gtest.h>
+
+#include <libp2p/crypto/ecdsa_provider/ecdsa_provider_impl.hpp>
+#include <libp2p/crypto/error.hpp>
+
+using libp2p::Bytes;
+using libp2p::crypto::Key;
+using libp2p::crypto::PublicKeyCache;
+using libp2p::crypto::ecdsa::EcdsaProviderImpl;
+
+struct PublicKeyCacheTest : public ::testing::Test {
+  /// Returns cached value, counting parses
+  outcome::result<std::shared_ptr<int>> get(Key::Type type, const Bytes &key) {
+    return cache.get<int>(type, key, [&]() {
+      ++parsed;
+      return outcome::result<std::shared_ptr<int>>{
+          std::make_shared<int>(key.at(0))};
+    });
+  }
+
+  PublicKeyCache cache{{.capacity = 2}};
+  size_t parsed = 0;
+};
+
+/**
+ * @given cache with capacity 2
+ * @when keys are got repeatedly
+ * @then they are parsed once, least recently used key is evicted
+ */
+TEST_F(PublicKeyCacheTest, Lru) {
+  Bytes a{1}, b{2}, c{3};
+  EXPECT_EQ(*get(Key::Type::RSA, a).value(), 1);
+  EXPECT_EQ(*get(Key::Type::RSA, a).value(), 1);
+  EXPECT_EQ(parsed, 1);
+
+  // same bytes of other key type is other key
+  EXPECT_EQ(*get(Key::Type::ECDSA, a).value(), 1);
+  EXPECT_EQ(parsed, 2);
+
+  EXPECT_TRUE(get(Key::Type::RSA, a));
+  EXPECT_TRUE(get(Key::Type::RSA, b));
+  EXPECT_EQ(parsed, 3);
+  EXPECT_EQ(cache.size(), 2);
+
+  // ECDSA key was least recently used
+  EXPECT_TRUE(get(Key::Type::RSA, a));
+  EXPECT_TRUE(get(Key::Type::ECDSA, a));
+  EXPECT_EQ(parsed, 4);
+  EXPECT_TRUE(get(Key::Type::RSA, c));
+  EXPECT_EQ(parsed, 5);
+}
+
+/**
+ * @given cache
+ * @when key can't be parsed
+ * @then error is returned and not cached
+ */
+TEST_F(PublicKeyCacheTest, ParseError) {
+  auto failed = [] {
+    return outcome::result<std::shared_ptr<int>>{
+        libp2p::crypto::KeyValidatorError::INVALID_PUBLIC_KEY};
+  };
+  EXPECT_FALSE(cache.get<int>(Key::Type::RSA, Bytes{1}, failed));
+  EXPECT_EQ(cache.size(), 0);
+}
+
+/**
+ * @given ECDSA provider with shared key cache
+ * @when signatures are verified with the same key
+ * @then key is decoded once and verification results don't change
+ */
+TEST_F(PublicKeyCacheTest, CachedProvider) {
+  auto key_cache = std::make_shared<PublicKeyCache>();
+  EcdsaProviderImpl provider{key_cache};
+  auto keys = provider.generate().value();
+  Bytes message{1, 2, 3};
+  auto signature = provider.sign(message, keys.private_key).value();
+
+  for (int i = 0; i < 3; ++i) {
+    EXPECT_TRUE(provider.verify(message, signature, keys.public_key).value());
+    EXPECT_FALSE(provider.verify(Bytes{4}, signature, keys.public_key).value());
+  }
+  EXPECT_EQ(key_cache->size(), 1);
+}
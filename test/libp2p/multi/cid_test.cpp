@@ -242,12 +242,13 @@ TEST(CidEncodeTest, Encode) {
                                   ZERO_MULTIHASH)),
             ContentIdentifierCodec::EncodeError::INVALID_CONTENT_TYPE);
 
+  auto zero = ZERO_MULTIHASH.toBuffer();
   EXPECT_EQ(ContentIdentifierCodec::encode(
                 ContentIdentifier(ContentIdentifier::Version::V0,
                                   MulticodecType::Code::DAG_PB,
                                   ZERO_MULTIHASH))
                 .value(),
-            ZERO_MULTIHASH.toBuffer());
+            std::vector<uint8_t>(zero.begin(), zero.end()));
 }
 
 class CidDecodeTest : public testing::TestWithParam<
@@ -276,7 +277,8 @@ TEST_P(CidEncodeDecodeTest, DecodedMatchesOriginal) {
 }
 
 const std::vector<std::pair<std::vector<uint8_t>, ContentIdentifier>>
-    decodeSuite{{EXAMPLE_MULTIHASH.toBuffer(),
+    decodeSuite{{std::vector<uint8_t>(EXAMPLE_MULTIHASH.toBuffer().begin(),
+                                      EXAMPLE_MULTIHASH.toBuffer().end()),
                  ContentIdentifier(ContentIdentifier::Version::V0,
                                    MulticodecType::Code::DAG_PB,
                                    EXAMPLE_MULTIHASH)}};
@@ -390,6 +390,25 @@ TEST_F(Base58Encoding, SkipsWhitespacesFailure) {
   ASSERT_FALSE(error.has_value());
 }
 
+/**
+ * @given bytes of every length up to several limbs, with and without leading
+ * zeroes
+ * @when encoding bytes @and decoding string
+ * @then original bytes are decoded
+ */
+TEST_F(Base58Encoding, RoundTrip) {
+  for (size_t size = 1; size <= 70; ++size) {
+    for (size_t zeroes : {0, 1, 5}) {
+      Bytes bytes(size);
+      for (size_t i = 0; i < size; ++i) {
+        bytes[i] = i < zeroes ? 0 : static_cast<uint8_t>(i * 37 + size);
+      }
+      auto encoded = multibase->encode(bytes, encoding);
+      ASSERT_EQ(decodeCorrect(encoded), bytes) << size << " " << zeroes;
+    }
+  }
+}
+
 class Base64Encoding : public MultibaseCodecTest {
  public:
   MultibaseCodec::Encoding encoding = MultibaseCodec::Encoding::BASE64;
@@ -77,7 +77,8 @@ TEST(Multihash, FromToBuffer) {
 
   ASSERT_NO_THROW({
     auto m = Multihash::createFromBytes(hash).value();
-    ASSERT_EQ(m.toBuffer(), hash);
+    auto buffer = m.toBuffer();
+    ASSERT_EQ(Bytes(buffer.begin(), buffer.end()), hash);
   });
 
   Bytes v{2, 3, 1, 3};
@@ -116,3 +117,25 @@ TEST(Multihash, CompareDifferentHashes) {
   ASSERT_FALSE(hash1 < hash1);
   ASSERT_FALSE(hash2 < hash2);
 }
+
+/**
+ * @given hashes shorter and longer than inline capacity
+ * @when multihashes are copied and moved
+ * @then copies are equal to originals and have same std hash
+ */
+TEST(Multihash, InlineAndLongHashes) {
+  for (auto size : {32, 64, 127}) {
+    Bytes hash(size, 42);
+    auto m = Multihash::create(HashType::sha512, hash).value();
+    EXPECT_EQ(m.toBuffer().size() <= Multihash::kInlineCapacity, size == 32);
+
+    auto copy = m;
+    EXPECT_EQ(copy, m);
+    EXPECT_EQ(copy.stdHash(), m.stdHash());
+    EXPECT_TRUE(copy.getHash() == BytesIn(hash));
+
+    auto moved = std::move(copy);
+    EXPECT_EQ(moved, m);
+    EXPECT_EQ(moved.toHex(), m.toHex());
+  }
+}
@@ -121,7 +121,8 @@ namespace libp2p::regression {
       host_ = injector.template create<std::shared_ptr<Host>>();
 
       if (!jumbo_msg) {
-        write_buf_ = std::make_shared<Bytes>(getId().toVector());
+        auto id = getId().toVector();
+        write_buf_ = std::make_shared<Bytes>(id.begin(), id.end());
       } else {
         static const size_t kJumboSize = 40 * 1024 * 1024;
         write_buf_ = std::make_shared<Bytes>(kJumboSize, 0x99);
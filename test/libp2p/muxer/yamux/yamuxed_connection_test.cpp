@@ -0,0 +1,218 @@
+/**
+ * Copyright Quadrivium LLC
+ * All Rights Reserved
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <libp2p/muxer/yamux/yamuxed_connection.hpp>
+
+#include <deque>
+
+#include <gtest/gtest.h>
+#include <libp2p/basic/scheduler/manual_scheduler_backend.hpp>
+#include <libp2p/basic/scheduler/scheduler_impl.hpp>
+#include "mock/libp2p/connection/secure_connection_mock.hpp"
+#include "testutil/libp2p/peer.hpp"
+#include "testutil/prepare_loggers.hpp"
+
+using libp2p::Bytes;
+using libp2p::BytesIn;
+using libp2p::basic::ManualSchedulerBackend;
+using libp2p::basic::Scheduler;
+using libp2p::basic::SchedulerImpl;
+using libp2p::connection::SecureConnectionMock;
+using libp2p::connection::Stream;
+using libp2p::connection::YamuxedConnection;
+using libp2p::connection::YamuxFrame;
+using testing::_;
+using testing::Return;
+
+class YamuxedConnectionTest : public ::testing::Test {
+ public:
+  void SetUp() override {
+    testutil::prepareLoggers();
+
+    ON_CALL(*raw, remotePeer()).WillByDefault(Return(testutil::randomPeerId()));
+    ON_CALL(*raw, isInitiator_hack()).WillByDefault(Return(true));
+    ON_CALL(*raw, isClosed()).WillByDefault(Return(false));
+    ON_CALL(*raw, readSome(_, _, _)).WillByDefault(Return());
+    ON_CALL(*raw, writeSome(_, _, _))
+        .WillByDefault([this](BytesIn in, size_t, auto cb) {
+          writes.emplace_back(in, std::move(cb));
+        });
+    ON_CALL(*raw, deferWriteCallback(_, _))
+        .WillByDefault([this](std::error_code ec, auto cb) {
+          deferred.emplace_back([ec, cb{std::move(cb)}] { cb(ec); });
+        });
+
+    // no pings to not interfere with writes
+    libp2p::muxer::MuxedConnectionConfig config;
+    config.ping_interval = std::chrono::milliseconds::zero();
+    connection = std::make_shared<YamuxedConnection>(
+        raw, scheduler, [](auto &&, auto &&) {}, config);
+    connection->start();
+
+    stream = connection->newStream().value();
+    // new stream frame is being written
+    ASSERT_EQ(writes.size(), 1);
+  }
+
+  /// Completes the oldest pending write to the raw connection
+  void completeWrite(bool success = true) {
+    ASSERT_FALSE(writes.empty());
+    auto [in, cb] = std::move(writes.front());
+    writes.pop_front();
+    if (success) {
+      cb(in.size());
+    } else {
+      cb(make_error_code(boost::asio::error::broken_pipe));
+    }
+  }
+
+  /// Calls deferred callbacks
+  void runDeferred() {
+    auto calls = std::move(deferred);
+    deferred.clear();
+    for (auto &call : calls) {
+      call();
+    }
+  }
+
+  /// Writes payload to stream and makes connection write it
+  void writePayload() {
+    stream->writeSome(
+        payload, payload.size(), [this](outcome::result<size_t> res) {
+          write_result = res;
+        });
+    // new stream frame is written, then data frame is being written
+    completeWrite();
+    ASSERT_EQ(writes.size(), 1);
+    ASSERT_EQ(writes.front().first.size(),
+              YamuxFrame::kHeaderLength + payload.size());
+  }
+
+  std::shared_ptr<ManualSchedulerBackend> scheduler_backend =
+      std::make_shared<ManualSchedulerBackend>();
+  std::shared_ptr<Scheduler> scheduler =
+      std::make_shared<SchedulerImpl>(scheduler_backend, Scheduler::Config{});
+  std::shared_ptr<SecureConnectionMock> raw =
+      std::make_shared<testing::NiceMock<SecureConnectionMock>>();
+  std::shared_ptr<YamuxedConnection> connection;
+  std::shared_ptr<Stream> stream;
+
+  std::deque<std::pair<BytesIn, libp2p::basic::Writer::WriteCallbackFunc>>
+      writes;
+  std::vector<std::function<void()>> deferred;
+  Bytes payload = Bytes(1000, 0xAB);
+  boost::optional<outcome::result<size_t>> write_result;
+};
+
+/**
+ * @given stream data being written to raw connection
+ * @when yamuxed connection is closed
+ * @then stream write callback is called only after raw connection stops
+ * referring to the data
+ */
+TEST_F(YamuxedConnectionTest, CloseDuringPendingWrite) {
+  writePayload();
+
+  ASSERT_TRUE(connection->close());
+  ASSERT_TRUE(stream->isClosed());
+  ASSERT_FALSE(write_result);
+
+  completeWrite();
+  ASSERT_TRUE(write_result);
+  ASSERT_TRUE(write_result->has_error());
+}
+
+/**
+ * @given stream data being written to raw connection
+ * @when the write fails
+ * @then connection is closed and stream write callback is called with error
+ */
+TEST_F(YamuxedConnectionTest, WriteErrorDuringPendingWrite) {
+  writePayload();
+
+  completeWrite(false);
+  ASSERT_TRUE(connection->isClosed());
+  ASSERT_TRUE(write_result);
+  ASSERT_TRUE(write_result->has_error());
+}
+
+/**
+ * @given stream data queued behind another write
+ * @when yamuxed connection is closed
+ * @then stream write callback is called with error, as connection dropped
+ * the data
+ */
+TEST_F(YamuxedConnectionTest, CloseWithQueuedWrite) {
+  stream->writeSome(
+      payload, payload.size(), [this](outcome::result<size_t> res) {
+        write_result = res;
+      });
+  ASSERT_FALSE(write_result);
+
+  ASSERT_TRUE(connection->close());
+  ASSERT_TRUE(write_result);
+  ASSERT_TRUE(write_result->has_error());
+}
+
+/**
+ * @given stream data being written to raw connection and stream abandoned by
+ * its owner
+ * @when cleanup timer fires
+ * @then the stream is not kept alive by frames only, so it is reset
+ */
+TEST_F(YamuxedConnectionTest, AbandonedStreamWithQueuedFrames) {
+  writePayload();
+  stream.reset();
+
+  // cleanup interval
+  scheduler_backend->shift(std::chrono::seconds(150));
+  completeWrite();
+  // reset frame follows
+  ASSERT_EQ(writes.size(), 1);
+}
+
+/**
+ * @given stream data being written to raw connection
+ * @when stream is reset
+ * @then stream write callback is called with error only after raw connection
+ * stops referring to the data
+ */
+TEST_F(YamuxedConnectionTest, ResetDuringPendingWrite) {
+  writePayload();
+
+  stream->reset();
+  runDeferred();
+  ASSERT_FALSE(write_result);
+
+  completeWrite();
+  runDeferred();
+  ASSERT_TRUE(write_result);
+  ASSERT_EQ(write_result->error(), Stream::Error::STREAM_RESET_BY_HOST);
+  // reset frame follows
+  ASSERT_EQ(writes.size(), 1);
+  ASSERT_EQ(writes.front().first.size(), YamuxFrame::kHeaderLength);
+}
+
+/**
+ * @given stream data queued behind another write
+ * @when stream is reset
+ * @then the data is not written, stream write callback is called with error
+ */
+TEST_F(YamuxedConnectionTest, ResetWithQueuedWrite) {
+  stream->writeSome(
+      payload, payload.size(), [this](outcome::result<size_t> res) {
+        write_result = res;
+      });
+  stream->reset();
+
+  // new stream frame is written, data frame is dropped, reset frame follows
+  completeWrite();
+  ASSERT_EQ(writes.size(), 1);
+  ASSERT_EQ(writes.front().first.size(), YamuxFrame::kHeaderLength);
+  runDeferred();
+  ASSERT_TRUE(write_result);
+  ASSERT_TRUE(write_result->has_error());
+}
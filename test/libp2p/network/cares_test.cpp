@@ -0,0 +1,78 @@
+/**
+ * Copyright Quadrivium LLC
+ * All Rights Reserved
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <gtest/gtest.h>
+#include <libp2p/network/cares/cares.hpp>
+#include "testutil/prepare_loggers.hpp"
+
+using libp2p::network::c_ares::Ares;
+
+struct AresTest : public ::testing::Test {
+  void SetUp() override {
+    testutil::prepareLoggers();
+  }
+
+  /// Resolves uri the given number of times at once, returns the results
+  std::vector<outcome::result<std::vector<std::string>>> resolve(
+      const std::string &uri, size_t count) {
+    std::vector<outcome::result<std::vector<std::string>>> results;
+    for (size_t i = 0; i < count; ++i) {
+      Ares::resolveTxt(
+          uri, io_context, [&](auto result) { results.emplace_back(result); });
+    }
+    // nothing is called back synchronously
+    EXPECT_TRUE(results.empty());
+    io_context->restart();
+    io_context->run();
+    return results;
+  }
+
+  Ares ares;
+  std::shared_ptr<boost::asio::io_context> io_context =
+      std::make_shared<boost::asio::io_context>();
+  /// Label longer than 63 characters is rejected by c-ares without network
+  std::string bad_name = std::string(64, 'a') + ".example.com";
+};
+
+/**
+ * @given c-ares channel driven by io_context
+ * @when the same query is requested several times at once
+ * @then every callback gets the query error via io_context
+ */
+TEST_F(AresTest, SharedQueryError) {
+  auto results = resolve(bad_name, 3);
+  ASSERT_EQ(results.size(), 3);
+  for (auto &result : results) {
+    ASSERT_TRUE(result.has_error());
+    ASSERT_EQ(result.error(), make_error_code(Ares::Error::E_BAD_NAME));
+  }
+}
+
+/**
+ * @given c-ares channel which has completed all its queries
+ * @when new queries are requested with the same io_context
+ * @then they are processed by a new channel
+ */
+TEST_F(AresTest, ChannelReleasedWhenIdle) {
+  ASSERT_EQ(resolve(bad_name, 1).size(), 1);
+  auto results = resolve(bad_name, 2);
+  ASSERT_EQ(results.size(), 2);
+  for (auto &result : results) {
+    ASSERT_EQ(result.error(), make_error_code(Ares::Error::E_BAD_NAME));
+  }
+}
+
+/**
+ * @given io_context which queries were processed by c-ares channel
+ * @when io_context is released by its owner
+ * @then it is not kept alive by Ares
+ */
+TEST_F(AresTest, IoContextNotRetained) {
+  ASSERT_EQ(resolve(bad_name, 1).size(), 1);
+  std::weak_ptr<boost::asio::io_context> weak_io_context = io_context;
+  io_context.reset();
+  ASSERT_TRUE(weak_io_context.expired());
+}
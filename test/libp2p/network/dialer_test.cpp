@@ -40,7 +40,7 @@ struct DialerTest : public ::testing::Test {
   void SetUp() override {
     testutil::prepareLoggers();
     dialer = std::make_shared<DialerImpl>(
-        proto_muxer, tmgr, cmgr, listener, scheduler);
+        proto_muxer, tmgr, cmgr, listener, scheduler, config);
   }
 
   std::shared_ptr<StreamMock> stream = std::make_shared<StreamMock>();
@@ -67,6 +67,8 @@ struct DialerTest : public ::testing::Test {
   std::shared_ptr<Scheduler> scheduler =
       std::make_shared<SchedulerImpl>(scheduler_backend, Scheduler::Config{});
 
+  DialerConfig config;
+
   std::shared_ptr<Dialer> dialer;
 
   multi::Multiaddress ma1 = "/ip4/127.0.0.1/tcp/1"_multiaddr;
@@ -120,6 +122,45 @@ TEST_F(DialerTest, DialAllTheAddresses) {
   ASSERT_TRUE(executed);
 }
 
+/**
+ * @given a peer with two multiaddresses
+ * @when a dial to the first address hangs
+ * @then the second address is dialed after stagger delay without waiting for
+ * the first one, and connection from the late first attempt is closed
+ */
+TEST_F(DialerTest, DialStaggered) {
+  EXPECT_CALL(*cmgr, getBestConnectionForPeer(pinfo.id))
+      .WillOnce(Return(nullptr));
+  EXPECT_CALL(*listener, onConnection(_)).Times(1);
+  EXPECT_CALL(*tmgr, findBest(ma1)).WillOnce(Return(transport));
+  EXPECT_CALL(*tmgr, findBest(ma2)).WillOnce(Return(transport));
+
+  TransportAdaptor::HandlerFunc first_handler;
+  EXPECT_CALL(*transport, dial(pid, ma1, _, _))
+      .WillOnce([&](auto &&, auto &&, auto handler, auto &&) {
+        first_handler = std::move(handler);
+      });
+
+  EXPECT_CALL(*transport, dial(pid, ma2, _, _))
+      .WillOnce(Arg2CallbackWithArg(outcome::success(connection)));
+
+  bool executed = false;
+  dialer->dial(pinfo_two_addrs, [&](auto &&rconn) {
+    auto conn = EXPECT_OK(rconn);
+    (void)conn;
+    executed = true;
+  });
+  scheduler_backend->run();
+  ASSERT_TRUE(executed);
+  ASSERT_TRUE(first_handler);
+  ASSERT_GE(scheduler_backend->now(), config.stagger_delay);
+
+  auto late = std::make_shared<CapableConnectionMock>();
+  EXPECT_CALL(*late, isClosed()).WillOnce(Return(false));
+  EXPECT_CALL(*late, close()).WillOnce(Return(outcome::success()));
+  first_handler(late);
+}
+
 /**
  * @given no known connections to peer, have 1 transport, 1 address supplied
  * @when dial
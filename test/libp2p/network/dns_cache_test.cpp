@@ -0,0 +1,83 @@
+/**
+ * Copyright Quadrivium LLC
+ * All Rights Reserved
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <gtest/gtest.h>
+#include <libp2p/network/cares/dns_cache.hpp>
+
+using libp2p::network::c_ares::DnsCache;
+using std::chrono::seconds;
+
+struct DnsCacheTest : public ::testing::Test {
+  DnsCache::Config config{
+      .capacity = 2,
+      .min_ttl = seconds{5},
+      .max_ttl = seconds{100},
+      .negative_ttl = seconds{10},
+  };
+  DnsCache cache{config};
+  DnsCache::Clock::time_point now{};
+  std::vector<std::string> values{"dnsaddr=/ip4/1.2.3.4/tcp/1"};
+};
+
+/**
+ * @given cached answer
+ * @when its TTL passes
+ * @then it is not returned anymore
+ */
+TEST_F(DnsCacheTest, Ttl) {
+  cache.put("a", values, seconds{30}, now);
+  auto cached = cache.get("a", now + seconds{29});
+  ASSERT_TRUE(cached);
+  ASSERT_TRUE(cached->has_value());
+  ASSERT_EQ(cached->value(), values);
+  ASSERT_FALSE(cache.get("a", now + seconds{30}));
+  ASSERT_EQ(cache.size(), 0);
+}
+
+/**
+ * @given answers with TTL out of configured bounds
+ * @when cached
+ * @then TTL is clamped
+ */
+TEST_F(DnsCacheTest, TtlClamped) {
+  cache.put("a", values, seconds{0}, now);
+  cache.put("b", values, seconds{1000}, now);
+  ASSERT_TRUE(cache.get("a", now + seconds{4}));
+  ASSERT_FALSE(cache.get("a", now + seconds{5}));
+  ASSERT_TRUE(cache.get("b", now + seconds{99}));
+  ASSERT_FALSE(cache.get("b", now + seconds{100}));
+}
+
+/**
+ * @given negative answer
+ * @when cached
+ * @then the error is returned until negative TTL passes
+ */
+TEST_F(DnsCacheTest, Negative) {
+  auto error = make_error_code(std::errc::no_such_device_or_address);
+  cache.putNegative("a", error, now);
+  auto cached = cache.get("a", now + seconds{9});
+  ASSERT_TRUE(cached);
+  ASSERT_TRUE(cached->has_error());
+  ASSERT_EQ(cached->error(), error);
+  ASSERT_FALSE(cache.get("a", now + seconds{10}));
+}
+
+/**
+ * @given full cache
+ * @when new answer is cached
+ * @then least recently used one is evicted
+ */
+TEST_F(DnsCacheTest, Lru) {
+  cache.put("a", values, seconds{30}, now);
+  cache.put("b", values, seconds{30}, now);
+  ASSERT_TRUE(cache.get("a", now));
+  cache.put("c", values, seconds{30}, now);
+  ASSERT_EQ(cache.size(), 2);
+  ASSERT_TRUE(cache.get("a", now));
+  ASSERT_FALSE(cache.get("b", now));
+  ASSERT_TRUE(cache.get("c", now));
+}
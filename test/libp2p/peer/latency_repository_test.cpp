@@ -0,0 +1,139 @@
+/**
+ * Copyright Quadrivium LLC
+ * All Rights Reserved
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <libp2p/peer/latency_repository.hpp>
+
+#include <numeric>
+#include <random>
+
+#include <gtest/gtest.h>
+
+#include "testutil/libp2p/peer.hpp"
+
+using libp2p::peer::LatencyRepository;
+using libp2p::peer::PeerId;
+using std::chrono::microseconds;
+using std::chrono::milliseconds;
+
+namespace {
+
+  /// Simulated network: every peer has link latency with jitter injected
+  struct Network {
+    struct Link {
+      PeerId peer_id;
+      milliseconds latency;
+    };
+
+    explicit Network(std::vector<milliseconds> latencies) {
+      for (auto latency : latencies) {
+        links.push_back({testutil::randomPeerId(), latency});
+      }
+    }
+
+    /// Measures n round trips of every link
+    void measure(LatencyRepository &repo, size_t n) {
+      std::uniform_int_distribution<int> jitter(-2000, 2000);
+      for (size_t i = 0; i < n; ++i) {
+        for (const auto &link : links) {
+          repo.addRoundTrip(link.peer_id,
+                            microseconds(link.latency) * 2
+                                + microseconds(jitter(random)));
+        }
+      }
+    }
+
+    std::vector<Link> links;
+    std::mt19937 random{42};
+  };
+
+}  // namespace
+
+/**
+ * @given peer round trips with jitter
+ * @when they are added to repository
+ * @then estimate converges to link round trip, unknown peers get default
+ */
+TEST(LatencyRepository, Estimate) {
+  LatencyRepository repo;
+  Network network({milliseconds(10), milliseconds(100)});
+  network.measure(repo, 50);
+
+  for (const auto &link : network.links) {
+    auto estimate = repo.getEstimate(link.peer_id);
+    ASSERT_TRUE(estimate);
+    EXPECT_EQ(estimate->samples, 50);
+    EXPECT_NEAR(estimate->rtt.count(),
+                microseconds(link.latency * 2).count(),
+                2000);
+    EXPECT_GE(repo.score(link.peer_id), estimate->rtt);
+  }
+
+  auto unknown = testutil::randomPeerId();
+  EXPECT_FALSE(repo.getEstimate(unknown));
+  EXPECT_EQ(repo.score(unknown), LatencyRepository::Config{}.default_rtt);
+}
+
+/**
+ * @given network of fast and slow peers
+ * @when peers are selected many times
+ * @then fast peers are selected much more often, slow ones still sometimes,
+ * and the opposite if high latency is preferred
+ */
+TEST(LatencyRepository, Selection) {
+  LatencyRepository repo;
+  Network network({milliseconds(5),
+                   milliseconds(5),
+                   milliseconds(10),
+                   milliseconds(200),
+                   milliseconds(300),
+                   milliseconds(500)});
+  network.measure(repo, 20);
+
+  auto count = [&](LatencyRepository::Prefer prefer) {
+    std::vector<size_t> counts(network.links.size());
+    std::vector<size_t> indices(network.links.size());
+    std::iota(indices.begin(), indices.end(), 0);
+    for (int i = 0; i < 10000; ++i) {
+      auto selected = repo.select(
+          indices,
+          3,
+          [&](size_t j) -> const PeerId & {
+            return network.links[j].peer_id;
+          },
+          prefer);
+      EXPECT_EQ(selected.size(), 3);
+      for (auto j : selected) {
+        ++counts[j];
+      }
+    }
+    return counts;
+  };
+
+  auto fast = count(LatencyRepository::Prefer::LOW_LATENCY);
+  EXPECT_GT(fast[0], fast[3] * 5);
+  EXPECT_GT(fast[2], fast[5] * 5);
+  EXPECT_GT(fast[5], 0);
+
+  auto slow = count(LatencyRepository::Prefer::HIGH_LATENCY);
+  EXPECT_GT(slow[5], slow[0] * 5);
+  EXPECT_GT(slow[0], 0);
+}
+
+/**
+ * @given repository of limited capacity
+ * @when more peers are measured
+ * @then least recently updated peers are evicted
+ */
+TEST(LatencyRepository, Eviction) {
+  LatencyRepository repo({.capacity = 16});
+  auto first = testutil::randomPeerId();
+  repo.addRoundTrip(first, milliseconds(1));
+  for (int i = 0; i < 100; ++i) {
+    repo.addRoundTrip(testutil::randomPeerId(), milliseconds(1));
+  }
+  EXPECT_LE(repo.size(), 16);
+  EXPECT_FALSE(repo.getEstimate(first));
+}
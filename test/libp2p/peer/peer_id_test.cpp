@@ -111,3 +111,24 @@ TEST_F(PeerIdTest, FromHashNotSha256) {
 
   EXPECT_FALSE(PeerId::fromHash(hash));
 }
+
+/**
+ * @given PeerId
+ * @when it is encoded to base58, copied and moved
+ * @then string is encoded once and kept by PeerId and its copies
+ */
+TEST_F(PeerIdTest, CachedBase58) {
+  auto hash = EXPECT_OK(Multihash::create(libp2p::multi::sha256, kBuffer));
+  auto peer_id = EXPECT_OK(PeerId::fromHash(hash));
+
+  const auto &b58 = peer_id.toBase58();
+  EXPECT_EQ(b58, encodeBase58(hash.toBuffer()));
+  EXPECT_EQ(&peer_id.toBase58(), &b58);
+
+  auto copy = peer_id;
+  EXPECT_EQ(copy.toBase58(), b58);
+  auto moved = std::move(copy);
+  EXPECT_EQ(moved.toBase58(), b58);
+  copy = moved;
+  EXPECT_EQ(copy.toBase58(), b58);
+}
@@ -0,0 +1,192 @@
+/**
+ * Copyright Quadrivium LLC
+ * All Rights Reserved
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <thread>
+
+#include <boost/filesystem.hpp>
+#include <gtest/gtest.h>
+
+#include <libp2p/basic/scheduler/manual_scheduler_backend.hpp>
+#include <libp2p/basic/scheduler/scheduler_impl.hpp>
+#include <libp2p/common/literals.hpp>
+#include <libp2p/peer/address_repository/sqlite_address_repository.hpp>
+#include <libp2p/peer/key_repository/sqlite_key_repository.hpp>
+#include <libp2p/peer/protocol_repository/sqlite_protocol_repository.hpp>
+#include "mock/libp2p/network/dnsaddr_resolver_mock.hpp"
+#include "testutil/libp2p/peer.hpp"
+#include "testutil/prepare_loggers.hpp"
+
+using libp2p::basic::ManualSchedulerBackend;
+using libp2p::basic::Scheduler;
+using libp2p::basic::SchedulerImpl;
+using libp2p::crypto::Key;
+using libp2p::crypto::PublicKey;
+using libp2p::multi::Multiaddress;
+using libp2p::storage::SQLite;
+using libp2p::storage::SQLiteWriteQueue;
+using namespace libp2p::peer;
+using namespace libp2p::common;
+
+struct SqlitePeerstoreTest : public ::testing::Test {
+  void SetUp() override {
+    testutil::prepareLoggers();
+  }
+
+  void TearDown() override {
+    close();
+    for (auto suffix : {"", "-wal", "-shm"}) {
+      boost::filesystem::remove(kDbFile + suffix);
+    }
+  }
+
+  void close() {
+    addresses.reset();
+    keys.reset();
+    protocols.reset();
+    queue.reset();
+    db.reset();
+  }
+
+  /// Reopens database, as on restart of node
+  void open() {
+    close();
+    db = std::make_shared<SQLite>(kDbFile);
+    queue = std::make_shared<SQLiteWriteQueue>(
+        db, scheduler, SQLiteWriteQueue::Config{.max_batch_size = 100});
+    addresses = std::make_shared<SqliteAddressRepository>(
+        std::make_shared<libp2p::network::DnsaddrResolverMock>(), queue);
+    keys = std::make_shared<SqliteKeyRepository>(queue);
+    protocols = std::make_shared<SqliteProtocolRepository>(queue);
+  }
+
+  /// Number of rows written to table
+  int rows(const std::string &table) {
+    int count = 0;
+    *db << "SELECT count(*) FROM " + table + ";" >> count;
+    return count;
+  }
+
+  const std::string kDbFile = "peerstore_test.sqlite";
+  std::shared_ptr<ManualSchedulerBackend> scheduler_backend =
+      std::make_shared<ManualSchedulerBackend>();
+  std::shared_ptr<Scheduler> scheduler =
+      std::make_shared<SchedulerImpl>(scheduler_backend, Scheduler::Config{});
+  std::shared_ptr<SQLite> db;
+  std::shared_ptr<SQLiteWriteQueue> queue;
+  std::shared_ptr<SqliteAddressRepository> addresses;
+  std::shared_ptr<SqliteKeyRepository> keys;
+  std::shared_ptr<SqliteProtocolRepository> protocols;
+
+  PeerId p1 = testutil::randomPeerId();
+  PeerId p2 = testutil::randomPeerId();
+  Multiaddress ma1 = "/ip4/127.0.0.1/tcp/40001"_multiaddr;
+  Multiaddress ma2 = "/ip4/127.0.0.1/tcp/40002"_multiaddr;
+};
+
+/**
+ * @given peerstore with addresses, keys and protocols of peers
+ * @when changes are made
+ * @then they are visible at once, but written in one batch on scheduler
+ */
+TEST_F(SqlitePeerstoreTest, WriteBehind) {
+  open();
+  ASSERT_TRUE(addresses->addAddresses(
+      p1, std::vector{ma1, ma2}, std::chrono::hours(1)));
+  ASSERT_TRUE(protocols->addProtocols(p1, std::vector<ProtocolName>{"/a"}));
+  EXPECT_EQ(addresses->getAddresses(p1).value().size(), 2);
+  EXPECT_EQ(rows("peer_addresses"), 0);
+  EXPECT_EQ(queue->size(), 3);
+
+  scheduler_backend->shift(std::chrono::milliseconds(100));
+  EXPECT_EQ(queue->size(), 0);
+  EXPECT_EQ(rows("peer_addresses"), 2);
+  EXPECT_EQ(rows("peer_protocols"), 1);
+}
+
+/**
+ * @given peerstore with addresses, keys and protocols of peers
+ * @when database is reopened
+ * @then peers are loaded on first access with remaining TTL of addresses
+ */
+TEST_F(SqlitePeerstoreTest, Persistence) {
+  open();
+  PublicKey key{{Key::Type::Ed25519, {1, 2, 3}}};
+  ASSERT_TRUE(addresses->addAddresses(
+      p1, std::span(&ma1, 1), std::chrono::hours(1)));
+  ASSERT_TRUE(
+      addresses->upsertAddresses(p2, std::span(&ma2, 1), ttl::kPermanent));
+  ASSERT_TRUE(keys->addPublicKey(p1, key));
+  ASSERT_TRUE(
+      protocols->addProtocols(p1, std::vector<ProtocolName>{"/a", "/b"}));
+  ASSERT_TRUE(protocols->removeProtocols(p1, std::vector<ProtocolName>{"/b"}));
+  open();
+
+  EXPECT_EQ(addresses->getAddresses(p1).value(), std::vector{ma1});
+  EXPECT_EQ(keys->getPublicKeys(p1).value()->count(key), 1);
+  EXPECT_EQ(protocols->getProtocols(p1).value(),
+            std::vector<ProtocolName>{"/a"});
+
+  // p1 was loaded already, p2 is loaded with all peers
+  EXPECT_EQ(addresses->getPeers(), (std::unordered_set{p1, p2}));
+  EXPECT_EQ(keys->getPeers(), std::unordered_set{p1});
+  EXPECT_EQ(addresses->getAddresses(p2).value(), std::vector{ma2});
+
+  // permanent address survives garbage collection
+  addresses->collectGarbage();
+  EXPECT_TRUE(addresses->getAddresses(p2));
+}
+
+/**
+ * @given addresses stored with TTL, keys and protocols of their peers
+ * @when addresses expire
+ * @then expired are not loaded and deleted from database on garbage
+ * collection, along with keys and protocols of peers left without addresses
+ */
+TEST_F(SqlitePeerstoreTest, Expiration) {
+  open();
+  PublicKey key{{Key::Type::Ed25519, {1, 2, 3}}};
+  ASSERT_TRUE(addresses->addAddresses(
+      p1, std::span(&ma1, 1), std::chrono::milliseconds(1)));
+  ASSERT_TRUE(addresses->addAddresses(
+      p2, std::span(&ma2, 1), std::chrono::hours(1)));
+  ASSERT_TRUE(keys->addPublicKey(p1, key));
+  ASSERT_TRUE(keys->addPublicKey(p2, key));
+  ASSERT_TRUE(protocols->addProtocols(p1, std::vector<ProtocolName>{"/a"}));
+  ASSERT_TRUE(queue->flush());
+  std::this_thread::sleep_for(std::chrono::milliseconds(2));
+  open();
+
+  EXPECT_EQ(addresses->getPeers(), std::unordered_set{p2});
+  EXPECT_EQ(rows("peer_addresses"), 2);
+  addresses->collectGarbage();
+  ASSERT_TRUE(queue->flush());
+  EXPECT_EQ(rows("peer_addresses"), 1);
+  EXPECT_EQ(rows("peer_keys"), 1);
+  EXPECT_EQ(rows("peer_protocols"), 0);
+
+  addresses->clear(p2);
+  ASSERT_TRUE(queue->flush());
+  EXPECT_EQ(rows("peer_addresses"), 0);
+}
+
+/**
+ * @given address stored with short TTL
+ * @when it is added again with longer TTL
+ * @then stored address lives for the longer TTL
+ */
+TEST_F(SqlitePeerstoreTest, AddExtendsExpiration) {
+  open();
+  ASSERT_TRUE(addresses->addAddresses(
+      p1, std::span(&ma1, 1), std::chrono::milliseconds(1)));
+  ASSERT_TRUE(queue->flush());
+  ASSERT_TRUE(addresses->addAddresses(
+      p1, std::span(&ma1, 1), std::chrono::hours(1)));
+  ASSERT_TRUE(queue->flush());
+  std::this_thread::sleep_for(std::chrono::milliseconds(2));
+  open();
+
+  EXPECT_EQ(addresses->getAddresses(p1).value(), std::vector{ma1});
+}
@@ -4,11 +4,19 @@
  * SPDX-License-Identifier: Apache-2.0
  */
 
+#include "src/protocol/gossip/impl/message_builder.hpp"
 #include "src/protocol/gossip/impl/message_cache.hpp"
+#include "src/protocol/gossip/impl/message_parser.hpp"
+#include "src/protocol/gossip/impl/message_receiver.hpp"
 #include "src/protocol/gossip/impl/peer_set.hpp"
+#include "src/protocol/gossip/impl/stream.hpp"
 
 #include <gtest/gtest.h>
+#include <libp2p/basic/scheduler/manual_scheduler_backend.hpp>
+#include <libp2p/basic/scheduler/scheduler_impl.hpp>
+#include <libp2p/multi/uvarint.hpp>
 
+#include "mock/libp2p/connection/stream_mock.hpp"
 #include "testutil/libp2p/peer.hpp"
 
 namespace g = libp2p::protocol::gossip;
@@ -164,7 +172,7 @@ TEST(Gossip, MessageCache) {
 
   // 1. Create the cache
 
-  g::MessageCache cache(msg_lifetime, clock);
+  g::MessageCache cache(msg_lifetime, timer_interval, clock);
 
   // 2. Keep track of inserted messages
 
@@ -208,3 +216,344 @@ TEST(Gossip, MessageCache) {
     }
   }
 }
+
+/**
+ * @given MessageCache with messages inserted during several windows
+ * @when recent ids are requested and windows expire
+ * @then ids come from the newest windows only, expired ones are dropped
+ * at once
+ */
+TEST(Gossip, MessageCacheWindows) {
+  constexpr g::Time window{10};
+  g::Time current_time{1000};
+  g::MessageCache cache(
+      window * 3, window, [&current_time] { return current_time; });
+
+  std::vector<g::MessageId> ids;
+  for (uint64_t seq = 0; seq < 4; ++seq) {
+    auto msg = std::make_shared<g::TopicMessage>(
+        testutil::randomPeerId(), seq, g::fromString("data"), "t");
+    ids.push_back(g::createMessageId(msg->from, msg->seq_no, msg->data));
+    ASSERT_TRUE(cache.insert(msg, ids.back()));
+    ASSERT_FALSE(cache.insert(msg, ids.back()));
+    current_time += window;
+  }
+  cache.shift();
+
+  // current window is empty, the previous two have messages 3 and 2
+  ASSERT_EQ(cache.recentIds("t", 3, 10),
+            (std::vector<g::MessageId>{ids[3], ids[2]}));
+  ASSERT_EQ(cache.recentIds("t", 3, 1), (std::vector<g::MessageId>{ids[3]}));
+  ASSERT_TRUE(cache.recentIds("other", 3, 10).empty());
+
+  ASSERT_EQ(cache.size(), 3);
+  ASSERT_FALSE(cache.contains(ids[0]));
+  ASSERT_TRUE(cache.contains(ids[1]));
+
+  current_time += window * 10;
+  cache.shift();
+  ASSERT_EQ(cache.size(), 0);
+  ASSERT_FALSE(cache.contains(ids[3]));
+}
+
+namespace {
+  /// Collects what was dispatched from parsed RPC
+  struct CollectingReceiver : g::MessageReceiver {
+    void onSubscription(const g::PeerContextPtr &,
+                        bool subscribe,
+                        const g::TopicId &topic) override {
+      subscriptions.emplace_back(subscribe, topic);
+    }
+    void onIHave(const g::PeerContextPtr &,
+                 const g::TopicId &,
+                 const g::MessageId &msg_id) override {
+      ihaves.push_back(msg_id);
+    }
+    void onIWant(const g::PeerContextPtr &, const g::MessageId &) override {}
+    void onIDontWant(const g::PeerContextPtr &,
+                     const g::MessageId &msg_id) override {
+      idontwants.push_back(msg_id);
+    }
+    void onGraft(const g::PeerContextPtr &, const g::TopicId &topic) override {
+      grafts.push_back(topic);
+    }
+    void onPrune(const g::PeerContextPtr &,
+                 const g::TopicId &,
+                 uint64_t) override {}
+    void onTopicMessage(const g::PeerContextPtr &,
+                        g::TopicMessage::Ptr msg) override {
+      messages.push_back(std::move(msg));
+    }
+    void onMessageEnd(const g::PeerContextPtr &) override {}
+
+    std::vector<std::pair<bool, g::TopicId>> subscriptions;
+    std::vector<g::MessageId> ihaves;
+    std::vector<g::MessageId> idontwants;
+    std::vector<g::TopicId> grafts;
+    std::vector<g::TopicMessage::Ptr> messages;
+  };
+}  // namespace
+
+/**
+ * @given A message forwarded to two peers, one of them also gets control
+ * messages
+ * @when Their builders serialize RPCs
+ * @then The message is encoded once and shared by both RPCs, and RPC spliced
+ * from fragments is parsed back with all its fields
+ */
+TEST(Gossip, MessageBuilderSharesEncodedMessage) {
+  auto msg = std::make_shared<g::TopicMessage>(
+      testutil::randomPeerId(), 1, g::fromString("data"), "topic");
+  msg->signature = g::fromString("signature");
+  auto msg_id = g::createMessageId(msg->from, msg->seq_no, msg->data);
+
+  g::MessageBuilder a;
+  g::MessageBuilder b;
+  a.addSubscription(true, "topic");
+  a.addMessage(*msg, msg_id);
+  a.addGraft("topic");
+  a.addIHave("topic", msg_id);
+  b.addMessage(*msg, msg_id);
+
+  auto chain_a = a.serialize();
+  auto chain_b = b.serialize();
+  ASSERT_TRUE(chain_a);
+  ASSERT_TRUE(chain_b);
+  ASSERT_EQ(chain_a.value().size(), 2);
+  ASSERT_EQ(chain_b.value().size(), 2);
+  ASSERT_EQ(chain_a.value()[1], chain_b.value()[1]);
+
+  Bytes wire;
+  for (auto &buffer : chain_a.value()) {
+    wire.insert(wire.end(), buffer->begin(), buffer->end());
+  }
+  auto length = libp2p::multi::UVarint::create(wire);
+  ASSERT_TRUE(length);
+  ASSERT_EQ(length->size() + length->toUInt64(), wire.size());
+
+  g::MessageParser parser;
+  ASSERT_TRUE(parser.parse(std::span(wire).subspan(length->size())));
+  CollectingReceiver receiver;
+  parser.dispatch(nullptr, receiver);
+
+  ASSERT_EQ(receiver.subscriptions.size(), 1);
+  ASSERT_EQ(receiver.subscriptions[0].second, "topic");
+  ASSERT_EQ(receiver.grafts.size(), 1);
+  ASSERT_EQ(receiver.ihaves.size(), 1);
+  ASSERT_EQ(receiver.ihaves[0], msg_id);
+  ASSERT_EQ(receiver.messages.size(), 1);
+  auto &parsed = *receiver.messages[0];
+  ASSERT_EQ(parsed.from, msg->from);
+  ASSERT_EQ(parsed.seq_no, msg->seq_no);
+  ASSERT_EQ(parsed.data, msg->data);
+  ASSERT_EQ(parsed.topic, msg->topic);
+  ASSERT_TRUE(parsed.signature);
+  ASSERT_EQ(parsed.signature.value(), msg->signature.value());
+  ASSERT_FALSE(parsed.key);
+}
+
+/**
+ * @given MessageBuilder with queued messages
+ * @when peer doesn't want one of them
+ * @then the message is dropped from RPC and IDONTWANT goes through the wire
+ */
+TEST(Gossip, MessageBuilderIDontWant) {
+  auto peer = testutil::randomPeerId();
+  auto msg_1 =
+      std::make_shared<g::TopicMessage>(peer, 1, g::fromString("1"), "topic");
+  auto msg_2 =
+      std::make_shared<g::TopicMessage>(peer, 2, g::fromString("2"), "topic");
+  auto id_1 = g::createMessageId(msg_1->from, msg_1->seq_no, msg_1->data);
+  auto id_2 = g::createMessageId(msg_2->from, msg_2->seq_no, msg_2->data);
+
+  g::MessageBuilder builder;
+  builder.addMessage(*msg_1, id_1);
+  builder.addMessage(*msg_2, id_2);
+  builder.removeMessage(id_1);
+  builder.addIDontWant(id_2);
+
+  auto chain = builder.serialize();
+  ASSERT_TRUE(chain);
+  ASSERT_EQ(chain.value().size(), 2);
+
+  Bytes wire;
+  for (auto &buffer : chain.value()) {
+    wire.insert(wire.end(), buffer->begin(), buffer->end());
+  }
+  auto length = libp2p::multi::UVarint::create(wire);
+  ASSERT_TRUE(length);
+
+  g::MessageParser parser;
+  ASSERT_TRUE(parser.parse(std::span(wire).subspan(length->size())));
+  CollectingReceiver receiver;
+  parser.dispatch(nullptr, receiver);
+
+  ASSERT_EQ(receiver.idontwants, std::vector<g::MessageId>{id_2});
+  ASSERT_EQ(receiver.messages.size(), 1);
+  ASSERT_EQ(receiver.messages[0]->seq_no, msg_2->seq_no);
+}
+
+/**
+ * @given MessageBuilder with queued messages only
+ * @when peer doesn't want any of them
+ * @then the builder is empty, so no RPC is written
+ */
+TEST(Gossip, MessageBuilderAllRemoved) {
+  auto peer = testutil::randomPeerId();
+  auto msg =
+      std::make_shared<g::TopicMessage>(peer, 1, g::fromString("1"), "topic");
+  auto id = g::createMessageId(msg->from, msg->seq_no, msg->data);
+
+  g::MessageBuilder builder;
+  builder.addMessage(*msg, id);
+  builder.removeMessage(id);
+  ASSERT_TRUE(builder.empty());
+
+  builder.addSubscription(true, "topic");
+  builder.addMessage(*msg, id);
+  builder.removeMessage(id);
+  ASSERT_FALSE(builder.empty());
+}
+
+/**
+ * @given gossip stream with a write in progress and small outbound budget
+ * @when more forwarded messages and a control message are written
+ * @then the oldest forwarded message is dropped, control goes first in the
+ * next RPC
+ */
+TEST(Gossip, StreamOutboundQueue) {
+  using testing::_;
+
+  g::Config config;
+  config.max_pending_bytes = 2500;
+  config.overflow_policy = g::Config::OverflowPolicy::DROP_OLDEST;
+
+  auto scheduler = std::make_shared<libp2p::basic::SchedulerImpl>(
+      std::make_shared<libp2p::basic::ManualSchedulerBackend>(),
+      libp2p::basic::Scheduler::Config{});
+  g::Stream::Feedback feedback = [](g::PeerContextPtr,
+                                    outcome::result<g::Success>) {};
+  CollectingReceiver unused;
+  auto mock =
+      std::make_shared<testing::NiceMock<libp2p::connection::StreamMock>>();
+  std::vector<Bytes> written;
+  libp2p::basic::Writer::WriteCallbackFunc write_cb;
+  EXPECT_CALL(*mock, writeSome(_, _, _))
+      .WillRepeatedly([&](libp2p::BytesIn in,
+                          size_t,
+                          libp2p::basic::Writer::WriteCallbackFunc cb) {
+        written.emplace_back(in.begin(), in.end());
+        write_cb = std::move(cb);
+      });
+  auto peer = std::make_shared<g::PeerContext>(testutil::randomPeerId());
+  auto stream = std::make_shared<g::Stream>(
+      0, config, *scheduler, feedback, unused, mock, peer);
+
+  std::vector<g::TopicMessage::Ptr> messages;
+  auto forward = [&] {
+    auto &msg = messages.emplace_back(std::make_shared<g::TopicMessage>(
+        peer->peer_id, messages.size(), Bytes(1000, 1), "topic"));
+    g::MessageBuilder builder;
+    builder.addMessage(*msg,
+                       g::createMessageId(msg->from, msg->seq_no, msg->data));
+    stream->write(builder.serialize());
+  };
+
+  auto dropped = g::GossipMetrics::get().dropped.value();
+  forward();
+  ASSERT_EQ(written.size(), 1);
+  forward();
+  forward();
+  forward();
+  g::MessageBuilder control;
+  control.addGraft("topic");
+  stream->write(control.serialize());
+  ASSERT_EQ(written.size(), 1);
+  ASSERT_EQ(g::GossipMetrics::get().dropped.value(), dropped + 1);
+
+  write_cb(written.back().size());
+  ASSERT_EQ(written.size(), 2);
+
+  auto &wire = written.back();
+  auto length = libp2p::multi::UVarint::create(wire);
+  ASSERT_TRUE(length);
+  ASSERT_EQ(length->size() + length->toUInt64(), wire.size());
+  // control is ahead of forwarded messages
+  ASSERT_EQ(wire[length->size()] >> 3, 3);
+
+  g::MessageParser parser;
+  ASSERT_TRUE(parser.parse(std::span(wire).subspan(length->size())));
+  CollectingReceiver receiver;
+  parser.dispatch(peer, receiver);
+  ASSERT_EQ(receiver.grafts.size(), 1);
+  ASSERT_EQ(receiver.messages.size(), 2);
+  ASSERT_EQ(receiver.messages[0]->seq_no, messages[2]->seq_no);
+  ASSERT_EQ(receiver.messages[1]->seq_no, messages[3]->seq_no);
+}
+
+/**
+ * @given outbound stream with write in progress and small queue limit
+ * @when control and forwarded messages exceed the limit several times
+ * @then forwarded messages make space for control, queue overflow is reported
+ * once and the control lane is not grown further
+ */
+TEST(Gossip, StreamControlOverflow) {
+  using testing::_;
+
+  g::Config config;
+  config.max_pending_bytes = 1500;
+  config.overflow_policy = g::Config::OverflowPolicy::DROP_NEWEST;
+
+  auto backend = std::make_shared<libp2p::basic::ManualSchedulerBackend>();
+  auto scheduler = std::make_shared<libp2p::basic::SchedulerImpl>(
+      backend, libp2p::basic::Scheduler::Config{});
+  std::vector<std::error_code> errors;
+  g::Stream::Feedback feedback = [&](g::PeerContextPtr,
+                                     outcome::result<g::Success> event) {
+    if (!event) {
+      errors.emplace_back(event.error());
+    }
+  };
+  CollectingReceiver unused;
+  auto mock =
+      std::make_shared<testing::NiceMock<libp2p::connection::StreamMock>>();
+  size_t writes = 0;
+  EXPECT_CALL(*mock, writeSome(_, _, _)).WillRepeatedly([&] { ++writes; });
+  auto peer = std::make_shared<g::PeerContext>(testutil::randomPeerId());
+  auto stream = std::make_shared<g::Stream>(
+      0, config, *scheduler, feedback, unused, mock, peer);
+
+  auto forward = [&](uint64_t seq) {
+    g::TopicMessage msg(peer->peer_id, seq, Bytes(1000, 1), "topic");
+    g::MessageBuilder builder;
+    builder.addMessage(msg,
+                       g::createMessageId(msg.from, msg.seq_no, msg.data));
+    stream->write(builder.serialize());
+  };
+  auto control = [&](size_t topics) {
+    g::MessageBuilder builder;
+    for (size_t i = 0; i < topics; ++i) {
+      builder.addGraft(std::string(100, 'a' + i % 26));
+    }
+    stream->write(builder.serialize());
+  };
+
+  auto dropped = g::GossipMetrics::get().dropped.value();
+  forward(0);
+  ASSERT_EQ(writes, 1);
+  forward(1);
+  // forwarded message is evicted for control even with DROP_NEWEST
+  control(5);
+  ASSERT_EQ(g::GossipMetrics::get().dropped.value(), dropped + 1);
+  backend->shift(std::chrono::milliseconds::zero());
+  ASSERT_TRUE(errors.empty());
+
+  control(5);
+  control(5);
+  control(5);
+  control(5);
+  backend->shift(std::chrono::milliseconds::zero());
+  ASSERT_EQ(errors.size(), 1);
+  ASSERT_EQ(errors.front(), g::Error::WRITER_QUEUE_OVERFLOW);
+  ASSERT_EQ(writes, 1);
+}
@@ -0,0 +1,184 @@
+/**
+ * Copyright Quadrivium LLC
+ * All Rights Reserved
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "src/protocol/gossip/impl/remote_subscriptions.hpp"
+
+#include <gtest/gtest.h>
+#include <libp2p/basic/scheduler/manual_scheduler_backend.hpp>
+#include <libp2p/basic/scheduler/scheduler_impl.hpp>
+#include "mock/libp2p/host/host_mock.hpp"
+#include "mock/libp2p/peer/peer_repository_mock.hpp"
+#include "src/protocol/gossip/impl/connectivity.hpp"
+#include "src/protocol/gossip/impl/message_builder.hpp"
+#include "src/protocol/gossip/impl/message_cache.hpp"
+#include "testutil/libp2p/peer.hpp"
+#include "testutil/prepare_loggers.hpp"
+
+namespace g = libp2p::protocol::gossip;
+
+using libp2p::HostMock;
+using libp2p::basic::ManualSchedulerBackend;
+using libp2p::basic::Scheduler;
+using libp2p::basic::SchedulerImpl;
+using libp2p::peer::LatencyRepository;
+using libp2p::peer::PeerInfo;
+using libp2p::peer::PeerRepositoryMock;
+using std::chrono::seconds;
+using testing::Return;
+using testing::ReturnRef;
+
+class RemoteSubscriptionsTest : public ::testing::Test {
+ public:
+  void SetUp() override {
+    testutil::prepareLoggers();
+
+    config.D_min = 2;
+    config.D_max = 4;
+    config.heartbeat_budget_usec = std::chrono::microseconds::zero();
+
+    ON_CALL(*host, getPeerInfo())
+        .WillByDefault(Return(PeerInfo{testutil::randomPeerId(), {}}));
+    ON_CALL(*host, getPeerRepository())
+        .WillByDefault(ReturnRef(peer_repository));
+    ON_CALL(peer_repository, getLatencyRepository())
+        .WillByDefault(ReturnRef(latency));
+  }
+
+  /// Creates remote subscriptions with current config
+  void create() {
+    connectivity = std::make_shared<g::Connectivity>(
+        config, scheduler, host, nullptr, [](bool, const g::PeerContextPtr &) {
+        });
+    subscriptions = std::make_unique<g::RemoteSubscriptions>(
+        config, *connectivity, msg_cache, *scheduler, log);
+  }
+
+  /// Creates peer subscribed to topic
+  g::PeerContextPtr subscribedPeer(const g::TopicId &topic) {
+    auto peer = std::make_shared<g::PeerContext>(testutil::randomPeerId());
+    subscriptions->onPeerSubscribed(peer, topic);
+    return peer;
+  }
+
+  /// Returns true if peer was grafted since previous call
+  static bool grafted(const g::PeerContextPtr &peer) {
+    if (peer->message_builder->empty()) {
+      return false;
+    }
+    std::ignore = peer->message_builder->serialize();
+    return true;
+  }
+
+  g::Config config;
+  std::shared_ptr<ManualSchedulerBackend> scheduler_backend =
+      std::make_shared<ManualSchedulerBackend>();
+  std::shared_ptr<Scheduler> scheduler =
+      std::make_shared<SchedulerImpl>(scheduler_backend, Scheduler::Config{});
+  std::shared_ptr<testing::NiceMock<HostMock>> host =
+      std::make_shared<testing::NiceMock<HostMock>>();
+  testing::NiceMock<PeerRepositoryMock> peer_repository;
+  LatencyRepository latency;
+  g::MessageCache msg_cache{
+      config.message_cache_lifetime_msec,
+      config.heartbeat_interval_msec,
+      [this] { return scheduler->now(); }};
+  libp2p::log::SubLogger log{"gossip", "test"};
+  std::shared_ptr<g::Connectivity> connectivity;
+  std::unique_ptr<g::RemoteSubscriptions> subscriptions;
+};
+
+/**
+ * @given topic with incomplete mesh
+ * @when mesh peer prunes this host for backoff period
+ * @then topic stays dirty and the peer is grafted again on heartbeat after
+ * the backoff ends, complete mesh is not visited
+ */
+TEST_F(RemoteSubscriptionsTest, DirtyTopics) {
+  create();
+  subscriptions->onSelfSubscribed(true, "a");
+  auto peer_1 = subscribedPeer("a");
+  auto peer_2 = subscribedPeer("a");
+
+  subscriptions->onHeartbeat();
+  ASSERT_TRUE(grafted(peer_1));
+  ASSERT_TRUE(grafted(peer_2));
+
+  // mesh is complete, topic is clean
+  subscriptions->onHeartbeat();
+  ASSERT_FALSE(grafted(peer_1));
+  ASSERT_FALSE(grafted(peer_2));
+
+  subscriptions->onPrune(peer_1, "a", 10);
+  subscriptions->onHeartbeat();
+  ASSERT_FALSE(grafted(peer_1));
+
+  scheduler_backend->shift(seconds(11));
+  subscriptions->onHeartbeat();
+  ASSERT_TRUE(grafted(peer_1));
+  ASSERT_FALSE(grafted(peer_2));
+}
+
+/**
+ * @given dirty topics taking more than heartbeat budget to process
+ * @when heartbeat happens
+ * @then some topics are postponed to the following IO loop cycles
+ */
+TEST_F(RemoteSubscriptionsTest, HeartbeatBudget) {
+  config.D_min = 20;
+  config.D_max = 30;
+  config.heartbeat_budget_usec = std::chrono::microseconds(1);
+  create();
+
+  std::vector<std::vector<g::PeerContextPtr>> peers(3);
+  for (size_t i = 0; i < peers.size(); ++i) {
+    auto topic = std::to_string(i);
+    subscriptions->onSelfSubscribed(true, topic);
+    for (size_t j = 0; j < config.D_min; ++j) {
+      peers[i].push_back(subscribedPeer(topic));
+    }
+  }
+  auto topic_grafted = [](const std::vector<g::PeerContextPtr> &topic_peers) {
+    return std::all_of(topic_peers.begin(), topic_peers.end(), grafted);
+  };
+
+  subscriptions->onHeartbeat();
+  std::vector<bool> processed;
+  for (auto &topic_peers : peers) {
+    processed.push_back(topic_grafted(topic_peers));
+  }
+  size_t processed_count =
+      std::count(processed.begin(), processed.end(), true);
+  ASSERT_GE(processed_count, 1);
+  ASSERT_LT(processed_count, peers.size());
+
+  // the rest of heartbeat is deferred
+  scheduler_backend->shift(seconds(0));
+  for (size_t i = 0; i < peers.size(); ++i) {
+    ASSERT_EQ(topic_grafted(peers[i]), not processed[i]);
+  }
+}
+
+/**
+ * @given topic this host published to without subscribing
+ * @when its fanout period expires
+ * @then the topic is dropped on heartbeat
+ */
+TEST_F(RemoteSubscriptionsTest, FanoutExpiration) {
+  create();
+  auto msg = std::make_shared<g::TopicMessage>(
+      testutil::randomPeerId(), 1, g::fromString("data"), "f");
+  auto msg_id = g::createMessageId(msg->from, msg->seq_no, msg->data);
+  subscriptions->onNewMessage(boost::none, msg, msg_id);
+  ASSERT_TRUE(subscriptions->hasTopic("f"));
+
+  scheduler_backend->shift(config.seen_cache_lifetime_msec / 2);
+  subscriptions->onHeartbeat();
+  ASSERT_TRUE(subscriptions->hasTopic("f"));
+
+  scheduler_backend->shift(config.seen_cache_lifetime_msec);
+  subscriptions->onHeartbeat();
+  ASSERT_FALSE(subscriptions->hasTopic("f"));
+}
@@ -0,0 +1,75 @@
+/**
+ * Copyright Quadrivium LLC
+ * All Rights Reserved
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "src/protocol/gossip/impl/seen_cache.hpp"
+
+#include <gtest/gtest.h>
+
+namespace g = libp2p::protocol::gossip;
+
+using std::chrono::milliseconds;
+
+namespace {
+  g::MessageId makeId(uint64_t i) {
+    return g::createSeqNo(i);
+  }
+}  // namespace
+
+/**
+ * @given seen cache
+ * @when message ids are inserted twice
+ * @then the second insert reports duplicate
+ */
+TEST(SeenCacheTest, Duplicates) {
+  g::SeenCache cache{milliseconds{1000}, 1000};
+  milliseconds now{1};
+  for (uint64_t i = 0; i < 500; ++i) {
+    ASSERT_TRUE(cache.insert(makeId(i), now));
+  }
+  for (uint64_t i = 0; i < 500; ++i) {
+    ASSERT_FALSE(cache.insert(makeId(i), now));
+    ASSERT_TRUE(cache.contains(makeId(i)));
+  }
+  ASSERT_FALSE(cache.contains(makeId(500)));
+  ASSERT_EQ(cache.size(), 500);
+}
+
+/**
+ * @given seen cache with ids inserted over time
+ * @when lifetime passes
+ * @then ids are remembered at least for lifetime and forgotten after it
+ */
+TEST(SeenCacheTest, Expiration) {
+  milliseconds lifetime{700};
+  g::SeenCache cache{lifetime, 1000, 8};
+  milliseconds start{1000};
+  for (uint64_t i = 0; i < 10; ++i) {
+    cache.insert(makeId(i), start + milliseconds{i * 10});
+  }
+  cache.rotate(start + lifetime + milliseconds{90});
+  for (uint64_t i = 0; i < 10; ++i) {
+    ASSERT_TRUE(cache.contains(makeId(i)));
+  }
+  cache.rotate(start + lifetime + lifetime / 7 + milliseconds{100});
+  ASSERT_EQ(cache.size(), 0);
+}
+
+/**
+ * @given seen cache
+ * @when more ids than its capacity arrive within lifetime
+ * @then memory stays bounded and the newest ids are remembered
+ */
+TEST(SeenCacheTest, Capacity) {
+  g::SeenCache cache{milliseconds{1000}, 800, 8};
+  milliseconds now{1};
+  for (uint64_t i = 0; i < 10000; ++i) {
+    ASSERT_TRUE(cache.insert(makeId(i), now));
+  }
+  ASSERT_LE(cache.size(), 800);
+  for (uint64_t i = 10000 - 600; i < 10000; ++i) {
+    ASSERT_TRUE(cache.contains(makeId(i)));
+  }
+}
@@ -0,0 +1,196 @@
+/**
+ * Copyright Quadrivium LLC
+ * All Rights Reserved
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "src/protocol/gossip/impl/signature_verifier.hpp"
+
+#include <gtest/gtest.h>
+#include <boost/asio/executor_work_guard.hpp>
+#include <libp2p/basic/scheduler/asio_scheduler_backend.hpp>
+#include <libp2p/basic/scheduler/scheduler_impl.hpp>
+
+#include "mock/libp2p/crypto/crypto_provider_mock.hpp"
+#include "mock/libp2p/crypto/key_marshaller_mock.hpp"
+#include "src/protocol/gossip/impl/message_builder.hpp"
+
+namespace g = libp2p::protocol::gossip;
+
+using libp2p::Bytes;
+using libp2p::BytesIn;
+using libp2p::crypto::CryptoProviderMock;
+using libp2p::crypto::Key;
+using libp2p::crypto::ProtobufKey;
+using libp2p::crypto::PublicKey;
+using libp2p::crypto::marshaller::KeyMarshallerMock;
+using libp2p::peer::PeerId;
+using testing::_;
+using testing::Invoke;
+using testing::Return;
+
+struct SignatureVerifierTest : public ::testing::Test {
+  void SetUp() override {
+    // signature is valid if it is equal to signable bytes
+    ON_CALL(*crypto_provider, verify(_, _, _))
+        .WillByDefault(Invoke(
+            [](BytesIn message, BytesIn signature, const PublicKey &) {
+              return std::equal(message.begin(),
+                                message.end(),
+                                signature.begin(),
+                                signature.end());
+            }));
+    ON_CALL(*key_marshaller, unmarshalPublicKey(_))
+        .WillByDefault(Invoke([](const ProtobufKey &key) {
+          return PublicKey{{Key::Type::Ed25519, key.key}};
+        }));
+  }
+
+  g::TopicMessage::Ptr makeMessage(uint64_t seq, bool forged) {
+    auto msg = std::make_shared<g::TopicMessage>(
+        author, seq, g::fromString("data"), "topic");
+    msg->key = key.key;
+    msg->signature = g::MessageBuilder::signableMessage(*msg).value();
+    if (forged) {
+      msg->signature->back() ^= 1;
+    }
+    return msg;
+  }
+
+  g::MessageId idOf(const g::TopicMessage &msg) {
+    return g::createMessageId(msg.from, msg.seq_no, msg.data);
+  }
+
+  ProtobufKey key{Bytes(64, 1)};
+  PeerId author = PeerId::fromPublicKey(key).value();
+  std::shared_ptr<CryptoProviderMock> crypto_provider =
+      std::make_shared<testing::NiceMock<CryptoProviderMock>>();
+  std::shared_ptr<KeyMarshallerMock> key_marshaller =
+      std::make_shared<testing::NiceMock<KeyMarshallerMock>>();
+};
+
+/**
+ * @given signed messages
+ * @when verified synchronously
+ * @then signature is checked against message key, key must belong to author
+ */
+TEST_F(SignatureVerifierTest, VerifyMessage) {
+  auto verify = [&](const g::TopicMessage &msg) {
+    return g::SignatureVerifier::verifyMessage(
+               msg, *crypto_provider, *key_marshaller)
+        .value();
+  };
+
+  auto msg = makeMessage(1, false);
+  ASSERT_TRUE(verify(*msg));
+  ASSERT_FALSE(verify(*makeMessage(1, true)));
+
+  auto foreign_key = *msg;
+  foreign_key.key = Bytes(64, 2);
+  ASSERT_FALSE(verify(foreign_key));
+
+  auto unsigned_msg = *msg;
+  unsigned_msg.signature = boost::none;
+  ASSERT_FALSE(verify(unsigned_msg));
+}
+
+/**
+ * @given verifier with several workers and small batches
+ * @when messages including copies of the same one are queued
+ * @then verdicts are fed back in order and every signed message is verified
+ * once
+ */
+TEST_F(SignatureVerifierTest, BatchesInOrder) {
+  auto io = std::make_shared<boost::asio::io_context>();
+  auto scheduler = std::make_shared<libp2p::basic::SchedulerImpl>(
+      std::make_shared<libp2p::basic::AsioSchedulerBackend>(io),
+      libp2p::basic::Scheduler::Config{});
+  auto work = boost::asio::make_work_guard(*io);
+
+  g::Config config;
+  config.verify_threads = 2;
+  config.verify_batch_size = 2;
+
+  std::vector<std::pair<g::MessageId, bool>> verdicts;
+  size_t expected = 0;
+  auto verifier = std::make_shared<g::SignatureVerifier>(
+      config,
+      scheduler,
+      crypto_provider,
+      key_marshaller,
+      [&](std::vector<g::SignatureVerifier::Verified> &verified) {
+        for (auto &v : verified) {
+          verdicts.emplace_back(v.msg_id, v.valid);
+        }
+        if (verdicts.size() == expected) {
+          io->stop();
+        }
+      });
+
+  auto m1 = makeMessage(1, false);
+  auto m2 = makeMessage(2, true);
+  auto m3 = makeMessage(3, false);
+  EXPECT_CALL(*crypto_provider, verify(_, _, _)).Times(3);
+
+  expected = 4;
+  verifier->verify(nullptr, m1, idOf(*m1));
+  verifier->verify(nullptr, m1, idOf(*m1));
+  verifier->verify(nullptr, m2, idOf(*m2));
+  verifier->verify(nullptr, m3, idOf(*m3));
+  io->run_for(std::chrono::seconds(5));
+
+  std::vector<std::pair<g::MessageId, bool>> order{
+      {idOf(*m1), true},
+      {idOf(*m1), true},
+      {idOf(*m2), false},
+      {idOf(*m3), true},
+  };
+  ASSERT_EQ(verdicts, order);
+
+  // verdict is remembered
+  expected = 5;
+  io->restart();
+  verifier->verify(nullptr, m2, idOf(*m2));
+  io->run_for(std::chrono::seconds(5));
+  ASSERT_EQ(verdicts.size(), 5);
+  ASSERT_FALSE(verdicts.back().second);
+}
+
+/**
+ * @given verifier which has remembered verdict of signed message
+ * @when copy of the message with the same id and forged signature is queued
+ * @then it is verified on its own and is rejected
+ */
+TEST_F(SignatureVerifierTest, VerdictNotSharedByMessageId) {
+  auto io = std::make_shared<boost::asio::io_context>();
+  auto scheduler = std::make_shared<libp2p::basic::SchedulerImpl>(
+      std::make_shared<libp2p::basic::AsioSchedulerBackend>(io),
+      libp2p::basic::Scheduler::Config{});
+  auto work = boost::asio::make_work_guard(*io);
+
+  std::vector<bool> verdicts;
+  auto verifier = std::make_shared<g::SignatureVerifier>(
+      g::Config{},
+      scheduler,
+      crypto_provider,
+      key_marshaller,
+      [&](std::vector<g::SignatureVerifier::Verified> &verified) {
+        for (auto &v : verified) {
+          verdicts.emplace_back(v.valid);
+        }
+        io->stop();
+      });
+
+  auto valid = makeMessage(1, false);
+  auto forged = makeMessage(1, true);
+  ASSERT_EQ(idOf(*valid), idOf(*forged));
+  EXPECT_CALL(*crypto_provider, verify(_, _, _)).Times(2);
+
+  verifier->verify(nullptr, valid, idOf(*valid));
+  io->run_for(std::chrono::seconds(5));
+  io->restart();
+  verifier->verify(nullptr, forged, idOf(*forged));
+  io->run_for(std::chrono::seconds(5));
+
+  ASSERT_EQ(verdicts, (std::vector<bool>{true, false}));
+}
@@ -0,0 +1,132 @@
+/**
+ * Copyright Quadrivium LLC
+ * All Rights Reserved
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <libp2p/protocol/kademlia/impl/lookup_paths.hpp>
+
+#include <set>
+
+#include <gtest/gtest.h>
+
+#include "testutil/libp2p/peer.hpp"
+
+using libp2p::peer::LatencyRepository;
+using libp2p::peer::PeerId;
+using namespace libp2p::protocol::kademlia;
+
+namespace {
+
+  std::vector<PeerId> randomPeers(size_t n) {
+    std::vector<PeerId> peers;
+    for (size_t i = 0; i < n; ++i) {
+      peers.push_back(testutil::randomPeerId());
+    }
+    return peers;
+  }
+
+}  // namespace
+
+struct LookupPathsTest : public ::testing::Test {
+  Config config;
+  NodeId target{testutil::randomPeerId()};
+  LatencyRepository latency;
+  std::shared_ptr<ResponseTimes> response_times =
+      std::make_shared<ResponseTimes>();
+};
+
+/**
+ * @given lookup of 3 disjoint paths
+ * @when all peers are taken
+ * @then every peer is queried by one path only, converged paths stop, lookup
+ * returns on majority of paths
+ */
+TEST_F(LookupPathsTest, DisjointPaths) {
+  config.disjointPaths = 3;
+  config.maxRequestConcurency = 10;
+  auto peers = randomPeers(9);
+  LookupPaths paths(config, target, peers, response_times);
+  ASSERT_TRUE(paths.disjoint());
+  EXPECT_EQ(paths.queued(), 9);
+
+  std::set<PeerId> seen;
+  std::vector<size_t> per_path(3);
+  while (auto next = paths.next(latency)) {
+    EXPECT_TRUE(seen.insert(next->peer_id).second);
+    ++per_path[next->path];
+    paths.begin(next->path, next->peer_id);
+  }
+  EXPECT_EQ(seen.size(), 9);
+  EXPECT_EQ(per_path, std::vector<size_t>({3, 3, 3}));
+
+  // known peers are not queued again, even by other paths
+  EXPECT_FALSE(paths.add(1, peers[0]));
+  EXPECT_TRUE(paths.add(0, testutil::randomPeerId()));
+  EXPECT_TRUE(paths.add(0, testutil::randomPeerId()));
+
+  paths.converge(0);
+  EXPECT_FALSE(paths.quorum());
+  EXPECT_FALSE(paths.next(latency));
+  paths.converge(2);
+  EXPECT_TRUE(paths.quorum());
+}
+
+/**
+ * @given single path lookup with concurrency 2 and max concurrency 3
+ * @when requests become slow
+ * @then slow requests release their slots up to the max concurrency
+ */
+TEST_F(LookupPathsTest, SlowRequests) {
+  config.requestConcurency = 2;
+  config.maxRequestConcurency = 3;
+  LookupPaths paths(config, target, randomPeers(5), response_times);
+  ASSERT_FALSE(paths.disjoint());
+
+  auto first = paths.next(latency);
+  ASSERT_TRUE(first);
+  paths.begin(first->path, first->peer_id);
+  auto second = paths.next(latency);
+  ASSERT_TRUE(second);
+  paths.begin(second->path, second->peer_id);
+  EXPECT_FALSE(paths.next(latency));
+
+  EXPECT_TRUE(paths.slow(first->peer_id));
+  EXPECT_FALSE(paths.slow(first->peer_id));
+  auto third = paths.next(latency);
+  ASSERT_TRUE(third);
+  paths.begin(third->path, third->peer_id);
+  EXPECT_EQ(paths.inProgress(), 3);
+
+  EXPECT_TRUE(paths.slow(second->peer_id));
+  EXPECT_FALSE(paths.next(latency));
+
+  EXPECT_EQ(paths.finish(first->peer_id, false), 0);
+  EXPECT_FALSE(paths.finish(first->peer_id, false));
+  EXPECT_TRUE(paths.next(latency));
+}
+
+/**
+ * @given recent response times
+ * @when slow request time is asked
+ * @then it is the percentile of response times, or none if there is too few
+ * samples or it exceeds response timeout
+ */
+TEST_F(LookupPathsTest, SlowRequestTime) {
+  config.slowRequestPercentile = 0.9;
+  config.minSlowRequestTime = std::chrono::milliseconds(10);
+  LookupPaths paths(config, target, {}, response_times);
+  EXPECT_FALSE(paths.slowRequestTime());
+
+  for (int i = 1; i <= 100; ++i) {
+    response_times->add(std::chrono::milliseconds(i));
+  }
+  auto time = paths.slowRequestTime();
+  ASSERT_TRUE(time);
+  EXPECT_NEAR(time->count(), 90, 2);
+
+  for (int i = 0; i < 256; ++i) {
+    response_times->add(config.responseTimeout);
+  }
+  EXPECT_FALSE(paths.slowRequestTime());
+}
@@ -97,3 +97,32 @@ TEST(KadDistance, SortsHashes) {
   print(NodeId(us), peers);
   ASSERT_TRUE(is_xor_distance_sorted(us, peers));
 }
+
+/**
+ * @given random node ids
+ * @when common prefix length is calculated
+ * @then it matches bit-by-bit comparison
+ */
+TEST(KadDistance, CommonPrefixLen) {
+  srand(0);  // make test deterministic
+  NodeId us("1"_peerid);
+  EXPECT_EQ(us.commonPrefixLen(us), Hash256().size() * CHAR_BIT);
+
+  for (auto i = 0; i < 1000; ++i) {
+    NodeId other(testutil::randomPeerId());
+    // share a random prefix to cover every word of the hash
+    auto shared = static_cast<size_t>(rand()) % Hash256().size();
+    std::copy_n(us.getData().begin(), shared, other.getData().begin());
+
+    auto distance = us.distance(other);
+    size_t expected = 0;
+    while (expected < distance.size() * CHAR_BIT
+           and ((distance[expected / CHAR_BIT]
+                 >> (CHAR_BIT - 1 - expected % CHAR_BIT))
+                & 1)
+                   == 0) {
+      ++expected;
+    }
+    EXPECT_EQ(us.commonPrefixLen(other), expected);
+  }
+}
@@ -316,3 +316,36 @@ TEST_F(PeerRoutingTableTest, Find) {
     EXPECT_EQ(found[0].toHex(), peer.toHex()) << "failed to lookup known node";
   }
 }
+
+/**
+ * @given routing table with peers in one bucket
+ * @when nearest peers are requested for a target
+ * @then peers closest to the target are returned in ascending order of XOR
+ * distance
+ */
+TEST_F(PeerRoutingTableTest, NearestPeersSorted) {
+  config_->maxBucketSize = 100;
+  srand(0);  // to make test deterministic
+
+  const auto nPeers = 50;
+  const size_t count = 10;
+
+  std::vector<PeerId> peers;
+  std::generate_n(std::back_inserter(peers), nPeers, testutil::randomPeerId);
+  for (const auto &peer : peers) {
+    EXPECT_OK(table_->update(peer, false));
+  }
+  ASSERT_EQ(table_->size(), nPeers);
+
+  NodeId target(testutil::randomPeerId());
+  auto expected = peers;
+  std::sort(expected.begin(),
+            expected.end(),
+            [&](const PeerId &a, const PeerId &b) {
+              return NodeId(a).distance(target) < NodeId(b).distance(target);
+            });
+  expected.resize(count);
+
+  auto found = table_->getNearestPeers(target, count);
+  EXPECT_EQ(found, expected);
+}
@@ -0,0 +1,149 @@
+/**
+ * Copyright Quadrivium LLC
+ * All Rights Reserved
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <libp2p/protocol/kademlia/impl/storage_backend_sqlite.hpp>
+
+#include <boost/filesystem.hpp>
+#include <gtest/gtest.h>
+
+#include <libp2p/basic/scheduler/manual_scheduler_backend.hpp>
+#include <libp2p/basic/scheduler/scheduler_impl.hpp>
+#include <libp2p/protocol/kademlia/error.hpp>
+#include "testutil/prepare_loggers.hpp"
+
+using libp2p::basic::ManualSchedulerBackend;
+using libp2p::basic::Scheduler;
+using libp2p::basic::SchedulerImpl;
+using libp2p::storage::SQLite;
+using libp2p::storage::SQLiteWriteQueue;
+using namespace libp2p::protocol::kademlia;
+
+struct StorageBackendSqliteTest : public ::testing::Test {
+  void SetUp() override {
+    testutil::prepareLoggers();
+  }
+
+  void TearDown() override {
+    backend.reset();
+    queue.reset();
+    db.reset();
+    for (auto suffix : {"", "-wal", "-shm"}) {
+      boost::filesystem::remove(kDbFile + suffix);
+    }
+  }
+
+  void open() {
+    backend.reset();
+    queue.reset();
+    db = std::make_shared<SQLite>(kDbFile);
+    queue = std::make_shared<SQLiteWriteQueue>(db, scheduler, queue_config);
+    backend = std::make_shared<StorageBackendSqlite>(queue, config);
+  }
+
+  /// Number of records written to database
+  int rows() {
+    int count = 0;
+    *db << "SELECT count(*) FROM kademlia_records;" >> count;
+    return count;
+  }
+
+  static Key key(uint8_t i) {
+    return Key{i};
+  }
+
+  const std::string kDbFile = "kademlia_storage_test.sqlite";
+  std::shared_ptr<ManualSchedulerBackend> scheduler_backend =
+      std::make_shared<ManualSchedulerBackend>();
+  std::shared_ptr<Scheduler> scheduler =
+      std::make_shared<SchedulerImpl>(scheduler_backend, Scheduler::Config{});
+  SQLiteWriteQueue::Config queue_config{
+      .flush_interval = std::chrono::milliseconds(100),
+      .max_batch_size = 100,
+  };
+  StorageBackendSqlite::Config config{.cache_size = 4};
+  std::shared_ptr<SQLite> db;
+  std::shared_ptr<SQLiteWriteQueue> queue;
+  std::shared_ptr<StorageBackendSqlite> backend;
+};
+
+/**
+ * @given backend with buffered writes
+ * @when records are put and erased
+ * @then they are readable at once, but written in one batch on scheduler
+ */
+TEST_F(StorageBackendSqliteTest, BatchedWrites) {
+  open();
+  for (uint8_t i = 0; i < 10; ++i) {
+    ASSERT_TRUE(backend->putRecord(key(i), Value{i}, std::chrono::hours(1)));
+  }
+  ASSERT_TRUE(backend->erase(key(0)));
+  EXPECT_EQ(rows(), 0);
+  EXPECT_EQ(backend->getValue(key(9)).value(), Value{9});
+  EXPECT_EQ(backend->getValue(key(0)).error(), Error::VALUE_NOT_FOUND);
+
+  scheduler_backend->shift(queue_config.flush_interval);
+  EXPECT_EQ(rows(), 9);
+  EXPECT_EQ(backend->getValue(key(1)).value(), Value{1});
+  EXPECT_EQ(backend->getValue(key(0)).error(), Error::VALUE_NOT_FOUND);
+}
+
+/**
+ * @given records stored with TTL
+ * @when backend is reopened
+ * @then records and their remaining lifetime are restored
+ */
+TEST_F(StorageBackendSqliteTest, Persistence) {
+  open();
+  for (uint8_t i = 0; i < 10; ++i) {
+    ASSERT_TRUE(backend->putRecord(key(i), Value{i}, std::chrono::hours(1)));
+  }
+  open();
+
+  // more records than cache holds are read from database
+  for (uint8_t i = 0; i < 10; ++i) {
+    auto record = backend->getRecord(key(i));
+    ASSERT_TRUE(record) << int(i);
+    EXPECT_EQ(record.value().first, Value{i});
+    EXPECT_GT(record.value().second, std::chrono::minutes(59));
+    EXPECT_LE(record.value().second, std::chrono::hours(1));
+  }
+}
+
+/**
+ * @given expired and live records
+ * @when expired records are wiped
+ * @then expired ones are not found and removed from database
+ */
+TEST_F(StorageBackendSqliteTest, Expiration) {
+  open();
+  ASSERT_TRUE(backend->putRecord(key(1), Value{1}, Time::zero()));
+  ASSERT_TRUE(backend->putRecord(key(2), Value{2}, std::chrono::hours(1)));
+  EXPECT_EQ(backend->getRecord(key(1)).error(), Error::VALUE_NOT_FOUND);
+
+  ASSERT_TRUE(backend->flush());
+  EXPECT_EQ(rows(), 2);
+  ASSERT_TRUE(backend->wipeExpired());
+  EXPECT_EQ(rows(), 1);
+  EXPECT_TRUE(backend->getRecord(key(2)));
+}
+
+/**
+ * @given database locked by another connection
+ * @when buffered writes are flushed
+ * @then they are kept and written on the next scheduled flush
+ */
+TEST_F(StorageBackendSqliteTest, FlushRetry) {
+  open();
+  SQLite other(kDbFile);
+  other << "BEGIN EXCLUSIVE;";
+  ASSERT_TRUE(backend->putValue(key(1), Value{1}));
+  EXPECT_FALSE(backend->flush());
+  EXPECT_EQ(backend->getValue(key(1)).value(), Value{1});
+
+  other << "COMMIT;";
+  scheduler_backend->shift(queue_config.flush_interval);
+  EXPECT_EQ(rows(), 1);
+}
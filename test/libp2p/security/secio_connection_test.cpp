@@ -0,0 +1,161 @@
+/**
+ * Copyright Quadrivium LLC
+ * All Rights Reserved
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <libp2p/security/secio/secio_connection.hpp>
+
+#include <gtest/gtest.h>
+#include <libp2p/common/literals.hpp>
+#include <libp2p/crypto/aes_ctr.hpp>
+#include <libp2p/crypto/hmac_provider/hmac_provider_impl.hpp>
+#include "mock/libp2p/connection/layer_connection_mock.hpp"
+#include "mock/libp2p/crypto/key_marshaller_mock.hpp"
+#include "testutil/prepare_loggers.hpp"
+
+using namespace libp2p;
+using namespace connection;
+using namespace crypto;
+using namespace libp2p::common;
+using crypto::common::CipherType;
+using crypto::common::HashType;
+
+using testing::_;
+using testing::Invoke;
+using testing::NiceMock;
+
+class SecioConnectionTest : public testing::Test {
+ public:
+  void SetUp() override {
+    testutil::prepareLoggers();
+
+    ON_CALL(*writer_conn, writeSome(_, _, _))
+        .WillByDefault(Invoke([this](BytesIn in, size_t, auto cb) {
+          wire.insert(wire.end(), in.begin(), in.end());
+          cb(in.size());
+        }));
+    ON_CALL(*reader_conn, read(_, _, _))
+        .WillByDefault(Invoke([this](BytesOut out, size_t bytes, auto cb) {
+          ASSERT_FALSE(pending_read);
+          pending_read = [this, out, bytes, cb{std::move(cb)}] {
+            if (received.size() < bytes) {
+              return false;
+            }
+            std::copy_n(received.begin(), bytes, out.begin());
+            received.erase(received.begin(), received.begin() + bytes);
+            cb(bytes);
+            return true;
+          };
+          deliver();
+        }));
+
+    writer = makeConnection(writer_conn, a_to_b, b_to_a);
+    reader = makeConnection(reader_conn, b_to_a, a_to_b);
+  }
+
+  std::shared_ptr<SecioConnection> makeConnection(
+      std::shared_ptr<LayerConnection> conn,
+      StretchedKey local,
+      StretchedKey remote) {
+    auto secio = std::make_shared<SecioConnection>(
+        std::move(conn),
+        std::make_shared<hmac::HmacProviderImpl>(),
+        std::make_shared<marshaller::KeyMarshallerMock>(),
+        PublicKey{},
+        PublicKey{},
+        HashType::SHA256,
+        CipherType::AES128,
+        std::move(local),
+        std::move(remote));
+    EXPECT_TRUE(secio->init());
+    return secio;
+  }
+
+  /// Calls pending raw read while there are enough received bytes for it
+  void deliver() {
+    while (pending_read) {
+      auto read = std::move(pending_read);
+      pending_read = {};
+      if (not read()) {
+        pending_read = std::move(read);
+        return;
+      }
+    }
+  }
+
+  /// Passes next part of written bytes to reader side
+  void receive(size_t bytes) {
+    bytes = std::min(bytes, wire.size());
+    received.insert(received.end(), wire.begin(), wire.begin() + bytes);
+    wire.erase(wire.begin(), wire.begin() + bytes);
+    deliver();
+  }
+
+  StretchedKey a_to_b{
+      .iv = "3dafba429d9eb430b422da802c9fac41"_unhex,
+      .cipher_key = "06a9214036b8a15b512e03d534120006"_unhex,
+      .mac_key = "a1990aeb68efb1b59d3165795f6338960aa7238b"_unhex,
+  };
+  StretchedKey b_to_a{
+      .iv = "c782dc4c098c66cbd9cd27d825682c81"_unhex,
+      .cipher_key = "c286696d887c9aa0611bbb3e2025a45a"_unhex,
+      .mac_key = "55cd433be9568ee79525a0919cf4b31c28108cee"_unhex,
+  };
+
+  std::shared_ptr<NiceMock<LayerConnectionMock>> writer_conn =
+      std::make_shared<NiceMock<LayerConnectionMock>>();
+  std::shared_ptr<NiceMock<LayerConnectionMock>> reader_conn =
+      std::make_shared<NiceMock<LayerConnectionMock>>();
+  std::shared_ptr<SecioConnection> writer;
+  std::shared_ptr<SecioConnection> reader;
+
+  /// Bytes written by writer and not yet received by reader
+  Bytes wire;
+  /// Bytes received by reader and not yet read
+  Bytes received;
+  std::function<bool()> pending_read;
+};
+
+/**
+ * @given frames written by one side
+ * @when they reach the other side split across several chunks and are read
+ * into buffer smaller than a frame
+ * @then the original data is read in order
+ */
+TEST_F(SecioConnectionTest, ReadFrameSplitAcrossChunks) {
+  std::string_view msg1 = "The fly got to the jam that's all the poem";
+  std::string_view msg2 = "Single block msg";
+  Bytes expected;
+  for (auto msg : {msg1, msg2}) {
+    Bytes data(msg.begin(), msg.end());
+    expected.insert(expected.end(), data.begin(), data.end());
+    bool written = false;
+    writer->writeSome(data, data.size(), [&](outcome::result<size_t> res) {
+      ASSERT_TRUE(res);
+      ASSERT_EQ(res.value(), data.size());
+      written = true;
+    });
+    ASSERT_TRUE(written);
+  }
+
+  constexpr size_t kChunkSize = 7;
+  Bytes result;
+  std::array<uint8_t, 5> out{};
+  while (result.size() < expected.size()) {
+    bool read = false;
+    reader->readSome(out, out.size(), [&](outcome::result<size_t> res) {
+      ASSERT_TRUE(res);
+      ASSERT_GT(res.value(), 0);
+      result.insert(result.end(), out.begin(), out.begin() + res.value());
+      read = true;
+    });
+    while (not read) {
+      ASSERT_FALSE(wire.empty());
+      receive(kChunkSize);
+    }
+  }
+  ASSERT_EQ(result, expected);
+  ASSERT_TRUE(wire.empty());
+  ASSERT_TRUE(received.empty());
+}
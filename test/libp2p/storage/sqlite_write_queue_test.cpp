@@ -0,0 +1,98 @@
+/**
+ * Copyright Quadrivium LLC
+ * All Rights Reserved
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <libp2p/storage/sqlite_write_queue.hpp>
+
+#include <gtest/gtest.h>
+
+#include <libp2p/basic/scheduler/manual_scheduler_backend.hpp>
+#include <libp2p/basic/scheduler/scheduler_impl.hpp>
+#include "testutil/prepare_loggers.hpp"
+
+using libp2p::basic::ManualSchedulerBackend;
+using libp2p::basic::Scheduler;
+using libp2p::basic::SchedulerImpl;
+using libp2p::storage::SQLite;
+using libp2p::storage::SQLiteWriteQueue;
+
+struct SQLiteWriteQueueTest : public ::testing::Test {
+  void SetUp() override {
+    testutil::prepareLoggers();
+
+    *db << "CREATE TABLE numbers (n INTEGER PRIMARY KEY);";
+    insert_ = db->createStatement("INSERT INTO numbers (n) VALUES (?);");
+    queue = std::make_shared<SQLiteWriteQueue>(db, scheduler, config);
+  }
+
+  /// Queues insert, which fails if the number is inserted already
+  void insert(int n) {
+    queue->push([this, n](SQLite &db) { return db.execCommand(insert_, n); });
+  }
+
+  int rows() {
+    int count = 0;
+    *db << "SELECT count(*) FROM numbers;" >> count;
+    return count;
+  }
+
+  void flushByTimer() {
+    scheduler_backend->shift(config.flush_interval);
+  }
+
+  std::shared_ptr<ManualSchedulerBackend> scheduler_backend =
+      std::make_shared<ManualSchedulerBackend>();
+  std::shared_ptr<Scheduler> scheduler = std::make_shared<SchedulerImpl>(
+      scheduler_backend, Scheduler::Config{});
+  std::shared_ptr<SQLite> db = std::make_shared<SQLite>(":memory:");
+  SQLiteWriteQueue::Config config{
+      .flush_interval = std::chrono::milliseconds(100),
+      .max_batch_size = 2,
+      .max_attempts = 2,
+      .max_queue_size = 3,
+  };
+  std::shared_ptr<SQLiteWriteQueue> queue;
+
+ private:
+  SQLite::StatementHandle insert_{};
+};
+
+/**
+ * @given queue with full batch of writes, one of which fails
+ * @when batch is flushed
+ * @then the rest of batch is committed, failed write is retried by timer
+ * until it is out of attempts
+ */
+TEST_F(SQLiteWriteQueueTest, FailedWriteRetried) {
+  insert(1);
+  insert(1);
+  EXPECT_EQ(rows(), 1);
+  EXPECT_EQ(queue->size(), 1);
+
+  flushByTimer();
+  EXPECT_EQ(queue->size(), 0);
+  EXPECT_EQ(rows(), 1);
+}
+
+/**
+ * @given queue which failed to flush
+ * @when more writes than batch size and queue size are pushed
+ * @then they are not flushed until timer, the oldest ones are dropped
+ */
+TEST_F(SQLiteWriteQueueTest, NoImmediateFlushAfterFailure) {
+  insert(1);
+  insert(1);
+  EXPECT_EQ(queue->size(), 1);
+
+  insert(2);
+  insert(3);
+  insert(4);
+  EXPECT_EQ(rows(), 1);
+  EXPECT_EQ(queue->size(), 3);
+
+  flushByTimer();
+  EXPECT_EQ(queue->size(), 0);
+  EXPECT_EQ(rows(), 4);
+}
@@ -0,0 +1,42 @@
+/**
+ * Copyright Quadrivium LLC
+ * All Rights Reserved
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <libp2p/crypto/crypto_provider.hpp>
+
+#include <gmock/gmock.h>
+
+namespace libp2p::crypto {
+
+  struct CryptoProviderMock : public CryptoProvider {
+    ~CryptoProviderMock() override = default;
+
+    MOCK_CONST_METHOD2(generateKeys,
+                       outcome::result<KeyPair>(Key::Type,
+                                                common::RSAKeyType));
+
+    MOCK_CONST_METHOD1(derivePublicKey,
+                       outcome::result<PublicKey>(const PrivateKey &));
+
+    MOCK_CONST_METHOD2(sign,
+                       outcome::result<Buffer>(BytesIn, const PrivateKey &));
+
+    MOCK_CONST_METHOD3(verify,
+                       outcome::result<bool>(BytesIn,
+                                             BytesIn,
+                                             const PublicKey &));
+
+    MOCK_CONST_METHOD1(generateEphemeralKeyPair,
+                       outcome::result<EphemeralKeyPair>(common::CurveType));
+
+    MOCK_CONST_METHOD3(
+        stretchKey,
+        outcome::result<std::pair<StretchedKey, StretchedKey>>(
+            common::CipherType, common::HashType, const Buffer &));
+  };
+
+}  // namespace libp2p::crypto